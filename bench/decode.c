@@ -0,0 +1,217 @@
+/*
+ * decode microbenchmark: how long the server's command loop takes to
+ * get from one command to the next, with the GL call each handler
+ * makes replaced by an indirect call to a stub. three loops are timed
+ * over the same stream of fixed-length commands:
+ *
+ *   switch      the server's loop, a switch over the opcode with each
+ *               case calling through its own global pointer, the way
+ *               libepoxy entry points are called once resolved
+ *   goto        the same handlers, direct-threaded: every handler
+ *               validates the next header and jumps through a label
+ *               table itself
+ *   context     the switch, calling through a per-context table of
+ *               resolved pointers instead of the globals
+ *
+ * usage: sgl-decode-bench [COMMANDS] [PASSES] [OPCODES]
+ */
+#include <sharedgl.h>
+
+#include <stdlib.h>
+
+static const unsigned short sgl_cmd_lengths[SGL_CMD_MAX] = {
+#define SGL_COMMAND(name, length) length,
+#include <sglcommands.h>
+#undef SGL_COMMAND
+};
+
+typedef void (*sgl_bench_handler)(const int *operands);
+
+struct sgl_bench_context {
+    sgl_bench_handler gl[SGL_CMD_MAX];
+};
+
+static sgl_bench_handler sgl_bench_gl[SGL_CMD_MAX];
+static volatile unsigned int sink;
+
+__attribute__((noinline)) static void sgl_bench_stub(const int *operands)
+{
+    sink += (unsigned int)operands[0];
+}
+
+/*
+ * same checks as the server's, minus the long length form the stream
+ * never uses
+ */
+static inline int *sgl_next_command(int *pb, int *end)
+{
+    int opcode = SGL_CMD_OPCODE(*pb);
+    size_t length = SGL_CMD_LENGTH(*pb);
+    int *operands = pb + 1;
+
+    if (opcode >= SGL_CMD_MAX)
+        return NULL;
+    if (sgl_cmd_lengths[opcode] != SGL_CMD_VARIABLE_LENGTH && length != sgl_cmd_lengths[opcode])
+        return NULL;
+    if (length > (size_t)(end - operands))
+        return NULL;
+    return operands + length;
+}
+
+__attribute__((noinline)) static size_t sgl_bench_switch(int *pb, int *end)
+{
+    size_t decoded = 0;
+    while (*pb != SGL_CMD_INVALID) {
+        int *next = sgl_next_command(pb, end);
+        if (next == NULL)
+            break;
+
+        int cmd = SGL_CMD_OPCODE(*pb++);
+        switch (cmd) {
+#define SGL_COMMAND(name, length) case name: sgl_bench_gl[name](pb); break;
+#include <sglcommands.h>
+#undef SGL_COMMAND
+        }
+        pb = next;
+        decoded++;
+    }
+    return decoded;
+}
+
+__attribute__((noinline)) static size_t sgl_bench_goto(int *pb, int *end)
+{
+    static void *const labels[SGL_CMD_MAX] = {
+#define SGL_COMMAND(name, length) &&op_##name,
+#include <sglcommands.h>
+#undef SGL_COMMAND
+    };
+    size_t decoded = 0;
+    int *next;
+
+#define DISPATCH() \
+    do { \
+        if (*pb == SGL_CMD_INVALID || (next = sgl_next_command(pb, end)) == NULL) \
+            return decoded; \
+        goto *labels[SGL_CMD_OPCODE(*pb++)]; \
+    } while (0)
+
+    DISPATCH();
+#define SGL_COMMAND(name, length) op_##name: sgl_bench_gl[name](pb); pb = next; decoded++; DISPATCH();
+#include <sglcommands.h>
+#undef SGL_COMMAND
+#undef DISPATCH
+}
+
+__attribute__((noinline)) static size_t sgl_bench_context(struct sgl_bench_context *ctx, int *pb, int *end)
+{
+    size_t decoded = 0;
+    while (*pb != SGL_CMD_INVALID) {
+        int *next = sgl_next_command(pb, end);
+        if (next == NULL)
+            break;
+
+        int cmd = SGL_CMD_OPCODE(*pb++);
+        switch (cmd) {
+#define SGL_COMMAND(name, length) case name: ctx->gl[name](pb); break;
+#include <sglcommands.h>
+#undef SGL_COMMAND
+        }
+        pb = next;
+        decoded++;
+    }
+    return decoded;
+}
+
+/*
+ * commands picked at random from the first `opcodes` with a fixed
+ * length; all of them leaves the branch predictor about as little
+ * pattern as it can, a few is closer to a frame of a real program.
+ * the stream ends with a terminator, like a submit
+ */
+static int *sgl_bench_stream(size_t commands, int opcodes, int **end)
+{
+    int fixed[SGL_CMD_MAX];
+    int fixed_count = 0;
+    for (int i = 1; i < SGL_CMD_MAX; i++)
+        if (sgl_cmd_lengths[i] != SGL_CMD_VARIABLE_LENGTH)
+            fixed[fixed_count++] = i;
+    if (opcodes > 0 && opcodes < fixed_count)
+        fixed_count = opcodes;
+
+    size_t words = 1;
+    int *stream = malloc(commands * 17 * sizeof(int) + sizeof(int));
+    if (stream == NULL)
+        return NULL;
+
+    srand(1);
+    for (size_t i = 0; i < commands; i++) {
+        int cmd = fixed[rand() % fixed_count];
+        stream[words - 1] = SGL_CMD_HEADER(cmd, sgl_cmd_lengths[cmd]);
+        for (int j = 0; j < sgl_cmd_lengths[cmd]; j++)
+            stream[words++] = rand();
+        words++;
+    }
+    stream[words - 1] = SGL_CMD_INVALID;
+    *end = &stream[words - 1];
+    return stream;
+}
+
+static double sgl_bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int sgl_bench_compare(const void *a, const void *b)
+{
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char **argv)
+{
+    size_t commands = argc > 1 ? (size_t)atol(argv[1]) : 65536;
+    int passes = argc > 2 ? atoi(argv[2]) : 200;
+    int opcodes = argc > 3 ? atoi(argv[3]) : 0;
+    const char *names[] = { "switch", "goto", "context" };
+    double samples[3][passes > 0 ? passes : 1];
+    struct sgl_bench_context *ctx = malloc(sizeof(*ctx));
+    int *end, *stream = sgl_bench_stream(commands, opcodes, &end);
+
+    if (commands == 0 || passes <= 0 || ctx == NULL || stream == NULL) {
+        fprintf(stderr, "usage: %s [COMMANDS] [PASSES] [OPCODES]\n", argv[0]);
+        return 1;
+    }
+
+    for (int i = 0; i < SGL_CMD_MAX; i++)
+        sgl_bench_gl[i] = ctx->gl[i] = sgl_bench_stub;
+
+    /*
+     * passes interleave the loops so drift in clock speed hits all of
+     * them alike; medians keep one slow pass from moving the result
+     */
+    for (int pass = 0; pass < passes; pass++) {
+        for (int loop = 0; loop < 3; loop++) {
+            double start = sgl_bench_now();
+            size_t decoded = loop == 0 ? sgl_bench_switch(stream, end) :
+                             loop == 1 ? sgl_bench_goto(stream, end) :
+                                         sgl_bench_context(ctx, stream, end);
+            samples[loop][pass] = (sgl_bench_now() - start) / commands;
+            if (decoded != commands) {
+                fprintf(stderr, "%s decoded %zu of %zu commands\n", names[loop], decoded, commands);
+                return 1;
+            }
+        }
+    }
+
+    printf("%zu commands, %d passes, median ns/command\n", commands, passes);
+    for (int loop = 0; loop < 3; loop++) {
+        qsort(samples[loop], passes, sizeof(double), sgl_bench_compare);
+        printf("%-8s %6.2f\n", names[loop], samples[loop][passes / 2]);
+    }
+
+    free(stream);
+    free(ctx);
+    return 0;
+}
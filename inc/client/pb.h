@@ -22,10 +22,11 @@ struct pb_net_hooks {
 
 void pb_set_net(struct pb_net_hooks hooks, size_t internal_alloc_size);
 
-#ifndef _WIN32
 /*
- * to-do: determine if direct_access is really unneeded
+ * direct_access: encode commands straight into the client's shared
+ * ring instead of a private buffer, skipping pb_copy_to_shared
  */
+#ifndef _WIN32
 void pb_set(int pb, bool direct_access);
 #else
 void pb_set(bool direct_access);
@@ -33,6 +34,28 @@ void pb_unset(void);
 #endif
 
 void pb_reset();
+
+/*
+ * reserve `count` words for a command and return a cursor to write
+ * them through, so the capacity is checked once per command rather
+ * than once per word; room for the submit terminator is kept free.
+ * returns NULL when the words won't fit behind what's already been
+ * recorded, so the caller can flush and try again. words that won't
+ * fit even in an empty buffer mark it overflowed, to be dropped on
+ * the next submit, and go to a scratch sink instead; the cursor
+ * never points past the buffer. NULL as well if the sink can't be
+ * grown
+ */
+int *pb_reserve(size_t count);
+
+/*
+ * pb_reserve for the start of a command, the first word being its
+ * opcode; whatever is written after it up to the next command or
+ * pb_end_command is the command's, and its length goes in the header
+ */
+int *pb_begin_command(size_t count);
+void pb_end_command(void);
+
 void pb_push(int c);
 void pb_push64(int64_t c);
 void pb_pushf(float c);
@@ -64,5 +87,20 @@ size_t pb_capacity();
 bool pb_overflowed();
 
 void pb_copy_to_shared();
+size_t pb_ring_offset();
+void pb_flip();
+
+/*
+ * pointer into the client's own ring, for data the server writes
+ * back there; waits for the last submit to finish first
+ */
+void *pb_ring_ptr(size_t offs);
+
+/*
+ * submits are asynchronous; each is tagged with a sequence number
+ * and reading a return register waits for the server to finish it
+ */
+int pb_next_submit_seq();
+void pb_sync();
 
 #endif
@@ -3,5 +3,7 @@
 
 void spin_lock(int *lock);
 void spin_unlock(int volatile *lock);
+void spin_atomic_or(int *word, int bits);
+void spin_wake(int *word);
 
 #endif
\ No newline at end of file
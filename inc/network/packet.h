@@ -22,6 +22,9 @@ struct PACKED sgl_packet_connect {
     uint32_t gl_minor;
     uint32_t max_width;
     uint32_t max_height;
+    uint32_t protocol;
+    uint32_t upload_cache;
+    uint32_t blob_store;
 };
 
 struct PACKED sgl_packet_retval {
@@ -30,6 +33,7 @@ struct PACKED sgl_packet_retval {
         uint64_t retval;
     };
     uint32_t retval_v[256 / sizeof(uint32_t)];
+    uint32_t error;
 };
 #ifdef _WIN32
 __pragma( pack(pop))
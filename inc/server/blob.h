@@ -0,0 +1,28 @@
+#ifndef _SGL_BLOB_H_
+#define _SGL_BLOB_H_
+
+#include <sglhash.h>
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * texture and buffer contents shared by every client, looked up by
+ * content so identical assets are only sent once; kept in memory up
+ * to a budget, and optionally written through to a directory so they
+ * outlive the server
+ */
+void sgl_blob_store_init(size_t budget, const char *directory);
+bool sgl_blob_store_enabled(void);
+
+/*
+ * NULL on a miss; the data is only valid until the next insert
+ */
+const void *sgl_blob_find(const struct sgl_blob_key *key);
+
+/*
+ * data must hash to key, anything else is refused
+ */
+void sgl_blob_insert(const struct sgl_blob_key *key, const void *data);
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef _SGL_CACHE_H_
+#define _SGL_CACHE_H_
+
+#include <epoxy/gl.h>
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * client arrays and indices kept resident between draws, indexed by
+ * a slot the client picks; each is held in a buffer object to draw
+ * from. data is a system memory copy, for pointers that land before
+ * its start, kept only if the stream ring can't stand in for it
+ */
+struct sgl_upload_cache_entry {
+    void *data;
+    size_t size;
+    GLuint buffer;
+};
+
+struct sgl_upload_cache {
+    struct sgl_upload_cache_entry *slots;
+    size_t used;    /* bytes in buffers, held to the budget */
+};
+
+/*
+ * bytes each client may keep cached, the budget clients are told
+ */
+void sgl_upload_cache_init(size_t budget);
+
+/*
+ * replaces whatever the slot held with a copy of data, returns NULL
+ * if the slot is out of range, the copy would take the cache over its
+ * budget, or it can't be made
+ */
+struct sgl_upload_cache_entry *sgl_upload_cache_store(struct sgl_upload_cache *cache, int slot, const void *data, size_t size, bool keep_copy);
+
+/*
+ * entry->data, read back from its buffer if it wasn't kept
+ */
+void *sgl_upload_cache_data(struct sgl_upload_cache_entry *entry);
+
+/*
+ * NULL if the slot is out of range or empty
+ */
+struct sgl_upload_cache_entry *sgl_upload_cache_get(struct sgl_upload_cache *cache, int slot);
+
+void sgl_upload_cache_drop(struct sgl_upload_cache *cache, int slot);
+
+/*
+ * releases system memory only, the buffer objects go with the context
+ */
+void sgl_upload_cache_free(struct sgl_upload_cache *cache);
+
+#endif
@@ -2,14 +2,91 @@
 #define _SGL_CONTEXT_H_
 
 #include <SDL2/SDL.h>
+#include <server/names.h>
+#include <server/stream.h>
+#include <server/cache.h>
+#include <server/program.h>
+
+/*
+ * how gl errors are collected on behalf of clients
+ */
+enum sgl_error_mode {
+    SGL_ERROR_MODE_DEFERRED,    /* one glGetError per submit, kept as a sticky error */
+    SGL_ERROR_MODE_VALIDATE,    /* debug context, KHR_debug log, glGetError per command */
+    SGL_ERROR_MODE_NO_ERROR     /* KHR_no_error context, errors are undefined behavior */
+};
 
 struct sgl_host_context {
     SDL_Window *window;
     SDL_GLContext gl_context;
+
+    /*
+     * reassembly buffer for uploads streamed in parts
+     */
+    void *upload_parts;
+    size_t upload_parts_size;
+
+    /*
+     * size of a blob VP_BLOB_QUERY found and copied into upload_parts,
+     * for the command that reads it in the client's next submit
+     */
+    size_t blob_found_size;
+
+    /*
+     * ring that uploaded vertices and indices are drawn from
+     */
+    struct sgl_stream stream;
+
+    /*
+     * client arrays and indices kept resident between draws
+     */
+    struct sgl_upload_cache upload_cache;
+
+    /*
+     * vertex array for batched glBegin/glEnd pairs, and a buffer for
+     * them if the stream ring is unavailable; created on first use
+     */
+    GLuint immediate_vao;
+    GLuint immediate_vbo;
+
+    /*
+     * bindings a batched glBegin/glEnd pair puts back, tracked as
+     * they're made rather than queried per draw; unknown until first
+     * queried, and again once glPopClientAttrib may have restored them
+     */
+    bool bindings_known;
+    GLuint vertex_array;
+    GLuint array_buffer;
+    GLenum client_active_texture;
+
+    /*
+     * a shader has mentioned gl_DrawID, which tells the draws of a
+     * multi-draw apart, so draws are no longer merged into one
+     */
+    bool reads_draw_id;
+
+    /*
+     * sources and link state of shaders and programs, for finding
+     * linked programs in the program cache
+     */
+    struct sgl_shader_records shaders;
+
+    /*
+     * client object names to host names
+     */
+    struct sgl_name_table names[SGL_NAMESPACE_COUNT];
+
+    /*
+     * first error since the client last saw one, reported back
+     * with every submit until the client clears it
+     */
+    int error;
 };
 
 void sgl_set_max_resolution(int width, int height);
 void sgl_get_max_resolution(int *width, int *height);
+void sgl_set_error_mode(enum sgl_error_mode mode);
+enum sgl_error_mode sgl_get_error_mode(void);
 
 struct sgl_host_context *sgl_context_create();
 void sgl_context_destroy(struct sgl_host_context *ctx);
@@ -0,0 +1,31 @@
+#ifndef _SGL_NAMES_H_
+#define _SGL_NAMES_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * clients allocate their own object names, the server maps them
+ * onto host names as they are first used
+ */
+enum sgl_namespace {
+    SGL_NAMESPACE_BUFFER,
+    SGL_NAMESPACE_TEXTURE,
+    SGL_NAMESPACE_SHADER, /* shaders and programs share one namespace */
+    SGL_NAMESPACE_COUNT
+};
+
+struct sgl_name_table {
+    unsigned int *host;     /* indexed by client name */
+    size_t host_count;
+    unsigned int *client;   /* indexed by host name */
+    size_t client_count;
+};
+
+unsigned int sgl_name_lookup(struct sgl_name_table *table, unsigned int name);
+unsigned int sgl_name_reverse(struct sgl_name_table *table, unsigned int host);
+bool sgl_name_bind(struct sgl_name_table *table, unsigned int name, unsigned int host);
+unsigned int sgl_name_forget(struct sgl_name_table *table, unsigned int name);
+void sgl_name_table_free(struct sgl_name_table *table);
+
+#endif
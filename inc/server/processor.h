@@ -17,6 +17,23 @@ struct sgl_cmd_processor_args {
     bool network_over_shared;
     int port;
 
+    /*
+     * shared memory only: once idle, stop spinning and
+     * sleep on a futex until a client submits
+     */
+    bool idle_sleep;
+
+    /*
+     * shared memory only: client slots the stage is split
+     * between, at most SGL_MAX_CLIENTS
+     */
+    int max_clients;
+
+    /*
+     * MiB of client arrays each client may keep resident
+     */
+    int upload_cache_size;
+
     /*
      * opengl version
      */
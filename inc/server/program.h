@@ -0,0 +1,69 @@
+#ifndef _SGL_PROGRAM_H_
+#define _SGL_PROGRAM_H_
+
+#include <epoxy/gl.h>
+#include <sglhash.h>
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * what a shader or program was given that decides its binary, by
+ * client name: the key of a shader's source, or a digest chained
+ * over the state set on a program ahead of linking
+ */
+struct sgl_shader_record {
+    struct sgl_blob_key key;
+    bool has_source;
+    bool compile_pending;   /* compile put off until something needs it */
+};
+
+struct sgl_shader_records {
+    struct sgl_shader_record *records;
+    size_t count;
+};
+
+/*
+ * grows the table as needed, NULL for names past SGL_MAX_OBJECT_NAME
+ */
+struct sgl_shader_record *sgl_shader_record(struct sgl_shader_records *records, unsigned int name);
+
+/*
+ * NULL if nothing was recorded for the name
+ */
+struct sgl_shader_record *sgl_shader_record_find(struct sgl_shader_records *records, unsigned int name);
+
+void sgl_shader_record_mix(struct sgl_shader_record *record, const void *data, size_t size);
+void sgl_shader_records_free(struct sgl_shader_records *records);
+
+/*
+ * linked programs kept in a directory, keyed by the sources and link
+ * state that made them, under a subdirectory per driver so binaries
+ * from another renderer or driver version are never tried
+ */
+void sgl_program_cache_init(const char *directory);
+
+/*
+ * false without a directory, or if the driver has no binary formats;
+ * needs a current context the first time
+ */
+bool sgl_program_cache_ready(void);
+
+/*
+ * whether a source has compiled on this driver before
+ */
+bool sgl_program_cache_compiled(const struct sgl_blob_key *source);
+void sgl_program_cache_note_compiled(const struct sgl_blob_key *source);
+
+/*
+ * true if program was restored and links, otherwise it's left for
+ * the caller to link
+ */
+bool sgl_program_cache_load(GLuint program, const uint64_t key[4]);
+
+/*
+ * does nothing unless program linked
+ */
+void sgl_program_cache_save(GLuint program, const uint64_t key[4]);
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef _SGL_STATS_H_
+#define _SGL_STATS_H_
+
+#include <stdint.h>
+
+/*
+ * counters across all clients, logged and reset once per interval
+ */
+struct sgl_stats {
+    uint64_t submits;
+    uint64_t draws;             /* glDrawArrays and glDrawElements decoded */
+    uint64_t coalesced_draws;   /* of those, how many were merged with neighbours */
+    uint64_t coalesced_calls;   /* multi-draws they were merged into */
+};
+
+extern struct sgl_stats sgl_stats;
+
+/*
+ * 0, the default, never logs
+ */
+void sgl_stats_set_interval(int seconds);
+
+/*
+ * called once per submit
+ */
+void sgl_stats_submit_done(void);
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef _SGL_STREAM_H_
+#define _SGL_STREAM_H_
+
+#include <epoxy/gl.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * uploaded client arrays and indices are copied into a persistently
+ * mapped ring of buffer storage, so the host draws them from a buffer
+ * object; the ring is fenced a segment at a time
+ */
+#define SGL_STREAM_SIZE (32 * 1024 * 1024)
+#define SGL_STREAM_SEGMENTS 4
+#define SGL_STREAM_ALIGNMENT 64
+
+struct sgl_stream {
+    GLuint buffer;
+    void *map;
+    size_t head;
+    int segment;
+    GLsync fences[SGL_STREAM_SEGMENTS];
+    bool unavailable;
+};
+
+/*
+ * copies data into the ring and returns its offset in stream->buffer,
+ * or -1 if it doesn't fit or the host can't map buffers persistently
+ */
+intptr_t sgl_stream_write(struct sgl_stream *stream, const void *data, size_t length);
+
+/*
+ * the same for the first length bytes of another buffer, copied on the
+ * host with `lead` bytes of the ring left ahead of them, so offsets
+ * down to -lead from the returned one stay inside the ring
+ */
+intptr_t sgl_stream_copy(struct sgl_stream *stream, GLuint buffer, size_t lead, size_t length);
+
+/*
+ * whether writes and copies of length bytes can succeed, mapping the
+ * ring on first use
+ */
+bool sgl_stream_fits(struct sgl_stream *stream, size_t length);
+
+#endif
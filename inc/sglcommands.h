@@ -0,0 +1,1119 @@
+/*
+ * every command the client can send, in opcode order; this is the only
+ * list of them, the enum in sharedgl.h, the name table used for
+ * debugging and the server's length table are all generated from it by
+ * defining SGL_COMMAND(name, length) before including this file
+ *
+ * length is the number of words after the header, for commands that
+ * always send the same operands; the server drops a submit whose
+ * header disagrees. anything counted, strung or uploaded, or sent
+ * from more than one place, is SGL_CMD_VARIABLE_LENGTH
+ */
+SGL_COMMAND(SGL_CMD_INVALID, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_FLIP, SGL_CMD_VARIABLE_LENGTH)                 // USE SGL_CMD_SWAP_BUFFERS INSTEAD
+SGL_COMMAND(SGL_CMD_SEND_DATA, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GET_CONTEXT, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SET_CONTEXT, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GET_SIZE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VP_UPLOAD, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VP_NULL, 0)
+SGL_COMMAND(SGL_CMD_VP_UPLOAD_STAY, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VP_DOWNLOAD, SGL_CMD_VARIABLE_LENGTH)          // UNLIKE VP_UPLOAD, WE USE BYTES INSTEAD OF INTS
+SGL_COMMAND(SGL_CMD_CREATE_CONTEXT, 0)
+SGL_COMMAND(SGL_CMD_REPORT_DIMS, SGL_CMD_VARIABLE_LENGTH)          // NOT USED
+SGL_COMMAND(SGL_CMD_HELLO_WORLD, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GOODBYE_WORLD, 1)
+SGL_COMMAND(SGL_CMD_SWAP_BUFFERS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VP_UPLOAD_PART, SGL_CMD_VARIABLE_LENGTH)       // ONE PIECE OF AN UPLOAD TOO LARGE FOR THE PUSH BUFFER
+SGL_COMMAND(SGL_CMD_VP_DOWNLOAD_BULK, 2)                           // BYTES, WRITTEN INTO THE CLIENT'S RING (OR APPENDED TO THE RETVAL PACKET)
+SGL_COMMAND(SGL_CMD_VP_CLEAR_ERROR, SGL_CMD_VARIABLE_LENGTH)       // CLIENT HAS SEEN THE STICKY ERROR
+SGL_COMMAND(SGL_CMD_VP_DRAW_IMMEDIATE, SGL_CMD_VARIABLE_LENGTH)    // A GLBEGIN/GLEND PAIR AS VERTICES FROM THE LAST UPLOAD
+SGL_COMMAND(SGL_CMD_VP_CACHE_STORE, SGL_CMD_VARIABLE_LENGTH)       // KEEP THE LAST UPLOAD IN AN UPLOAD CACHE SLOT
+SGL_COMMAND(SGL_CMD_VP_CACHE_USE, SGL_CMD_VARIABLE_LENGTH)         // AN UPLOAD CACHE SLOT BECOMES THE LAST UPLOAD
+SGL_COMMAND(SGL_CMD_VP_CACHE_DROP, SGL_CMD_VARIABLE_LENGTH)        // FREE A COUNTED LIST OF UPLOAD CACHE SLOTS
+SGL_COMMAND(SGL_CMD_VP_BLOB_QUERY, SGL_CMD_VARIABLE_LENGTH)        // BLOB BY KEY BECOMES THE LAST UPLOAD, RETVAL SAYS IF IT WAS FOUND
+SGL_COMMAND(SGL_CMD_VP_BLOB_STORE, SGL_CMD_VARIABLE_LENGTH)        // KEEP THE LAST UPLOAD IN THE BLOB STORE UNDER A KEY
+SGL_COMMAND(SGL_CMD_VP_SHADER_SOURCE_KEY, SGL_CMD_VARIABLE_LENGTH) // SHADER SOURCE FROM THE BLOB STORE BY KEY, RETVAL SAYS IF IT WAS FOUND
+
+SGL_COMMAND(SGL_CMD_CULLFACE, 1)
+SGL_COMMAND(SGL_CMD_FRONTFACE, 1)
+SGL_COMMAND(SGL_CMD_HINT, 2)
+SGL_COMMAND(SGL_CMD_LINEWIDTH, 1)
+SGL_COMMAND(SGL_CMD_POINTSIZE, 1)
+SGL_COMMAND(SGL_CMD_POLYGONMODE, 2)
+SGL_COMMAND(SGL_CMD_SCISSOR, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXPARAMETERF, 3)
+SGL_COMMAND(SGL_CMD_TEXPARAMETERFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXPARAMETERI, 3)
+SGL_COMMAND(SGL_CMD_TEXPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXIMAGE1D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXIMAGE2D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DRAWBUFFER, 1)
+SGL_COMMAND(SGL_CMD_CLEAR, 1)
+SGL_COMMAND(SGL_CMD_CLEARCOLOR, 4)
+SGL_COMMAND(SGL_CMD_CLEARSTENCIL, 1)
+SGL_COMMAND(SGL_CMD_CLEARDEPTH, 1)
+SGL_COMMAND(SGL_CMD_STENCILMASK, 1)
+SGL_COMMAND(SGL_CMD_COLORMASK, 4)
+SGL_COMMAND(SGL_CMD_DEPTHMASK, 1)
+SGL_COMMAND(SGL_CMD_DISABLE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ENABLE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_FINISH, 0)
+SGL_COMMAND(SGL_CMD_FLUSH, 0)
+SGL_COMMAND(SGL_CMD_BLENDFUNC, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_LOGICOP, 1)
+SGL_COMMAND(SGL_CMD_STENCILFUNC, 3)
+SGL_COMMAND(SGL_CMD_STENCILOP, 3)
+SGL_COMMAND(SGL_CMD_DEPTHFUNC, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PIXELSTOREF, 2)
+SGL_COMMAND(SGL_CMD_PIXELSTOREI, 2)
+SGL_COMMAND(SGL_CMD_READBUFFER, 1)
+SGL_COMMAND(SGL_CMD_READPIXELS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETBOOLEANV, 1)
+SGL_COMMAND(SGL_CMD_GETDOUBLEV, 1)
+SGL_COMMAND(SGL_CMD_GETERROR, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETFLOATV, 1)
+SGL_COMMAND(SGL_CMD_GETINTEGERV, 1)
+SGL_COMMAND(SGL_CMD_GETSTRING, 1)
+SGL_COMMAND(SGL_CMD_GETTEXIMAGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETTEXPARAMETERFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETTEXPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETTEXLEVELPARAMETERFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETTEXLEVELPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ISENABLED, 1)
+SGL_COMMAND(SGL_CMD_DEPTHRANGE, 2)
+SGL_COMMAND(SGL_CMD_VIEWPORT, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_NEWLIST, 2)
+SGL_COMMAND(SGL_CMD_ENDLIST, 0)
+SGL_COMMAND(SGL_CMD_CALLLIST, 1)
+SGL_COMMAND(SGL_CMD_CALLLISTS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DELETELISTS, 2)
+SGL_COMMAND(SGL_CMD_GENLISTS, 1)
+SGL_COMMAND(SGL_CMD_LISTBASE, 1)
+SGL_COMMAND(SGL_CMD_BEGIN, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_BITMAP, 6)
+SGL_COMMAND(SGL_CMD_COLOR3B, 3)
+SGL_COMMAND(SGL_CMD_COLOR3BV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR3D, 3)
+SGL_COMMAND(SGL_CMD_COLOR3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR3F, 3)
+SGL_COMMAND(SGL_CMD_COLOR3FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR3I, 3)
+SGL_COMMAND(SGL_CMD_COLOR3IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR3S, 3)
+SGL_COMMAND(SGL_CMD_COLOR3SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR3UB, 3)
+SGL_COMMAND(SGL_CMD_COLOR3UBV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR3UI, 3)
+SGL_COMMAND(SGL_CMD_COLOR3UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR3US, 3)
+SGL_COMMAND(SGL_CMD_COLOR3USV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR4B, 4)
+SGL_COMMAND(SGL_CMD_COLOR4BV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR4D, 4)
+SGL_COMMAND(SGL_CMD_COLOR4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR4F, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR4FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR4I, 4)
+SGL_COMMAND(SGL_CMD_COLOR4IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR4S, 4)
+SGL_COMMAND(SGL_CMD_COLOR4SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR4UB, 4)
+SGL_COMMAND(SGL_CMD_COLOR4UBV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR4UI, 4)
+SGL_COMMAND(SGL_CMD_COLOR4UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLOR4US, 4)
+SGL_COMMAND(SGL_CMD_COLOR4USV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_EDGEFLAG, 1)
+SGL_COMMAND(SGL_CMD_EDGEFLAGV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_END, 0)
+SGL_COMMAND(SGL_CMD_INDEXD, 1)
+SGL_COMMAND(SGL_CMD_INDEXDV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_INDEXF, 1)
+SGL_COMMAND(SGL_CMD_INDEXFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_INDEXI, 1)
+SGL_COMMAND(SGL_CMD_INDEXIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_INDEXS, 1)
+SGL_COMMAND(SGL_CMD_INDEXSV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_NORMAL3B, 3)
+SGL_COMMAND(SGL_CMD_NORMAL3BV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_NORMAL3D, 3)
+SGL_COMMAND(SGL_CMD_NORMAL3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_NORMAL3F, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_NORMAL3FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_NORMAL3I, 3)
+SGL_COMMAND(SGL_CMD_NORMAL3IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_NORMAL3S, 3)
+SGL_COMMAND(SGL_CMD_NORMAL3SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RASTERPOS2D, 2)
+SGL_COMMAND(SGL_CMD_RASTERPOS2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RASTERPOS2F, 2)
+SGL_COMMAND(SGL_CMD_RASTERPOS2FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RASTERPOS2I, 2)
+SGL_COMMAND(SGL_CMD_RASTERPOS2IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RASTERPOS2S, 2)
+SGL_COMMAND(SGL_CMD_RASTERPOS2SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RASTERPOS3D, 3)
+SGL_COMMAND(SGL_CMD_RASTERPOS3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RASTERPOS3F, 3)
+SGL_COMMAND(SGL_CMD_RASTERPOS3FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RASTERPOS3I, 3)
+SGL_COMMAND(SGL_CMD_RASTERPOS3IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RASTERPOS3S, 3)
+SGL_COMMAND(SGL_CMD_RASTERPOS3SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RASTERPOS4D, 4)
+SGL_COMMAND(SGL_CMD_RASTERPOS4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RASTERPOS4F, 4)
+SGL_COMMAND(SGL_CMD_RASTERPOS4FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RASTERPOS4I, 4)
+SGL_COMMAND(SGL_CMD_RASTERPOS4IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RASTERPOS4S, 4)
+SGL_COMMAND(SGL_CMD_RASTERPOS4SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RECTD, 4)
+SGL_COMMAND(SGL_CMD_RECTDV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RECTF, 4)
+SGL_COMMAND(SGL_CMD_RECTFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RECTI, 4)
+SGL_COMMAND(SGL_CMD_RECTIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RECTS, 4)
+SGL_COMMAND(SGL_CMD_RECTSV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD1D, 1)
+SGL_COMMAND(SGL_CMD_TEXCOORD1DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD1F, 1)
+SGL_COMMAND(SGL_CMD_TEXCOORD1FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD1I, 1)
+SGL_COMMAND(SGL_CMD_TEXCOORD1IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD1S, 1)
+SGL_COMMAND(SGL_CMD_TEXCOORD1SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD2D, 2)
+SGL_COMMAND(SGL_CMD_TEXCOORD2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD2F, 2)
+SGL_COMMAND(SGL_CMD_TEXCOORD2FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD2I, 2)
+SGL_COMMAND(SGL_CMD_TEXCOORD2IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD2S, 2)
+SGL_COMMAND(SGL_CMD_TEXCOORD2SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD3D, 3)
+SGL_COMMAND(SGL_CMD_TEXCOORD3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD3F, 3)
+SGL_COMMAND(SGL_CMD_TEXCOORD3FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD3I, 3)
+SGL_COMMAND(SGL_CMD_TEXCOORD3IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD3S, 3)
+SGL_COMMAND(SGL_CMD_TEXCOORD3SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD4D, 4)
+SGL_COMMAND(SGL_CMD_TEXCOORD4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD4F, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD4FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD4I, 4)
+SGL_COMMAND(SGL_CMD_TEXCOORD4IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORD4S, 4)
+SGL_COMMAND(SGL_CMD_TEXCOORD4SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEX2D, 2)
+SGL_COMMAND(SGL_CMD_VERTEX2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEX2F, 2)
+SGL_COMMAND(SGL_CMD_VERTEX2FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEX2I, 2)
+SGL_COMMAND(SGL_CMD_VERTEX2IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEX2S, 2)
+SGL_COMMAND(SGL_CMD_VERTEX2SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEX3D, 3)
+SGL_COMMAND(SGL_CMD_VERTEX3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEX3F, 3)
+SGL_COMMAND(SGL_CMD_VERTEX3FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEX3I, 3)
+SGL_COMMAND(SGL_CMD_VERTEX3IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEX3S, 3)
+SGL_COMMAND(SGL_CMD_VERTEX3SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEX4D, 4)
+SGL_COMMAND(SGL_CMD_VERTEX4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEX4F, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEX4FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEX4I, 4)
+SGL_COMMAND(SGL_CMD_VERTEX4IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEX4S, 4)
+SGL_COMMAND(SGL_CMD_VERTEX4SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLIPPLANE, 5)
+SGL_COMMAND(SGL_CMD_COLORMATERIAL, 2)
+SGL_COMMAND(SGL_CMD_FOGF, 2)
+SGL_COMMAND(SGL_CMD_FOGFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_FOGI, 2)
+SGL_COMMAND(SGL_CMD_FOGIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_LIGHTF, 3)
+SGL_COMMAND(SGL_CMD_LIGHTFV, 6)
+SGL_COMMAND(SGL_CMD_LIGHTI, 3)
+SGL_COMMAND(SGL_CMD_LIGHTIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_LIGHTMODELF, 2)
+SGL_COMMAND(SGL_CMD_LIGHTMODELFV, 5)
+SGL_COMMAND(SGL_CMD_LIGHTMODELI, 2)
+SGL_COMMAND(SGL_CMD_LIGHTMODELIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_LINESTIPPLE, 2)
+SGL_COMMAND(SGL_CMD_MATERIALF, 3)
+SGL_COMMAND(SGL_CMD_MATERIALFV, 6)
+SGL_COMMAND(SGL_CMD_MATERIALI, 3)
+SGL_COMMAND(SGL_CMD_MATERIALIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_POLYGONSTIPPLE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SHADEMODEL, 1)
+SGL_COMMAND(SGL_CMD_TEXENVF, 3)
+SGL_COMMAND(SGL_CMD_TEXENVFV, 6)
+SGL_COMMAND(SGL_CMD_TEXENVI, 3)
+SGL_COMMAND(SGL_CMD_TEXENVIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXGEND, 3)
+SGL_COMMAND(SGL_CMD_TEXGENDV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXGENF, 3)
+SGL_COMMAND(SGL_CMD_TEXGENFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXGENI, 3)
+SGL_COMMAND(SGL_CMD_TEXGENIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_FEEDBACKBUFFER, 2)
+SGL_COMMAND(SGL_CMD_SELECTBUFFER, 1)
+SGL_COMMAND(SGL_CMD_RENDERMODE, 1)
+SGL_COMMAND(SGL_CMD_INITNAMES, 0)
+SGL_COMMAND(SGL_CMD_LOADNAME, 1)
+SGL_COMMAND(SGL_CMD_PASSTHROUGH, 1)
+SGL_COMMAND(SGL_CMD_POPNAME, 0)
+SGL_COMMAND(SGL_CMD_PUSHNAME, 1)
+SGL_COMMAND(SGL_CMD_CLEARACCUM, 4)
+SGL_COMMAND(SGL_CMD_CLEARINDEX, 1)
+SGL_COMMAND(SGL_CMD_INDEXMASK, 1)
+SGL_COMMAND(SGL_CMD_ACCUM, 2)
+SGL_COMMAND(SGL_CMD_POPATTRIB, 0)
+SGL_COMMAND(SGL_CMD_PUSHATTRIB, 1)
+SGL_COMMAND(SGL_CMD_MAP1D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MAP1F, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MAP2D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MAP2F, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MAPGRID1D, 3)
+SGL_COMMAND(SGL_CMD_MAPGRID1F, 3)
+SGL_COMMAND(SGL_CMD_MAPGRID2D, 6)
+SGL_COMMAND(SGL_CMD_MAPGRID2F, 6)
+SGL_COMMAND(SGL_CMD_EVALCOORD1D, 1)
+SGL_COMMAND(SGL_CMD_EVALCOORD1DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_EVALCOORD1F, 1)
+SGL_COMMAND(SGL_CMD_EVALCOORD1FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_EVALCOORD2D, 2)
+SGL_COMMAND(SGL_CMD_EVALCOORD2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_EVALCOORD2F, 2)
+SGL_COMMAND(SGL_CMD_EVALCOORD2FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_EVALMESH1, 3)
+SGL_COMMAND(SGL_CMD_EVALPOINT1, 1)
+SGL_COMMAND(SGL_CMD_EVALMESH2, 5)
+SGL_COMMAND(SGL_CMD_EVALPOINT2, 2)
+SGL_COMMAND(SGL_CMD_ALPHAFUNC, 2)
+SGL_COMMAND(SGL_CMD_PIXELZOOM, 2)
+SGL_COMMAND(SGL_CMD_PIXELTRANSFERF, 2)
+SGL_COMMAND(SGL_CMD_PIXELTRANSFERI, 2)
+SGL_COMMAND(SGL_CMD_PIXELMAPFV, 2)
+SGL_COMMAND(SGL_CMD_PIXELMAPUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PIXELMAPUSV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COPYPIXELS, 5)
+SGL_COMMAND(SGL_CMD_DRAWPIXELS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETCLIPPLANE, 2)
+SGL_COMMAND(SGL_CMD_GETLIGHTFV, 2)
+SGL_COMMAND(SGL_CMD_GETLIGHTIV, 2)
+SGL_COMMAND(SGL_CMD_GETMAPDV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETMAPFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETMAPIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETMATERIALFV, 2)
+SGL_COMMAND(SGL_CMD_GETMATERIALIV, 2)
+SGL_COMMAND(SGL_CMD_GETPIXELMAPFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETPIXELMAPUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETPIXELMAPUSV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETPOLYGONSTIPPLE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETTEXENVFV, 2)
+SGL_COMMAND(SGL_CMD_GETTEXENVIV, 2)
+SGL_COMMAND(SGL_CMD_GETTEXGENDV, 2)
+SGL_COMMAND(SGL_CMD_GETTEXGENFV, 2)
+SGL_COMMAND(SGL_CMD_GETTEXGENIV, 2)
+SGL_COMMAND(SGL_CMD_ISLIST, 1)
+SGL_COMMAND(SGL_CMD_FRUSTUM, 6)
+SGL_COMMAND(SGL_CMD_LOADIDENTITY, 0)
+SGL_COMMAND(SGL_CMD_LOADMATRIXF, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_LOADMATRIXD, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MATRIXMODE, 1)
+SGL_COMMAND(SGL_CMD_MULTMATRIXF, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTMATRIXD, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ORTHO, 6)
+SGL_COMMAND(SGL_CMD_POPMATRIX, 0)
+SGL_COMMAND(SGL_CMD_PUSHMATRIX, 0)
+SGL_COMMAND(SGL_CMD_ROTATED, 4)
+SGL_COMMAND(SGL_CMD_ROTATEF, 4)
+SGL_COMMAND(SGL_CMD_SCALED, 3)
+SGL_COMMAND(SGL_CMD_SCALEF, 3)
+SGL_COMMAND(SGL_CMD_TRANSLATED, 3)
+SGL_COMMAND(SGL_CMD_TRANSLATEF, 3)
+SGL_COMMAND(SGL_CMD_DRAWARRAYS, 3)
+SGL_COMMAND(SGL_CMD_DRAWELEMENTS, 6)
+SGL_COMMAND(SGL_CMD_GETPOINTERV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_POLYGONOFFSET, 2)
+SGL_COMMAND(SGL_CMD_COPYTEXIMAGE1D, 7)
+SGL_COMMAND(SGL_CMD_COPYTEXIMAGE2D, 8)
+SGL_COMMAND(SGL_CMD_COPYTEXSUBIMAGE1D, 6)
+SGL_COMMAND(SGL_CMD_COPYTEXSUBIMAGE2D, 8)
+SGL_COMMAND(SGL_CMD_TEXSUBIMAGE1D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXSUBIMAGE2D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_BINDTEXTURE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DELETETEXTURES, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GENTEXTURES, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ISTEXTURE, 1)
+SGL_COMMAND(SGL_CMD_ARRAYELEMENT, 1)
+SGL_COMMAND(SGL_CMD_COLORPOINTER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DISABLECLIENTSTATE, 1)
+SGL_COMMAND(SGL_CMD_EDGEFLAGPOINTER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ENABLECLIENTSTATE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_INDEXPOINTER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_INTERLEAVEDARRAYS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_NORMALPOINTER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORDPOINTER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXPOINTER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ARETEXTURESRESIDENT, 1)
+SGL_COMMAND(SGL_CMD_PRIORITIZETEXTURES, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_INDEXUB, 1)
+SGL_COMMAND(SGL_CMD_INDEXUBV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_POPCLIENTATTRIB, 0)
+SGL_COMMAND(SGL_CMD_PUSHCLIENTATTRIB, 1)
+SGL_COMMAND(SGL_CMD_DRAWRANGEELEMENTS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXIMAGE3D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXSUBIMAGE3D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COPYTEXSUBIMAGE3D, 9)
+SGL_COMMAND(SGL_CMD_ACTIVETEXTURE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SAMPLECOVERAGE, 2)
+SGL_COMMAND(SGL_CMD_COMPRESSEDTEXIMAGE3D, 8)
+SGL_COMMAND(SGL_CMD_COMPRESSEDTEXIMAGE2D, 7)
+SGL_COMMAND(SGL_CMD_COMPRESSEDTEXIMAGE1D, 6)
+SGL_COMMAND(SGL_CMD_COMPRESSEDTEXSUBIMAGE3D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COMPRESSEDTEXSUBIMAGE2D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COMPRESSEDTEXSUBIMAGE1D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETCOMPRESSEDTEXIMAGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLIENTACTIVETEXTURE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD1D, 2)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD1DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD1F, 2)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD1FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD1I, 2)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD1IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD1S, 2)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD1SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD2D, 3)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD2F, 3)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD2FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD2I, 3)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD2IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD2S, 3)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD2SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD3D, 4)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD3F, 4)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD3FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD3I, 4)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD3IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD3S, 4)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD3SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD4D, 5)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD4F, 5)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD4FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD4I, 5)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD4IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD4S, 5)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD4SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_LOADTRANSPOSEMATRIXF, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_LOADTRANSPOSEMATRIXD, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTTRANSPOSEMATRIXF, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTTRANSPOSEMATRIXD, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_BLENDFUNCSEPARATE, 4)
+SGL_COMMAND(SGL_CMD_MULTIDRAWARRAYS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTIDRAWELEMENTS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_POINTPARAMETERF, 2)
+SGL_COMMAND(SGL_CMD_POINTPARAMETERFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_POINTPARAMETERI, 2)
+SGL_COMMAND(SGL_CMD_POINTPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_FOGCOORDF, 1)
+SGL_COMMAND(SGL_CMD_FOGCOORDFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_FOGCOORDD, 1)
+SGL_COMMAND(SGL_CMD_FOGCOORDDV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_FOGCOORDPOINTER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3B, 3)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3BV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3D, 3)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3F, 3)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3I, 3)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3S, 3)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3UB, 3)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3UBV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3UI, 3)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3US, 3)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLOR3USV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLORPOINTER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_WINDOWPOS2D, 2)
+SGL_COMMAND(SGL_CMD_WINDOWPOS2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_WINDOWPOS2F, 2)
+SGL_COMMAND(SGL_CMD_WINDOWPOS2FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_WINDOWPOS2I, 2)
+SGL_COMMAND(SGL_CMD_WINDOWPOS2IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_WINDOWPOS2S, 2)
+SGL_COMMAND(SGL_CMD_WINDOWPOS2SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_WINDOWPOS3D, 3)
+SGL_COMMAND(SGL_CMD_WINDOWPOS3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_WINDOWPOS3F, 3)
+SGL_COMMAND(SGL_CMD_WINDOWPOS3FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_WINDOWPOS3I, 3)
+SGL_COMMAND(SGL_CMD_WINDOWPOS3IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_WINDOWPOS3S, 3)
+SGL_COMMAND(SGL_CMD_WINDOWPOS3SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_BLENDCOLOR, 4)
+SGL_COMMAND(SGL_CMD_BLENDEQUATION, 1)
+SGL_COMMAND(SGL_CMD_GENQUERIES, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DELETEQUERIES, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ISQUERY, 1)
+SGL_COMMAND(SGL_CMD_BEGINQUERY, 2)
+SGL_COMMAND(SGL_CMD_ENDQUERY, 1)
+SGL_COMMAND(SGL_CMD_GETQUERYIV, 2)
+SGL_COMMAND(SGL_CMD_GETQUERYOBJECTIV, 2)
+SGL_COMMAND(SGL_CMD_GETQUERYOBJECTUIV, 2)
+SGL_COMMAND(SGL_CMD_BINDBUFFER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DELETEBUFFERS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GENBUFFERS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ISBUFFER, 1)
+SGL_COMMAND(SGL_CMD_BUFFERDATA, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_BUFFERSUBDATA, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETBUFFERSUBDATA, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MAPBUFFER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNMAPBUFFER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETBUFFERPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETBUFFERPOINTERV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_BLENDEQUATIONSEPARATE, 2)
+SGL_COMMAND(SGL_CMD_DRAWBUFFERS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_STENCILOPSEPARATE, 4)
+SGL_COMMAND(SGL_CMD_STENCILFUNCSEPARATE, 4)
+SGL_COMMAND(SGL_CMD_STENCILMASKSEPARATE, 2)
+SGL_COMMAND(SGL_CMD_ATTACHSHADER, 2)
+SGL_COMMAND(SGL_CMD_BINDATTRIBLOCATION, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COMPILESHADER, 1)
+SGL_COMMAND(SGL_CMD_CREATEPROGRAM, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CREATESHADER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DELETEPROGRAM, 1)
+SGL_COMMAND(SGL_CMD_DELETESHADER, 1)
+SGL_COMMAND(SGL_CMD_DETACHSHADER, 2)
+SGL_COMMAND(SGL_CMD_DISABLEVERTEXATTRIBARRAY, 1)
+SGL_COMMAND(SGL_CMD_ENABLEVERTEXATTRIBARRAY, 1)
+SGL_COMMAND(SGL_CMD_GETACTIVEATTRIB, 3)
+SGL_COMMAND(SGL_CMD_GETACTIVEUNIFORM, 3)
+SGL_COMMAND(SGL_CMD_GETATTACHEDSHADERS, 2)
+SGL_COMMAND(SGL_CMD_GETATTRIBLOCATION, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETPROGRAMIV, 2)
+SGL_COMMAND(SGL_CMD_GETPROGRAMINFOLOG, 2)
+SGL_COMMAND(SGL_CMD_GETSHADERIV, 2)
+SGL_COMMAND(SGL_CMD_GETSHADERINFOLOG, 2)
+SGL_COMMAND(SGL_CMD_GETSHADERSOURCE, 2)
+SGL_COMMAND(SGL_CMD_GETUNIFORMLOCATION, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETUNIFORMFV, 2)
+SGL_COMMAND(SGL_CMD_GETUNIFORMIV, 2)
+SGL_COMMAND(SGL_CMD_GETVERTEXATTRIBDV, 2)
+SGL_COMMAND(SGL_CMD_GETVERTEXATTRIBFV, 2)
+SGL_COMMAND(SGL_CMD_GETVERTEXATTRIBIV, 2)
+SGL_COMMAND(SGL_CMD_GETVERTEXATTRIBPOINTERV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ISPROGRAM, 1)
+SGL_COMMAND(SGL_CMD_ISSHADER, 1)
+SGL_COMMAND(SGL_CMD_LINKPROGRAM, 1)
+SGL_COMMAND(SGL_CMD_SHADERSOURCE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_USEPROGRAM, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM1F, 2)
+SGL_COMMAND(SGL_CMD_UNIFORM2F, 3)
+SGL_COMMAND(SGL_CMD_UNIFORM3F, 4)
+SGL_COMMAND(SGL_CMD_UNIFORM4F, 5)
+SGL_COMMAND(SGL_CMD_UNIFORM1I, 2)
+SGL_COMMAND(SGL_CMD_UNIFORM2I, 3)
+SGL_COMMAND(SGL_CMD_UNIFORM3I, 4)
+SGL_COMMAND(SGL_CMD_UNIFORM4I, 5)
+SGL_COMMAND(SGL_CMD_UNIFORM1FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM2FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM3FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM4FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM1IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM2IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM3IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM4IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX2FV, 3)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX3FV, 3)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX4FV, 3)
+SGL_COMMAND(SGL_CMD_VALIDATEPROGRAM, 1)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB1D, 2)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB1DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB1F, 2)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB1FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB1S, 2)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB1SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB2D, 3)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB2F, 3)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB2FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB2S, 3)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB2SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB3D, 4)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB3F, 4)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB3FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB3S, 4)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB3SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4NBV, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4NIV, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4NSV, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4NUB, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4NUBV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4NUIV, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4NUSV, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4BV, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4D, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4F, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4IV, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4S, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4UBV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4UIV, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIB4USV, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBPOINTER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX2X3FV, 3)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX3X2FV, 3)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX2X4FV, 3)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX4X2FV, 3)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX3X4FV, 3)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX4X3FV, 3)
+SGL_COMMAND(SGL_CMD_COLORMASKI, 5)
+SGL_COMMAND(SGL_CMD_GETBOOLEANI_V, 2)
+SGL_COMMAND(SGL_CMD_GETINTEGERI_V, 2)
+SGL_COMMAND(SGL_CMD_ENABLEI, 2)
+SGL_COMMAND(SGL_CMD_DISABLEI, 2)
+SGL_COMMAND(SGL_CMD_ISENABLEDI, 2)
+SGL_COMMAND(SGL_CMD_BEGINTRANSFORMFEEDBACK, 1)
+SGL_COMMAND(SGL_CMD_ENDTRANSFORMFEEDBACK, 0)
+SGL_COMMAND(SGL_CMD_BINDBUFFERRANGE, 5)
+SGL_COMMAND(SGL_CMD_BINDBUFFERBASE, 3)
+SGL_COMMAND(SGL_CMD_TRANSFORMFEEDBACKVARYINGS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETTRANSFORMFEEDBACKVARYING, 3)
+SGL_COMMAND(SGL_CMD_CLAMPCOLOR, 2)
+SGL_COMMAND(SGL_CMD_BEGINCONDITIONALRENDER, 2)
+SGL_COMMAND(SGL_CMD_ENDCONDITIONALRENDER, 0)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBIPOINTER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETVERTEXATTRIBIIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETVERTEXATTRIBIUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI1I, 2)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI2I, 3)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI3I, 4)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI4I, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI1UI, 2)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI2UI, 3)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI3UI, 4)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI4UI, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI1IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI2IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI3IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI4IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI1UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI2UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI3UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI4UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI4BV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI4SV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI4UBV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBI4USV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETUNIFORMUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_BINDFRAGDATALOCATION, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETFRAGDATALOCATION, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM1UI, 2)
+SGL_COMMAND(SGL_CMD_UNIFORM2UI, 3)
+SGL_COMMAND(SGL_CMD_UNIFORM3UI, 4)
+SGL_COMMAND(SGL_CMD_UNIFORM4UI, 5)
+SGL_COMMAND(SGL_CMD_UNIFORM1UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM2UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM3UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM4UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXPARAMETERIIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXPARAMETERIUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETTEXPARAMETERIIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETTEXPARAMETERIUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLEARBUFFERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLEARBUFFERUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLEARBUFFERFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLEARBUFFERFI, 4)
+SGL_COMMAND(SGL_CMD_GETSTRINGI, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ISRENDERBUFFER, 1)
+SGL_COMMAND(SGL_CMD_BINDRENDERBUFFER, 2)
+SGL_COMMAND(SGL_CMD_DELETERENDERBUFFERS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GENRENDERBUFFERS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_RENDERBUFFERSTORAGE, 4)
+SGL_COMMAND(SGL_CMD_GETRENDERBUFFERPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ISFRAMEBUFFER, 1)
+SGL_COMMAND(SGL_CMD_BINDFRAMEBUFFER, 2)
+SGL_COMMAND(SGL_CMD_DELETEFRAMEBUFFERS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GENFRAMEBUFFERS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CHECKFRAMEBUFFERSTATUS, 1)
+SGL_COMMAND(SGL_CMD_FRAMEBUFFERTEXTURE1D, 5)
+SGL_COMMAND(SGL_CMD_FRAMEBUFFERTEXTURE2D, 5)
+SGL_COMMAND(SGL_CMD_FRAMEBUFFERTEXTURE3D, 6)
+SGL_COMMAND(SGL_CMD_FRAMEBUFFERRENDERBUFFER, 4)
+SGL_COMMAND(SGL_CMD_GETFRAMEBUFFERATTACHMENTPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GENERATEMIPMAP, 1)
+SGL_COMMAND(SGL_CMD_BLITFRAMEBUFFER, 10)
+SGL_COMMAND(SGL_CMD_RENDERBUFFERSTORAGEMULTISAMPLE, 5)
+SGL_COMMAND(SGL_CMD_FRAMEBUFFERTEXTURELAYER, 5)
+SGL_COMMAND(SGL_CMD_MAPBUFFERRANGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_FLUSHMAPPEDBUFFERRANGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_BINDVERTEXARRAY, 1)
+SGL_COMMAND(SGL_CMD_DELETEVERTEXARRAYS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GENVERTEXARRAYS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ISVERTEXARRAY, 1)
+SGL_COMMAND(SGL_CMD_DRAWARRAYSINSTANCED, 4)
+SGL_COMMAND(SGL_CMD_DRAWELEMENTSINSTANCED, 7)
+SGL_COMMAND(SGL_CMD_TEXBUFFER, 3)
+SGL_COMMAND(SGL_CMD_PRIMITIVERESTARTINDEX, 1)
+SGL_COMMAND(SGL_CMD_COPYBUFFERSUBDATA, 5)
+SGL_COMMAND(SGL_CMD_GETUNIFORMINDICES, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETACTIVEUNIFORMSIV, 3)
+SGL_COMMAND(SGL_CMD_GETACTIVEUNIFORMNAME, 3)
+SGL_COMMAND(SGL_CMD_GETUNIFORMBLOCKINDEX, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETACTIVEUNIFORMBLOCKIV, 3)
+SGL_COMMAND(SGL_CMD_GETACTIVEUNIFORMBLOCKNAME, 3)
+SGL_COMMAND(SGL_CMD_UNIFORMBLOCKBINDING, 3)
+SGL_COMMAND(SGL_CMD_DRAWELEMENTSBASEVERTEX, 7)
+SGL_COMMAND(SGL_CMD_DRAWRANGEELEMENTSBASEVERTEX, 9)
+SGL_COMMAND(SGL_CMD_DRAWELEMENTSINSTANCEDBASEVERTEX, 8)
+SGL_COMMAND(SGL_CMD_MULTIDRAWELEMENTSBASEVERTEX, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROVOKINGVERTEX, 1)
+SGL_COMMAND(SGL_CMD_FENCESYNC, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ISSYNC, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DELETESYNC, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLIENTWAITSYNC, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_WAITSYNC, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETINTEGER64V, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETSYNCIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETINTEGER64I_V, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETBUFFERPARAMETERI64V, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_FRAMEBUFFERTEXTURE, 4)
+SGL_COMMAND(SGL_CMD_TEXIMAGE2DMULTISAMPLE, 6)
+SGL_COMMAND(SGL_CMD_TEXIMAGE3DMULTISAMPLE, 7)
+SGL_COMMAND(SGL_CMD_GETMULTISAMPLEFV, 2)
+SGL_COMMAND(SGL_CMD_SAMPLEMASKI, 2)
+SGL_COMMAND(SGL_CMD_BINDFRAGDATALOCATIONINDEXED, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETFRAGDATAINDEX, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GENSAMPLERS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DELETESAMPLERS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ISSAMPLER, 1)
+SGL_COMMAND(SGL_CMD_BINDSAMPLER, 2)
+SGL_COMMAND(SGL_CMD_SAMPLERPARAMETERI, 3)
+SGL_COMMAND(SGL_CMD_SAMPLERPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SAMPLERPARAMETERF, 3)
+SGL_COMMAND(SGL_CMD_SAMPLERPARAMETERFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SAMPLERPARAMETERIIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SAMPLERPARAMETERIUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETSAMPLERPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETSAMPLERPARAMETERIIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETSAMPLERPARAMETERFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETSAMPLERPARAMETERIUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_QUERYCOUNTER, 2)
+SGL_COMMAND(SGL_CMD_GETQUERYOBJECTI64V, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETQUERYOBJECTUI64V, 2)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBDIVISOR, 2)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBP1UI, 4)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBP1UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBP2UI, 4)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBP2UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBP3UI, 4)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBP3UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBP4UI, 4)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBP4UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXP2UI, 2)
+SGL_COMMAND(SGL_CMD_VERTEXP2UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXP3UI, 2)
+SGL_COMMAND(SGL_CMD_VERTEXP3UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXP4UI, 2)
+SGL_COMMAND(SGL_CMD_VERTEXP4UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORDP1UI, 2)
+SGL_COMMAND(SGL_CMD_TEXCOORDP1UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORDP2UI, 2)
+SGL_COMMAND(SGL_CMD_TEXCOORDP2UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORDP3UI, 2)
+SGL_COMMAND(SGL_CMD_TEXCOORDP3UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXCOORDP4UI, 2)
+SGL_COMMAND(SGL_CMD_TEXCOORDP4UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORDP1UI, 3)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORDP1UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORDP2UI, 3)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORDP2UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORDP3UI, 3)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORDP3UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORDP4UI, 3)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORDP4UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_NORMALP3UI, 2)
+SGL_COMMAND(SGL_CMD_NORMALP3UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLORP3UI, 2)
+SGL_COMMAND(SGL_CMD_COLORP3UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLORP4UI, 2)
+SGL_COMMAND(SGL_CMD_COLORP4UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLORP3UI, 2)
+SGL_COMMAND(SGL_CMD_SECONDARYCOLORP3UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MINSAMPLESHADING, 1)
+SGL_COMMAND(SGL_CMD_BLENDEQUATIONI, 2)
+SGL_COMMAND(SGL_CMD_BLENDEQUATIONSEPARATEI, 3)
+SGL_COMMAND(SGL_CMD_BLENDFUNCI, 3)
+SGL_COMMAND(SGL_CMD_BLENDFUNCSEPARATEI, 5)
+SGL_COMMAND(SGL_CMD_DRAWARRAYSINDIRECT, 3)
+SGL_COMMAND(SGL_CMD_DRAWELEMENTSINDIRECT, 4)
+SGL_COMMAND(SGL_CMD_UNIFORM1D, 2)
+SGL_COMMAND(SGL_CMD_UNIFORM2D, 3)
+SGL_COMMAND(SGL_CMD_UNIFORM3D, 4)
+SGL_COMMAND(SGL_CMD_UNIFORM4D, 5)
+SGL_COMMAND(SGL_CMD_UNIFORM1DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX2X3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX2X4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX3X2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX3X4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX4X2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORMMATRIX4X3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETUNIFORMDV, 2)
+SGL_COMMAND(SGL_CMD_GETSUBROUTINEUNIFORMLOCATION, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETSUBROUTINEINDEX, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETACTIVESUBROUTINEUNIFORMIV, 4)
+SGL_COMMAND(SGL_CMD_GETACTIVESUBROUTINEUNIFORMNAME, 4)
+SGL_COMMAND(SGL_CMD_GETACTIVESUBROUTINENAME, 4)
+SGL_COMMAND(SGL_CMD_UNIFORMSUBROUTINESUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETUNIFORMSUBROUTINEUIV, 2)
+SGL_COMMAND(SGL_CMD_GETPROGRAMSTAGEIV, 3)
+SGL_COMMAND(SGL_CMD_PATCHPARAMETERI, 2)
+SGL_COMMAND(SGL_CMD_PATCHPARAMETERFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_BINDTRANSFORMFEEDBACK, 2)
+SGL_COMMAND(SGL_CMD_DELETETRANSFORMFEEDBACKS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GENTRANSFORMFEEDBACKS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ISTRANSFORMFEEDBACK, 1)
+SGL_COMMAND(SGL_CMD_PAUSETRANSFORMFEEDBACK, 0)
+SGL_COMMAND(SGL_CMD_RESUMETRANSFORMFEEDBACK, 0)
+SGL_COMMAND(SGL_CMD_DRAWTRANSFORMFEEDBACK, 2)
+SGL_COMMAND(SGL_CMD_DRAWTRANSFORMFEEDBACKSTREAM, 3)
+SGL_COMMAND(SGL_CMD_BEGINQUERYINDEXED, 3)
+SGL_COMMAND(SGL_CMD_ENDQUERYINDEXED, 2)
+SGL_COMMAND(SGL_CMD_GETQUERYINDEXEDIV, 3)
+SGL_COMMAND(SGL_CMD_RELEASESHADERCOMPILER, 0)
+SGL_COMMAND(SGL_CMD_SHADERBINARY, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETSHADERPRECISIONFORMAT, 4)
+SGL_COMMAND(SGL_CMD_DEPTHRANGEF, 2)
+SGL_COMMAND(SGL_CMD_CLEARDEPTHF, 1)
+SGL_COMMAND(SGL_CMD_GETPROGRAMBINARY, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMBINARY, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMPARAMETERI, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_USEPROGRAMSTAGES, 3)
+SGL_COMMAND(SGL_CMD_ACTIVESHADERPROGRAM, 2)
+SGL_COMMAND(SGL_CMD_CREATESHADERPROGRAMV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_BINDPROGRAMPIPELINE, 1)
+SGL_COMMAND(SGL_CMD_DELETEPROGRAMPIPELINES, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GENPROGRAMPIPELINES, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_ISPROGRAMPIPELINE, 1)
+SGL_COMMAND(SGL_CMD_GETPROGRAMPIPELINEIV, 2)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM1I, 3)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM1IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM1F, 3)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM1FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM1D, 3)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM1DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM1UI, 3)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM1UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM2I, 4)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM2IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM2F, 4)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM2FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM2D, 4)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM2UI, 4)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM2UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM3I, 5)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM3IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM3F, 5)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM3FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM3D, 5)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM3UI, 5)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM3UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM4I, 6)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM4IV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM4F, 6)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM4FV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM4D, 6)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM4UI, 6)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORM4UIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX2FV, 4)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX3FV, 4)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX4FV, 4)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX2X3FV, 4)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX3X2FV, 4)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX2X4FV, 4)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX4X2FV, 4)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX3X4FV, 4)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX4X3FV, 4)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX2X3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX3X2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX2X4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX4X2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX3X4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMUNIFORMMATRIX4X3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VALIDATEPROGRAMPIPELINE, 1)
+SGL_COMMAND(SGL_CMD_GETPROGRAMPIPELINEINFOLOG, 2)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBL1D, 2)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBL2D, 3)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBL3D, 4)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBL4D, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBL1DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBL2DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBL3DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBL4DV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBLPOINTER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETVERTEXATTRIBLDV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VIEWPORTARRAYV, 2)
+SGL_COMMAND(SGL_CMD_VIEWPORTINDEXEDF, 5)
+SGL_COMMAND(SGL_CMD_VIEWPORTINDEXEDFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SCISSORARRAYV, 2)
+SGL_COMMAND(SGL_CMD_SCISSORINDEXED, 5)
+SGL_COMMAND(SGL_CMD_SCISSORINDEXEDV, 1)
+SGL_COMMAND(SGL_CMD_DEPTHRANGEARRAYV, 2)
+SGL_COMMAND(SGL_CMD_DEPTHRANGEINDEXED, 1)
+SGL_COMMAND(SGL_CMD_GETFLOATI_V, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETDOUBLEI_V, 2)
+SGL_COMMAND(SGL_CMD_DRAWARRAYSINSTANCEDBASEINSTANCE, 5)
+SGL_COMMAND(SGL_CMD_DRAWELEMENTSINSTANCEDBASEINSTANCE, 8)
+SGL_COMMAND(SGL_CMD_DRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCE, 9)
+SGL_COMMAND(SGL_CMD_GETINTERNALFORMATIV, 4)
+SGL_COMMAND(SGL_CMD_GETACTIVEATOMICCOUNTERBUFFERIV, 3)
+SGL_COMMAND(SGL_CMD_BINDIMAGETEXTURE, 7)
+SGL_COMMAND(SGL_CMD_MEMORYBARRIER, 1)
+SGL_COMMAND(SGL_CMD_TEXSTORAGE1D, 4)
+SGL_COMMAND(SGL_CMD_TEXSTORAGE2D, 5)
+SGL_COMMAND(SGL_CMD_TEXSTORAGE3D, 6)
+SGL_COMMAND(SGL_CMD_DRAWTRANSFORMFEEDBACKINSTANCED, 3)
+SGL_COMMAND(SGL_CMD_DRAWTRANSFORMFEEDBACKSTREAMINSTANCED, 4)
+SGL_COMMAND(SGL_CMD_CLEARBUFFERDATA, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLEARBUFFERSUBDATA, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DISPATCHCOMPUTE, 3)
+SGL_COMMAND(SGL_CMD_DISPATCHCOMPUTEINDIRECT, 1)
+SGL_COMMAND(SGL_CMD_COPYIMAGESUBDATA, 15)
+SGL_COMMAND(SGL_CMD_FRAMEBUFFERPARAMETERI, 3)
+SGL_COMMAND(SGL_CMD_GETFRAMEBUFFERPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETINTERNALFORMATI64V, 4)
+SGL_COMMAND(SGL_CMD_INVALIDATETEXSUBIMAGE, 8)
+SGL_COMMAND(SGL_CMD_INVALIDATETEXIMAGE, 2)
+SGL_COMMAND(SGL_CMD_INVALIDATEBUFFERSUBDATA, 3)
+SGL_COMMAND(SGL_CMD_INVALIDATEBUFFERDATA, 1)
+SGL_COMMAND(SGL_CMD_INVALIDATEFRAMEBUFFER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_INVALIDATESUBFRAMEBUFFER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTIDRAWARRAYSINDIRECT, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTIDRAWELEMENTSINDIRECT, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETPROGRAMINTERFACEIV, 3)
+SGL_COMMAND(SGL_CMD_GETPROGRAMRESOURCEINDEX, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETPROGRAMRESOURCENAME, 4)
+SGL_COMMAND(SGL_CMD_GETPROGRAMRESOURCEIV, 5)
+SGL_COMMAND(SGL_CMD_GETPROGRAMRESOURCELOCATION, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETPROGRAMRESOURCELOCATIONINDEX, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SHADERSTORAGEBLOCKBINDING, 3)
+SGL_COMMAND(SGL_CMD_TEXBUFFERRANGE, 5)
+SGL_COMMAND(SGL_CMD_TEXSTORAGE2DMULTISAMPLE, 6)
+SGL_COMMAND(SGL_CMD_TEXSTORAGE3DMULTISAMPLE, 7)
+SGL_COMMAND(SGL_CMD_TEXTUREVIEW, 8)
+SGL_COMMAND(SGL_CMD_BINDVERTEXBUFFER, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBFORMAT, 5)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBIFORMAT, 4)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBLFORMAT, 4)
+SGL_COMMAND(SGL_CMD_VERTEXATTRIBBINDING, 2)
+SGL_COMMAND(SGL_CMD_VERTEXBINDINGDIVISOR, 2)
+SGL_COMMAND(SGL_CMD_DEBUGMESSAGECONTROL, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DEBUGMESSAGEINSERT, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DEBUGMESSAGECALLBACK, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETDEBUGMESSAGELOG, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PUSHDEBUGGROUP, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_POPDEBUGGROUP, 0)
+SGL_COMMAND(SGL_CMD_OBJECTLABEL, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETOBJECTLABEL, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_OBJECTPTRLABEL, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETOBJECTPTRLABEL, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_BUFFERSTORAGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLEARTEXIMAGE, 5)
+SGL_COMMAND(SGL_CMD_CLEARTEXSUBIMAGE, 11)
+SGL_COMMAND(SGL_CMD_BINDBUFFERSBASE, 3)
+SGL_COMMAND(SGL_CMD_BINDBUFFERSRANGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_BINDTEXTURES, 2)
+SGL_COMMAND(SGL_CMD_BINDSAMPLERS, 2)
+SGL_COMMAND(SGL_CMD_BINDIMAGETEXTURES, 2)
+SGL_COMMAND(SGL_CMD_BINDVERTEXBUFFERS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLIPCONTROL, 2)
+SGL_COMMAND(SGL_CMD_CREATETRANSFORMFEEDBACKS, 0)
+SGL_COMMAND(SGL_CMD_TRANSFORMFEEDBACKBUFFERBASE, 3)
+SGL_COMMAND(SGL_CMD_TRANSFORMFEEDBACKBUFFERRANGE, 5)
+SGL_COMMAND(SGL_CMD_GETTRANSFORMFEEDBACKIV, 2)
+SGL_COMMAND(SGL_CMD_GETTRANSFORMFEEDBACKI_V, 3)
+SGL_COMMAND(SGL_CMD_GETTRANSFORMFEEDBACKI64_V, 3)
+SGL_COMMAND(SGL_CMD_CREATEBUFFERS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_NAMEDBUFFERSTORAGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_NAMEDBUFFERDATA, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_NAMEDBUFFERSUBDATA, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COPYNAMEDBUFFERSUBDATA, 5)
+SGL_COMMAND(SGL_CMD_CLEARNAMEDBUFFERDATA, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLEARNAMEDBUFFERSUBDATA, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MAPNAMEDBUFFER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MAPNAMEDBUFFERRANGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNMAPNAMEDBUFFER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_FLUSHMAPPEDNAMEDBUFFERRANGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNAMEDBUFFERPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNAMEDBUFFERPARAMETERI64V, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNAMEDBUFFERPOINTERV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNAMEDBUFFERSUBDATA, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CREATEFRAMEBUFFERS, 0)
+SGL_COMMAND(SGL_CMD_NAMEDFRAMEBUFFERRENDERBUFFER, 4)
+SGL_COMMAND(SGL_CMD_NAMEDFRAMEBUFFERPARAMETERI, 3)
+SGL_COMMAND(SGL_CMD_NAMEDFRAMEBUFFERTEXTURE, 4)
+SGL_COMMAND(SGL_CMD_NAMEDFRAMEBUFFERTEXTURELAYER, 5)
+SGL_COMMAND(SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFER, 2)
+SGL_COMMAND(SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFERS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_NAMEDFRAMEBUFFERREADBUFFER, 2)
+SGL_COMMAND(SGL_CMD_INVALIDATENAMEDFRAMEBUFFERDATA, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_INVALIDATENAMEDFRAMEBUFFERSUBDATA, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLEARNAMEDFRAMEBUFFERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLEARNAMEDFRAMEBUFFERUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLEARNAMEDFRAMEBUFFERFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CLEARNAMEDFRAMEBUFFERFI, 5)
+SGL_COMMAND(SGL_CMD_BLITNAMEDFRAMEBUFFER, 12)
+SGL_COMMAND(SGL_CMD_CHECKNAMEDFRAMEBUFFERSTATUS, 2)
+SGL_COMMAND(SGL_CMD_GETNAMEDFRAMEBUFFERPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CREATERENDERBUFFERS, 0)
+SGL_COMMAND(SGL_CMD_NAMEDRENDERBUFFERSTORAGE, 4)
+SGL_COMMAND(SGL_CMD_NAMEDRENDERBUFFERSTORAGEMULTISAMPLE, 5)
+SGL_COMMAND(SGL_CMD_GETNAMEDRENDERBUFFERPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CREATETEXTURES, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXTUREBUFFER, 3)
+SGL_COMMAND(SGL_CMD_TEXTUREBUFFERRANGE, 5)
+SGL_COMMAND(SGL_CMD_TEXTURESTORAGE1D, 4)
+SGL_COMMAND(SGL_CMD_TEXTURESTORAGE2D, 5)
+SGL_COMMAND(SGL_CMD_TEXTURESTORAGE3D, 6)
+SGL_COMMAND(SGL_CMD_TEXTURESTORAGE2DMULTISAMPLE, 6)
+SGL_COMMAND(SGL_CMD_TEXTURESTORAGE3DMULTISAMPLE, 7)
+SGL_COMMAND(SGL_CMD_TEXTURESUBIMAGE1D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXTURESUBIMAGE2D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXTURESUBIMAGE3D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COMPRESSEDTEXTURESUBIMAGE1D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COMPRESSEDTEXTURESUBIMAGE2D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COMPRESSEDTEXTURESUBIMAGE3D, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COPYTEXTURESUBIMAGE1D, 6)
+SGL_COMMAND(SGL_CMD_COPYTEXTURESUBIMAGE2D, 8)
+SGL_COMMAND(SGL_CMD_COPYTEXTURESUBIMAGE3D, 9)
+SGL_COMMAND(SGL_CMD_TEXTUREPARAMETERF, 3)
+SGL_COMMAND(SGL_CMD_TEXTUREPARAMETERFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXTUREPARAMETERI, 3)
+SGL_COMMAND(SGL_CMD_TEXTUREPARAMETERIIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXTUREPARAMETERIUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXTUREPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GENERATETEXTUREMIPMAP, 1)
+SGL_COMMAND(SGL_CMD_BINDTEXTUREUNIT, 2)
+SGL_COMMAND(SGL_CMD_GETTEXTUREIMAGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETCOMPRESSEDTEXTUREIMAGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETTEXTURELEVELPARAMETERFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETTEXTURELEVELPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETTEXTUREPARAMETERFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETTEXTUREPARAMETERIIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETTEXTUREPARAMETERIUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETTEXTUREPARAMETERIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CREATEVERTEXARRAYS, 0)
+SGL_COMMAND(SGL_CMD_DISABLEVERTEXARRAYATTRIB, 2)
+SGL_COMMAND(SGL_CMD_ENABLEVERTEXARRAYATTRIB, 2)
+SGL_COMMAND(SGL_CMD_VERTEXARRAYELEMENTBUFFER, 2)
+SGL_COMMAND(SGL_CMD_VERTEXARRAYVERTEXBUFFER, 6)
+SGL_COMMAND(SGL_CMD_VERTEXARRAYVERTEXBUFFERS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_VERTEXARRAYATTRIBBINDING, 3)
+SGL_COMMAND(SGL_CMD_VERTEXARRAYATTRIBFORMAT, 6)
+SGL_COMMAND(SGL_CMD_VERTEXARRAYATTRIBIFORMAT, 5)
+SGL_COMMAND(SGL_CMD_VERTEXARRAYATTRIBLFORMAT, 5)
+SGL_COMMAND(SGL_CMD_VERTEXARRAYBINDINGDIVISOR, 3)
+SGL_COMMAND(SGL_CMD_GETVERTEXARRAYIV, 2)
+SGL_COMMAND(SGL_CMD_GETVERTEXARRAYINDEXEDIV, 3)
+SGL_COMMAND(SGL_CMD_GETVERTEXARRAYINDEXED64IV, 3)
+SGL_COMMAND(SGL_CMD_CREATESAMPLERS, 0)
+SGL_COMMAND(SGL_CMD_CREATEPROGRAMPIPELINES, 0)
+SGL_COMMAND(SGL_CMD_CREATEQUERIES, 1)
+SGL_COMMAND(SGL_CMD_GETQUERYBUFFEROBJECTI64V, 4)
+SGL_COMMAND(SGL_CMD_GETQUERYBUFFEROBJECTIV, 4)
+SGL_COMMAND(SGL_CMD_GETQUERYBUFFEROBJECTUI64V, 4)
+SGL_COMMAND(SGL_CMD_GETQUERYBUFFEROBJECTUIV, 4)
+SGL_COMMAND(SGL_CMD_MEMORYBARRIERBYREGION, 1)
+SGL_COMMAND(SGL_CMD_GETTEXTURESUBIMAGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETCOMPRESSEDTEXTURESUBIMAGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETGRAPHICSRESETSTATUS, 0)
+SGL_COMMAND(SGL_CMD_GETNCOMPRESSEDTEXIMAGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNTEXIMAGE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNUNIFORMDV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNUNIFORMFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNUNIFORMIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNUNIFORMUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_READNPIXELS, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNMAPDV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNMAPFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNMAPIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNPIXELMAPFV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNPIXELMAPUIV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNPIXELMAPUSV, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNPOLYGONSTIPPLE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNCOLORTABLE, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNCONVOLUTIONFILTER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNSEPARABLEFILTER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNHISTOGRAM, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETNMINMAX, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_TEXTUREBARRIER, 0)
+SGL_COMMAND(SGL_CMD_SPECIALIZESHADER, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTIDRAWARRAYSINDIRECTCOUNT, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_MULTIDRAWELEMENTSINDIRECTCOUNT, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_POLYGONOFFSETCLAMP, 3)
+
+SGL_COMMAND(SGL_CMD_GETOBJECTPARAMETERIVARB, 2)
+SGL_COMMAND(SGL_CMD_ATTACHOBJECTARB, 2)
+SGL_COMMAND(SGL_CMD_BINDATTRIBLOCATIONARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_BINDBUFFERARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_BINDPROGRAMARB, 2)
+SGL_COMMAND(SGL_CMD_BUFFERDATAARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COMPILESHADERARB, 1)
+SGL_COMMAND(SGL_CMD_CREATEPROGRAMOBJECTARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_CREATESHADEROBJECTARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DELETEBUFFERSARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DELETEOBJECTARB, 1)
+SGL_COMMAND(SGL_CMD_DELETEPROGRAMSARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DELETEQUERIESARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_DETACHOBJECTARB, 2)
+SGL_COMMAND(SGL_CMD_GENBUFFERSARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GENPROGRAMSARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GENQUERIESARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_GETINFOLOGARB, 2)
+SGL_COMMAND(SGL_CMD_GETPROGRAMIVARB, 2)
+SGL_COMMAND(SGL_CMD_GETUNIFORMLOCATIONARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_LINKPROGRAMARB, 1)
+SGL_COMMAND(SGL_CMD_MAPBUFFERARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_PROGRAMSTRINGARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_SHADERSOURCEARB, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_UNIFORM1IARB, 2)
+SGL_COMMAND(SGL_CMD_PROGRAMENVPARAMETERS4FVEXT, SGL_CMD_VARIABLE_LENGTH)
+SGL_COMMAND(SGL_CMD_COLORMASKINDEXEDEXT, 5)
+SGL_COMMAND(SGL_CMD_ENABLEINDEXEDEXT, 2)
+SGL_COMMAND(SGL_CMD_DISABLEINDEXEDEXT, 2)
+SGL_COMMAND(SGL_CMD_GETBOOLEANINDEXEDVEXT, 2)
+SGL_COMMAND(SGL_CMD_ACTIVETEXTUREARB, 1)
+SGL_COMMAND(SGL_CMD_MULTITEXCOORD2FARB, 3)
+SGL_COMMAND(SGL_CMD_BUFFERSUBDATAARB, SGL_CMD_VARIABLE_LENGTH)
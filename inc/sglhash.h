@@ -0,0 +1,204 @@
+#ifndef _SGLHASH_H_
+#define _SGLHASH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define SGL_HASH_PRIME_1 0x9E3779B185EBCA87ULL
+#define SGL_HASH_PRIME_2 0xC2B2AE3D27D4EB4FULL
+#define SGL_HASH_PRIME_3 0x165667B19E3779F9ULL
+
+static inline uint64_t sgl_hash_rotl(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t sgl_hash_round(uint64_t acc, uint64_t word)
+{
+    return sgl_hash_rotl(acc + word * SGL_HASH_PRIME_2, 31) * SGL_HASH_PRIME_1;
+}
+
+/*
+ * fingerprint of a block of memory; four independent lanes over 32
+ * byte stripes keep it close to memory speed. client and server must
+ * agree on it, the server checks the hashes clients send
+ */
+static inline uint64_t sgl_hash(const void *data, size_t size, uint64_t seed)
+{
+    const unsigned char *p = data, *end = p + size;
+    uint64_t lanes[4] = { seed + SGL_HASH_PRIME_1 + SGL_HASH_PRIME_2, seed + SGL_HASH_PRIME_2, seed, seed - SGL_HASH_PRIME_1 };
+    uint64_t word, hash;
+
+    for (; end - p >= 32; p += 32) {
+        for (int i = 0; i < 4; i++) {
+            memcpy(&word, p + i * sizeof(word), sizeof(word));
+            lanes[i] = sgl_hash_round(lanes[i], word);
+        }
+    }
+
+    hash = sgl_hash_rotl(lanes[0], 1) + sgl_hash_rotl(lanes[1], 7) +
+           sgl_hash_rotl(lanes[2], 12) + sgl_hash_rotl(lanes[3], 18) + size;
+
+    for (; end - p >= 8; p += 8) {
+        memcpy(&word, p, sizeof(word));
+        hash = sgl_hash_rotl(hash ^ sgl_hash_round(0, word), 27) * SGL_HASH_PRIME_1 + SGL_HASH_PRIME_3;
+    }
+    for (; p < end; p++)
+        hash = sgl_hash_rotl(hash ^ (*p * SGL_HASH_PRIME_3), 11) * SGL_HASH_PRIME_1;
+
+    hash ^= hash >> 33;
+    hash *= SGL_HASH_PRIME_2;
+    hash ^= hash >> 29;
+    hash *= SGL_HASH_PRIME_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+/*
+ * sha-256, for keys of anything shared between clients or kept on
+ * disk, where a collision someone could craft would hand one client
+ * another's data; sgl_hash is only for a client's own bookkeeping
+ */
+struct sgl_sha256 {
+    uint32_t state[8];
+    uint64_t length;
+    unsigned char block[64];
+};
+
+#define SGL_SHA256_SIZE 32
+
+static inline uint32_t sgl_sha256_rotr(uint32_t x, int r)
+{
+    return (x >> r) | (x << (32 - r));
+}
+
+static inline void sgl_sha256_init(struct sgl_sha256 *sha)
+{
+    static const uint32_t initial[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+
+    memcpy(sha->state, initial, sizeof(initial));
+    sha->length = 0;
+}
+
+static inline void sgl_sha256_block(struct sgl_sha256 *sha, const unsigned char *block)
+{
+    static const uint32_t k[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+    uint32_t w[64], v[8];
+
+    for (int i = 0; i < 16; i++)
+        w[i] = (uint32_t)block[i * 4] << 24 | (uint32_t)block[i * 4 + 1] << 16 |
+               (uint32_t)block[i * 4 + 2] << 8 | (uint32_t)block[i * 4 + 3];
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = sgl_sha256_rotr(w[i - 15], 7) ^ sgl_sha256_rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = sgl_sha256_rotr(w[i - 2], 17) ^ sgl_sha256_rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    memcpy(v, sha->state, sizeof(v));
+    for (int i = 0; i < 64; i++) {
+        uint32_t s1 = sgl_sha256_rotr(v[4], 6) ^ sgl_sha256_rotr(v[4], 11) ^ sgl_sha256_rotr(v[4], 25);
+        uint32_t ch = (v[4] & v[5]) ^ (~v[4] & v[6]);
+        uint32_t t1 = v[7] + s1 + ch + k[i] + w[i];
+        uint32_t s0 = sgl_sha256_rotr(v[0], 2) ^ sgl_sha256_rotr(v[0], 13) ^ sgl_sha256_rotr(v[0], 22);
+        uint32_t maj = (v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]);
+
+        memmove(v + 1, v, 7 * sizeof(*v));
+        v[4] += t1;
+        v[0] = t1 + s0 + maj;
+    }
+
+    for (int i = 0; i < 8; i++)
+        sha->state[i] += v[i];
+}
+
+static inline void sgl_sha256_update(struct sgl_sha256 *sha, const void *data, size_t size)
+{
+    const unsigned char *p = data;
+    size_t used = sha->length % 64;
+
+    sha->length += size;
+
+    if (used != 0) {
+        size_t take = size < 64 - used ? size : 64 - used;
+        memcpy(sha->block + used, p, take);
+        p += take;
+        size -= take;
+        if (used + take < 64)
+            return;
+        sgl_sha256_block(sha, sha->block);
+    }
+
+    for (; size >= 64; p += 64, size -= 64)
+        sgl_sha256_block(sha, p);
+
+    memcpy(sha->block, p, size);
+}
+
+static inline void sgl_sha256_final(struct sgl_sha256 *sha, void *digest)
+{
+    uint64_t bits = sha->length * 8;
+    unsigned char pad[72] = { 0x80 }, *out = digest;
+    size_t pad_length = (sha->length % 64 < 56 ? 56 : 120) - sha->length % 64;
+
+    for (int i = 0; i < 8; i++)
+        pad[pad_length + i] = (unsigned char)(bits >> (56 - i * 8));
+    sgl_sha256_update(sha, pad, pad_length + 8);
+
+    for (int i = 0; i < 8; i++) {
+        out[i * 4] = (unsigned char)(sha->state[i] >> 24);
+        out[i * 4 + 1] = (unsigned char)(sha->state[i] >> 16);
+        out[i * 4 + 2] = (unsigned char)(sha->state[i] >> 8);
+        out[i * 4 + 3] = (unsigned char)sha->state[i];
+    }
+}
+
+/*
+ * hex for naming files after a digest, `string` holds 65 chars
+ */
+static inline void sgl_digest_string(char *string, const void *digest)
+{
+    static const char hex[] = "0123456789abcdef";
+    const unsigned char *bytes = digest;
+
+    for (int i = 0; i < SGL_SHA256_SIZE; i++) {
+        string[i * 2] = hex[bytes[i] >> 4];
+        string[i * 2 + 1] = hex[bytes[i] & 15];
+    }
+    string[2 * SGL_SHA256_SIZE] = 0;
+}
+
+/*
+ * names a blob by content: its sha-256, and its length
+ */
+struct sgl_blob_key {
+    uint64_t hash[4];
+    uint64_t size;
+};
+
+#define SGL_BLOB_KEY_WORDS (sizeof(struct sgl_blob_key) / sizeof(int))
+
+static inline struct sgl_blob_key sgl_blob_key_of(const void *data, size_t size)
+{
+    struct sgl_blob_key key;
+    struct sgl_sha256 sha;
+
+    sgl_sha256_init(&sha);
+    sgl_sha256_update(&sha, data, size);
+    sgl_sha256_final(&sha, key.hash);
+    key.size = size;
+    return key;
+}
+
+#endif
@@ -11,6 +11,7 @@
 #include <client/platform/icd.h>
 
 #include <sharedgl.h>
+#include <sglhash.h>
 #include <commongl.h>
 #include <lzav.h>
 
@@ -28,6 +29,7 @@
 #define GLIMPL_MAX_OBJECTS 256
 #define GLIMPL_MAX_TEXTURES 8
 #define GLIMPL_MAX_COUNT_FOR_MATRIX_OP 256 // MSVC doesn't support VLAs
+#define GLIMPL_ARRAY_COUNT(a) (sizeof(a) / sizeof((a)[0]))
 
 // used by glGet*v
 #define GL_GET_MEMCPY_RETVAL_EX(name, data, type) \
@@ -168,6 +170,7 @@ float                               glimpl_global_matrix_double_to_float[GLIMPL_
 
 static GLuint                       glimpl_array_buffer_binding = 0;
 static GLuint                       glimpl_draw_indirect_buffer_binding = 0;
+static GLuint                       glimpl_pixel_pack_buffer_binding = 0;
 static GLuint                       glimpl_current_vertex_array = 0;
 static struct gl_vertex_array_binding_state glimpl_vertex_array_bindings[GLIMPL_MAX_OBJECTS] = {
     { .name = 0, .element_array_buffer = 0, .in_use = true }
@@ -318,6 +321,8 @@ static bool glimpl_extensions_full_ready = false;
 static ENetHost *client = NULL;
 static ENetPeer *peer = NULL;
 static int *fake_register_space = NULL;
+static char *fake_readback = NULL;
+static size_t fake_readback_size = 0;
 static int *fake_framebuffer = NULL;
 static char *compressed_framebuffer = NULL;
 static size_t fb_size = 0;
@@ -329,9 +334,24 @@ static bool glimpl_shutdown = false;
 static int glimpl_major = SGL_DEFAULT_MAJOR;
 static int glimpl_minor = SGL_DEFAULT_MINOR;
 
+/*
+ * bytes of client arrays the server keeps resident for us
+ */
+static size_t glimpl_upload_cache_budget = 0;
+
+/*
+ * whether large texture and buffer uploads are looked up in the
+ * server's blob store before being sent
+ */
+static bool glimpl_blob_store_available = false;
+static bool glimpl_blob_store = false;
+
 static int client_id = 0;
 static void *lockg;
 
+static inline int *glimpl_begin(size_t count);
+static inline void glimpl_push_command(int cmd);
+
 /* pb_read hook if using network feature */
 static int pb_read_hook(int offset)
 {
@@ -342,6 +362,8 @@ static int pb_read_hook(int offset)
         return glimpl_major;
     case SGL_OFFSET_REGISTER_GLMIN:
         return glimpl_minor;
+    case SGL_OFFSET_REGISTER_ERROR:
+        return ((struct sgl_packet_retval*)fake_register_space)->error;
     default:
         return fake_register_space[offset];
     }
@@ -371,32 +393,16 @@ static void *pb_ptr_hook(size_t offset)
     }
 }
 
+/*
+ * strings go out length-prefixed, terminator included, so the server
+ * can step over them without scanning for the nul
+ */
 static void push_string(const char *s)
 {
     int len = strlen(s);
-    int last = 0;
-    int rem = len % 4;
-    int shift = 0;
-
-    for (int j = 0; j < len / 4; j++) {
-        pb_push(*(int*)&s[j * 4]);
-        last = *(int*)&s[j * 4];
-    }
-
-    if (rem != 0) {
-        int res = 0;
-        while (rem) {
-            res |= s[len - rem] << shift;
-            rem--;
-            shift += 8;
-        }
-
-        pb_push(res);
-        last = res;
-    }
 
-    if (!(((last) & 0xFF) == 0 || ((last >> 8) & 0xFF) == 0 || ((last >> 16) & 0xFF) == 0 || ((last >> 24) & 0xFF) == 0))
-        pb_push(0);
+    pb_push(len);
+    pb_memcpy(s, len + 1);
 }
 
 static void push_counted_string(const char *s, int len)
@@ -415,39 +421,41 @@ bool expecting_retval = true;
 static inline void submit_shm()
 {
     size_t submit_size = pb_size();
-    int fifo_size = pb_global_read(SGL_OFFSET_REGISTER_FIFO_SIZE);
+    size_t fifo_size = pb_capacity();
 
-    if (submit_size > (size_t)fifo_size) {
-        PRINT_LOG("shared-memory submit too large: size=%zu capacity=%d client=%d\n",
+    if (submit_size > fifo_size) {
+        PRINT_LOG("shared-memory submit too large: size=%zu capacity=%zu client=%d\n",
             submit_size, fifo_size, client_id);
         pb_write(SGL_OFFSET_REGISTER_RETVAL, 0);
-        memset(pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), 0, SGL_CLIENT_SLOT_SIZE - SGL_OFFSET_REGISTER_RETVAL_V);
+        memset(pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), 0, SGL_OFFSET_SLOT_CONTROL - SGL_OFFSET_REGISTER_RETVAL_V);
         pb_reset();
         return;
     }
 
     /*
-     * lock
+     * the submit registers are free again as soon as the server
+     * has picked up the previous submit
      */
-    spin_lock(lockg);
-
-    while (pb_global_read(SGL_OFFSET_REGISTER_SUBMIT) == 1) {
-        spin_unlock(lockg);
-        while (pb_global_read(SGL_OFFSET_REGISTER_SUBMIT) == 1);
-        spin_lock(lockg);
-    }
+    while (pb_read(SGL_OFFSET_REGISTER_SUBMIT) == 1);
 
     /*
-     * copy internal buffer to shared memory and submit
+     * copy internal buffer into our own ring, then flag the slot
+     * as ready; no other client shares the ring, so no lock
      */
-    pb_write(SGL_OFFSET_REGISTER_SUBMIT, 1);
     pb_copy_to_shared();
-    pb_global_write(SGL_OFFSET_REGISTER_STAGE_CLIENT_ID, client_id);
-    pb_global_write(SGL_OFFSET_REGISTER_STAGE_SIZE, (int)submit_size);
-    pb_global_write(SGL_OFFSET_REGISTER_SUBMIT, 1);
-    spin_unlock(lockg);
+    pb_write(SGL_OFFSET_REGISTER_RING_SUBMIT_OFFSET, (int)pb_ring_offset());
+    pb_write(SGL_OFFSET_REGISTER_RING_SUBMIT_SIZE, (int)submit_size);
+    pb_write(SGL_OFFSET_REGISTER_RING_SUBMIT_SEQ, pb_next_submit_seq());
+    pb_write(SGL_OFFSET_REGISTER_SUBMIT, 1);
+    spin_atomic_or(pb_global_ptr(SGL_OFFSET_REGISTER_READY_MASK), (int)SGL_SHM_SLOT_BIT(client_id));
+    if (pb_global_read(SGL_OFFSET_REGISTER_SERVER_WAITING))
+        spin_wake(pb_global_ptr(SGL_OFFSET_REGISTER_READY_MASK));
 
-    while (pb_read(SGL_OFFSET_REGISTER_SUBMIT) == 1);
+    /*
+     * don't wait for completion; whoever needs a return value
+     * waits for this submit's sequence number in pb_sync
+     */
+    pb_flip();
     pb_reset();
 }
 
@@ -460,7 +468,24 @@ static inline void submit_net()
     if (expecting_retval) {
         while (__enet_host_service(client, &event, 0) >= 0) {
             if (event.type == ENET_EVENT_TYPE_RECEIVE) {
-                memcpy(fake_register_space, event.packet->data, event.packet->dataLength);
+                size_t length = event.packet->dataLength;
+                size_t retval_length = MIN(length, sizeof(struct sgl_packet_retval));
+
+                memcpy(fake_register_space, event.packet->data, retval_length);
+                fake_readback_size = 0;
+
+                /*
+                 * bulk readbacks are appended after the retval
+                 */
+                if (length > retval_length) {
+                    char *grown = realloc(fake_readback, length - retval_length);
+                    if (grown != NULL) {
+                        fake_readback = grown;
+                        fake_readback_size = length - retval_length;
+                        memcpy(fake_readback, event.packet->data + retval_length, fake_readback_size);
+                    }
+                }
+
                 __enet_packet_destroy(event.packet);
                 break;
             }
@@ -480,13 +505,14 @@ void glimpl_submit()
     /*
      * processor stops at 0
      */
+    pb_end_command();
     pb_push(0);
 
     if (pb_overflowed()) {
         PRINT_LOG("dropping command buffer after push-buffer overflow\n");
         if (client_id != 0 || glimpl_uses_network) {
             pb_write(SGL_OFFSET_REGISTER_RETVAL, 0);
-            memset(pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), 0, SGL_CLIENT_SLOT_SIZE - SGL_OFFSET_REGISTER_RETVAL_V);
+            memset(pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), 0, SGL_OFFSET_SLOT_CONTROL - SGL_OFFSET_REGISTER_RETVAL_V);
         }
         pb_reset();
         return;
@@ -498,6 +524,45 @@ void glimpl_submit()
         submit_net();
 }
 
+/*
+ * state setters dropped because the shadow says they'd change nothing,
+ * next to the ones that were sent, per command
+ */
+static struct {
+    uint64_t sent;
+    uint64_t filtered;
+} glimpl_state_filter[SGL_CMD_MAX];
+
+static bool glimpl_state_filter_stats = false;
+
+static inline bool glimpl_filter_state(int cmd, bool redundant)
+{
+    if (redundant)
+        glimpl_state_filter[cmd].filtered++;
+    else
+        glimpl_state_filter[cmd].sent++;
+    return redundant;
+}
+
+static void glimpl_report_state_filter(void)
+{
+    static const char *names[SGL_CMD_MAX] = {
+#define SGL_COMMAND(name, length) #name,
+#include <sglcommands.h>
+#undef SGL_COMMAND
+    };
+
+    for (int i = 0; i < SGL_CMD_MAX; i++) {
+        uint64_t total = glimpl_state_filter[i].sent + glimpl_state_filter[i].filtered;
+        if (total == 0)
+            continue;
+
+        PRINT_LOG("%s: filtered %llu of %llu (%.1f%%)\n", names[i],
+            (unsigned long long)glimpl_state_filter[i].filtered, (unsigned long long)total,
+            100.0 * glimpl_state_filter[i].filtered / total);
+    }
+}
+
 void glimpl_goodbye()
 {
     if (!glimpl_initialized || glimpl_shutdown)
@@ -506,6 +571,9 @@ void glimpl_goodbye()
     glimpl_shutdown = true;
     expecting_retval = false;
 
+    if (glimpl_state_filter_stats)
+        glimpl_report_state_filter();
+
     /*
      * probably not a good idea to submit
      * all commands before sending our
@@ -515,9 +583,9 @@ void glimpl_goodbye()
      * any commands leftover
      */
     pb_reset();
-    pb_push(SGL_CMD_GOODBYE_WORLD);
-    pb_push(client_id);
-    pb_push(0);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GOODBYE_WORLD;
+    *cur++ = client_id;
     glimpl_submit();
 
     if (client != NULL && peer != NULL)
@@ -540,6 +608,9 @@ void glimpl_goodbye()
     peer = NULL;
     free(fake_register_space);
     fake_register_space = NULL;
+    free(fake_readback);
+    fake_readback = NULL;
+    fake_readback_size = 0;
     free(fake_framebuffer);
     fake_framebuffer = NULL;
     free(compressed_framebuffer);
@@ -557,12 +628,18 @@ void glimpl_goodbye()
 
 static inline void swap_buffers_shm(int width, int height, int vflip, int format)
 {
-    pb_push(SGL_CMD_SWAP_BUFFERS);
-    pb_push(width);
-    pb_push(height);
-    pb_push(vflip);
-    pb_push(format);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_SWAP_BUFFERS;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = vflip;
+    *cur++ = format;
     glimpl_submit();
+
+    /*
+     * the caller reads the framebuffer right after this
+     */
+    pb_sync();
 }
 
 static inline void swap_buffers_net(int width, int height, int vflip, int format)
@@ -614,6 +691,15 @@ static inline void init_shm(bool use_direct_access)
     pb_set(use_direct_access);
 #endif
     pb_reset();
+
+    int protocol = pb_global_read(SGL_OFFSET_REGISTER_PROTOCOL);
+    if (protocol != SGL_PROTOCOL_VERSION) {
+        fprintf(stderr, "init_shm: server speaks protocol %d, expected %d\n", protocol, SGL_PROTOCOL_VERSION);
+        exit(1);
+    }
+
+    glimpl_upload_cache_budget = (size_t)pb_global_read(SGL_OFFSET_REGISTER_UPLOAD_CACHE) * 1024 * 1024;
+    glimpl_blob_store_available = pb_global_read(SGL_OFFSET_REGISTER_BLOB_STORE) != 0;
 }
 
 static int shm_claim_slot(void)
@@ -668,7 +754,7 @@ static inline void shm_create_context()
     /*
      * submit
      */
-    pb_push(SGL_CMD_CREATE_CONTEXT);
+    glimpl_push_command(SGL_CMD_CREATE_CONTEXT);
     glimpl_submit();
     
     int packed_dims = pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -677,7 +763,9 @@ static inline void shm_create_context()
 
 static inline void init_net(char *network)
 {
-    struct sgl_packet_connect *packet = NULL;
+    struct sgl_packet_connect connect = { 0 };
+    struct sgl_packet_connect *packet = &connect;
+    bool received = false;
     char *res;
     struct pb_net_hooks hooks = {
         pb_read_hook,
@@ -732,14 +820,29 @@ static inline void init_net(char *network)
     
     while (__enet_host_service(client, &event, 100) >= 0) {
         if (event.type == ENET_EVENT_TYPE_RECEIVE) {
-            packet = (struct sgl_packet_connect*)event.packet->data;
+            if (event.packet->dataLength >= sizeof(connect)) {
+                memcpy(&connect, event.packet->data, sizeof(connect));
+                received = true;
+            }
             __enet_packet_destroy(event.packet);
             break;
         }
     }
 
+    if (!received) {
+        fprintf(stderr, "init_net: server did not send a valid connect packet\n");
+        exit(1);
+    }
+
+    if (packet->protocol != SGL_PROTOCOL_VERSION) {
+        fprintf(stderr, "init_net: server speaks protocol %u, expected %d\n", packet->protocol, SGL_PROTOCOL_VERSION);
+        exit(1);
+    }
+
     glimpl_major = packet->gl_major;
     glimpl_minor = packet->gl_minor;
+    glimpl_upload_cache_budget = (size_t)packet->upload_cache * 1024 * 1024;
+    glimpl_blob_store_available = packet->blob_store != 0;
 
     client_id = packet->client_id;
 
@@ -757,6 +860,9 @@ void glimpl_init()
 {
     char *network = getenv("SGL_NETWORK_ENDPOINT");
     char *gl_version_override = getenv("GL_VERSION_OVERRIDE");
+    char *direct_access = getenv("SGL_DIRECT_ACCESS");
+    char *blob_store = getenv("SGL_BLOB_STORE");
+    char *state_filter_stats = getenv("SGL_STATE_FILTER_STATS");
 
     if (glimpl_initialized)
         return;
@@ -765,10 +871,14 @@ void glimpl_init()
     expecting_retval = true;
 
     if (network == NULL)
-        init_shm(false);
+        init_shm(direct_access != NULL && strcmp(direct_access, "true") == 0);
     else
         init_net(network);
 
+    glimpl_blob_store = glimpl_blob_store_available &&
+        (network != NULL || (blob_store != NULL && strcmp(blob_store, "true") == 0));
+    glimpl_state_filter_stats = state_filter_stats != NULL && strcmp(state_filter_stats, "true") == 0;
+
     glimpl_major = gl_version_override ? gl_version_override[0] - '0' : pb_read(SGL_OFFSET_REGISTER_GLMAJ);
     glimpl_minor = gl_version_override ? gl_version_override[2] - '0' : pb_read(SGL_OFFSET_REGISTER_GLMIN);
 
@@ -1019,259 +1129,1637 @@ static void glimpl_set_pixel_store(GLenum pname, GLint param)
     }
 }
 
-static inline void glimpl_upload_buffer(const void *data, size_t size)
+/*
+ * room kept free past an upload for the command consuming it
+ */
+#define GLIMPL_UPLOAD_HEADROOM 256
+
+/*
+ * most bytes sent in one upload command, so its length fits in the
+ * command header; anything larger is streamed in parts
+ */
+#define GLIMPL_UPLOAD_MAX ((size_t)(SGL_CMD_LENGTH_LONG - 4) * sizeof(int))
+
+/*
+ * glBegin/glEnd pairs are recorded here rather than sent call by call,
+ * then shipped by glEnd as a single upload and draw
+ */
+enum {
+    GLIMPL_IMMEDIATE_COLOR,
+    GLIMPL_IMMEDIATE_NORMAL,
+    GLIMPL_IMMEDIATE_TEXCOORD,
+    GLIMPL_IMMEDIATE_ATTRIBS
+};
+
+struct glimpl_immediate_vertex {
+    float position[4];
+    float attribs[GLIMPL_IMMEDIATE_ATTRIBS][4];
+};
+
+static struct {
+    bool recording;
+    GLenum mode;
+    struct glimpl_immediate_vertex current;
+    int position_size;
+    int sizes[GLIMPL_IMMEDIATE_ATTRIBS];        /* widest form used since glBegin, 0 if never set */
+    size_t defined_at[GLIMPL_IMMEDIATE_ATTRIBS];  /* vertices recorded when first set */
+    struct glimpl_immediate_vertex *vertices;
+    size_t count;
+    size_t capacity;
+    float *packed;
+    size_t packed_capacity;
+} glimpl_immediate;
+
+static void glimpl_immediate_unbatch(void);
+
+/*
+ * flush whatever has been recorded so far if `size` more bytes won't
+ * fit; only call this between commands, never in the middle of one
+ */
+static void glimpl_reserve(size_t size)
+{
+    if (glimpl_immediate.recording)
+        glimpl_immediate_unbatch();
+
+    if (pb_size() != 0 && pb_size() + size + sizeof(int) > pb_capacity())
+        glimpl_submit();
+}
+
+/*
+ * cursor for the next `count` words of command stream, flushing first
+ * if they won't fit; like glimpl_reserve, only start a command with it
+ */
+static inline int *glimpl_begin(size_t count)
+{
+    /*
+     * anything other than a batched attribute or vertex ends batching
+     * of the current glBegin, it has to reach the server in order
+     */
+    if (glimpl_immediate.recording)
+        glimpl_immediate_unbatch();
+
+    int *cur = pb_begin_command(count);
+    if (cur == NULL) {
+        glimpl_submit();
+        cur = pb_begin_command(count);
+    }
+    return cur;
+}
+
+/*
+ * a command without operands
+ */
+static inline void glimpl_push_command(int cmd)
+{
+    *glimpl_begin(1) = cmd;
+}
+
+static inline void glimpl_push_upload(const void *data, size_t size)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(CEIL_DIV(size, 4));
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_VP_UPLOAD;
+    *cur++ = CEIL_DIV(size, 4);
     pb_memcpy((void*)data, size);
 }
 
-static inline void glimpl_download_buffer(void *dst, size_t size)
+/*
+ * header of an upload whose words the caller writes itself, for data
+ * that has to be converted on the way; flushes first so the words and
+ * the `consumer` words of the command reading them share a submit
+ */
+static inline void glimpl_begin_upload(size_t words, size_t consumer)
 {
-    int blocks = CEIL_DIV(size, SGL_VP_DOWNLOAD_BLOCK_SIZE_IN_BYTES);
-    size_t count = size;
+    glimpl_reserve((2 + words + consumer) * sizeof(int));
 
-    void *retval_v = pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_VP_UPLOAD;
+    *cur++ = words;
+}
 
-    for (int i = 0; i < blocks; i++) {
-        size_t true_count = MIN(count, SGL_VP_DOWNLOAD_BLOCK_SIZE_IN_BYTES);
+/*
+ * uploads for a single command; anything that doesn't fit in an
+ * empty push buffer is streamed in parts, one flush per part, and
+ * reassembled by the server
+ */
+static void glimpl_upload_buffer(const void *data, size_t size)
+{
+    int *cur;
+    size_t chunk = MIN(pb_capacity() - GLIMPL_UPLOAD_HEADROOM, GLIMPL_UPLOAD_MAX) & ~(size_t)(sizeof(int) - 1);
 
-        pb_push(SGL_CMD_VP_DOWNLOAD);
-        pb_push(true_count);
-        
-        glimpl_submit();
+    if (size <= chunk) {
+        glimpl_reserve(size + GLIMPL_UPLOAD_HEADROOM);
+        glimpl_push_upload(data, size);
+        return;
+    }
 
-        memcpy((char*)dst + (i * SGL_VP_DOWNLOAD_BLOCK_SIZE_IN_BYTES), retval_v, true_count);
+    for (size_t offset = 0; offset < size; offset += chunk) {
+        size_t length = MIN(chunk, size - offset);
 
-        count -= SGL_VP_DOWNLOAD_BLOCK_SIZE_IN_BYTES;
+        glimpl_reserve(length + GLIMPL_UPLOAD_HEADROOM);
+        cur = glimpl_begin(4);
+        *cur++ = SGL_CMD_VP_UPLOAD_PART;
+        *cur++ = CEIL_DIV(size, 4);
+        *cur++ = offset / 4;
+        *cur++ = CEIL_DIV(length, 4);
+        pb_memcpy((const char*)data + offset, length);
     }
 }
 
-static void glimpl_upload_texture(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels)
+static inline void glimpl_push_blob_key(int cmd, const struct sgl_blob_key *key)
 {
-    if (pixels == NULL) {
-        pb_push(SGL_CMD_VP_NULL);
+    int *cur = glimpl_begin(1 + SGL_BLOB_KEY_WORDS);
+    *cur++ = cmd;
+    memcpy(cur, key, sizeof(*key));
+}
+
+/*
+ * texture and buffer contents; large ones are looked up in the
+ * server's blob store by content first, and only sent on a miss
+ */
+static void glimpl_upload_asset(const void *data, size_t size)
+{
+    if (!glimpl_blob_store || size < SGL_BLOB_MIN_SIZE) {
+        glimpl_upload_buffer(data, size);
         return;
     }
 
-    size_t total_size = glimpl_get_pixel_transfer_span(&glimpl_unpack_store, width, height, depth, format, type);
+    struct sgl_blob_key key = sgl_blob_key_of(data, size);
+
+    glimpl_push_blob_key(SGL_CMD_VP_BLOB_QUERY, &key);
+    glimpl_submit();
+    if (pb_read(SGL_OFFSET_REGISTER_RETVAL))
+        return;
 
-    glimpl_upload_buffer(pixels, total_size);
+    glimpl_upload_buffer(data, size);
+    glimpl_push_blob_key(SGL_CMD_VP_BLOB_STORE, &key);
 }
 
-static inline bool glimpl_push_client_pointer(bool client_managed, int first, int count, int size, int type, int stride, const void *pointer)
+static const int glimpl_immediate_cmds[GLIMPL_IMMEDIATE_ATTRIBS] = {
+    SGL_CMD_COLOR4F,
+    SGL_CMD_NORMAL3F,
+    SGL_CMD_TEXCOORD4F
+};
+
+static const int glimpl_immediate_components[GLIMPL_IMMEDIATE_ATTRIBS] = { 4, 3, 4 };
+
+static void glimpl_immediate_start(GLenum mode)
 {
-    const unsigned char *data = pointer;
-    size_t sizeof_type = glimpl_type_size(type);
-    size_t elem_size = (size_t)size * sizeof_type;
-    size_t byte_count = elem_size * count;
+    glimpl_immediate.recording = true;
+    glimpl_immediate.mode = mode;
+    glimpl_immediate.position_size = 0;
+    glimpl_immediate.count = 0;
+    for (int i = 0; i < GLIMPL_IMMEDIATE_ATTRIBS; i++)
+        glimpl_immediate.sizes[i] = 0;
+}
 
-    if (!client_managed)
-        return false;
+static void glimpl_immediate_push_attrib(int attrib, const float *v)
+{
+    int *cur = glimpl_begin(1 + glimpl_immediate_components[attrib]);
+    *cur++ = glimpl_immediate_cmds[attrib];
+    for (int i = 0; i < glimpl_immediate_components[attrib]; i++)
+        *(float*)cur++ = v[i];
+}
 
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(CEIL_DIV(byte_count, sizeof(int)));
+/*
+ * attributes set inside the pair stay current after glEnd, which a
+ * draw from arrays leaves undefined, so they're set again afterwards
+ */
+static void glimpl_immediate_push_current(void)
+{
+    for (int i = 0; i < GLIMPL_IMMEDIATE_ATTRIBS; i++)
+        if (glimpl_immediate.sizes[i])
+            glimpl_immediate_push_attrib(i, glimpl_immediate.current.attribs[i]);
+}
 
-    if (stride == 0)
-        pb_memcpy(data + ((size_t)first * elem_size), byte_count);
-    else {
-        const unsigned char *base = data + ((size_t)first * stride);
+/*
+ * send what has been recorded the way it was issued; the rest of the
+ * pair then goes straight to the server
+ */
+static void glimpl_immediate_unbatch(void)
+{
+    glimpl_immediate.recording = false;
 
-        for (int i = 0; i < count; i++) {
-            const void *real_data = base + ((size_t)i * stride);
-            pb_memcpy_unaligned(real_data, elem_size);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_BEGIN;
+    *cur++ = glimpl_immediate.mode;
+
+    for (size_t i = 0; i < glimpl_immediate.count; i++) {
+        struct glimpl_immediate_vertex *v = &glimpl_immediate.vertices[i];
+
+        for (int a = 0; a < GLIMPL_IMMEDIATE_ATTRIBS; a++) {
+            if (glimpl_immediate.sizes[a] == 0 || glimpl_immediate.defined_at[a] > i)
+                continue;
+            if (glimpl_immediate.defined_at[a] == i || memcmp(v->attribs[a], v[-1].attribs[a], sizeof(v->attribs[a])) != 0)
+                glimpl_immediate_push_attrib(a, v->attribs[a]);
         }
-        pb_realign();
+
+        cur = glimpl_begin(5);
+        *cur++ = SGL_CMD_VERTEX4F;
+        *(float*)cur++ = v->position[0];
+        *(float*)cur++ = v->position[1];
+        *(float*)cur++ = v->position[2];
+        *(float*)cur++ = v->position[3];
     }
 
-    return true;
+    glimpl_immediate_push_current();
 }
 
-static inline int glimpl_vertex_attrib_cmd(const struct gl_vertex_attrib_pointer *vap)
+static bool glimpl_immediate_attrib(int attrib, int size, float x, float y, float z, float w)
 {
-    switch (vap->kind) {
-    case GLIMPL_VERTEX_ATTRIB_POINTER_INT:
-        return SGL_CMD_VERTEXATTRIBIPOINTER;
-    case GLIMPL_VERTEX_ATTRIB_POINTER_LONG:
-        return SGL_CMD_VERTEXATTRIBLPOINTER;
-    case GLIMPL_VERTEX_ATTRIB_POINTER_FLOAT:
-    default:
-        return SGL_CMD_VERTEXATTRIBPOINTER;
-    }
+    if (!glimpl_immediate.recording)
+        return false;
+
+    float *v = glimpl_immediate.current.attribs[attrib];
+    v[0] = x;
+    v[1] = y;
+    v[2] = z;
+    v[3] = w;
+
+    if (glimpl_immediate.sizes[attrib] == 0)
+        glimpl_immediate.defined_at[attrib] = glimpl_immediate.count;
+    glimpl_immediate.sizes[attrib] = MAX(glimpl_immediate.sizes[attrib], size);
+    return true;
 }
 
-static inline void glimpl_push_vertex_attrib_pointers(int first, int count)
+static bool glimpl_immediate_vertex(int size, float x, float y, float z, float w)
 {
-    for (int i = 0; i < GLIMPL_MAX_OBJECTS; i++) {
-        struct gl_vertex_attrib_pointer *vap = &glimpl_vaps[i];
-        if (vap->enabled && vap->client_managed) {
-            bool use_upload = glimpl_push_client_pointer(vap->client_managed, first, count, vap->size, vap->type, vap->stride, vap->ptr);
+    if (!glimpl_immediate.recording)
+        return false;
 
-            pb_push(glimpl_vertex_attrib_cmd(vap));
-            pb_push(vap->index);
-            pb_push(vap->size);
-            pb_push(vap->type);
-            if (vap->kind == GLIMPL_VERTEX_ATTRIB_POINTER_FLOAT)
-                pb_push(vap->normalized);
-            pb_push(use_upload ? 0 : vap->stride);
-            pb_push64(use_upload ? 0 : (int64_t)(uintptr_t)vap->ptr);
-            pb_push(use_upload);
+    if (glimpl_immediate.count == glimpl_immediate.capacity) {
+        size_t capacity = glimpl_immediate.capacity ? glimpl_immediate.capacity * 2 : 1024;
+        struct glimpl_immediate_vertex *vertices = realloc(glimpl_immediate.vertices, capacity * sizeof(*vertices));
+        if (vertices == NULL) {
+            glimpl_immediate_unbatch();
+            return false;
         }
+        glimpl_immediate.vertices = vertices;
+        glimpl_immediate.capacity = capacity;
     }
+
+    struct glimpl_immediate_vertex *v = &glimpl_immediate.vertices[glimpl_immediate.count++];
+    *v = glimpl_immediate.current;
+    v->position[0] = x;
+    v->position[1] = y;
+    v->position[2] = z;
+    v->position[3] = w;
+
+    glimpl_immediate.position_size = MAX(glimpl_immediate.position_size, size);
+    return true;
 }
 
-static inline void glimpl_push_client_pointers(int first, int count)
-{
-    int last_tex_coord_unit = -1;
+/*
+ * attributes that were current for every vertex become arrays; one
+ * first set partway through would need the value current before
+ * glBegin, which only the server knows, so that pair is sent as is
+ */
+static void glimpl_immediate_end(void)
+{
+    size_t count = glimpl_immediate.count;
+    int sizes[GLIMPL_IMMEDIATE_ATTRIBS];
+    int components = glimpl_immediate.position_size;
+
+    for (int i = 0; i < GLIMPL_IMMEDIATE_ATTRIBS; i++) {
+        size_t defined_at = glimpl_immediate.defined_at[i];
+        sizes[i] = 0;
+        if (glimpl_immediate.sizes[i] == 0 || defined_at == count)
+            continue;
+        if (defined_at != 0) {
+            glimpl_immediate_unbatch();
+            glimpl_push_command(SGL_CMD_END);
+            return;
+        }
+        sizes[i] = glimpl_immediate.sizes[i];
+        components += sizes[i];
+    }
 
-    if (glimpl_normal_ptr.in_use) {
-        bool status = glimpl_push_client_pointer(glimpl_normal_ptr.client_managed, first, count, 3,
-                            glimpl_normal_ptr.type, glimpl_normal_ptr.stride, glimpl_normal_ptr.pointer);
+    glimpl_immediate.recording = false;
 
-        pb_push(SGL_CMD_NORMALPOINTER);
-        pb_push(glimpl_normal_ptr.type);
-        pb_push(status ? 0 : glimpl_normal_ptr.stride);
-        pb_push(status);
-        pb_push64(status ? 0 : (int64_t)(uintptr_t)glimpl_normal_ptr.pointer);
+    if (count == 0) {
+        glimpl_immediate_push_current();
+        return;
     }
 
-    if (glimpl_color_ptr.in_use) {
-        int true_size = glimpl_get_legacy_color_array_size(glimpl_color_ptr.size);
+    size_t packed_size = count * components;
+    if (glimpl_immediate.packed_capacity < packed_size) {
+        float *packed = realloc(glimpl_immediate.packed, packed_size * sizeof(float));
+        if (packed == NULL) {
+            glimpl_immediate.recording = true;
+            glimpl_immediate_unbatch();
+            glimpl_push_command(SGL_CMD_END);
+            return;
+        }
+        glimpl_immediate.packed = packed;
+        glimpl_immediate.packed_capacity = packed_size;
+    }
 
-        bool status = glimpl_push_client_pointer(glimpl_color_ptr.client_managed, first, count, true_size,
-                            glimpl_color_ptr.type, glimpl_color_ptr.stride, glimpl_color_ptr.pointer);
+    float *out = glimpl_immediate.packed;
+    for (size_t i = 0; i < count; i++) {
+        struct glimpl_immediate_vertex *v = &glimpl_immediate.vertices[i];
 
-        pb_push(SGL_CMD_COLORPOINTER);
-        pb_push(glimpl_color_ptr.size);
-        pb_push(glimpl_color_ptr.type);
-        pb_push(status ? 0 : glimpl_color_ptr.stride);
-        pb_push(status);
-        pb_push64(status ? 0 : (int64_t)(uintptr_t)glimpl_color_ptr.pointer);
+        memcpy(out, v->position, glimpl_immediate.position_size * sizeof(float));
+        out += glimpl_immediate.position_size;
+        for (int a = 0; a < GLIMPL_IMMEDIATE_ATTRIBS; a++) {
+            memcpy(out, v->attribs[a], sizes[a] * sizeof(float));
+            out += sizes[a];
+        }
     }
 
-    for (int t = 0; t < GLIMPL_MAX_TEXTURES; t++) {
-        if (glimpl_tex_coord_ptr[t].in_use) {
-            bool status = glimpl_push_client_pointer(glimpl_tex_coord_ptr[t].client_managed, first, count, glimpl_tex_coord_ptr[t].size,
-                                glimpl_tex_coord_ptr[t].type, glimpl_tex_coord_ptr[t].stride, glimpl_tex_coord_ptr[t].pointer);
+    glimpl_upload_buffer(glimpl_immediate.packed, packed_size * sizeof(float));
 
-            pb_push(SGL_CMD_CLIENTACTIVETEXTURE);
-            pb_push(GL_TEXTURE0 + t);
-            last_tex_coord_unit = t;
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VP_DRAW_IMMEDIATE;
+    *cur++ = glimpl_immediate.mode;
+    *cur++ = (int)count;
+    *cur++ = SGL_IMMEDIATE_LAYOUT(glimpl_immediate.position_size,
+        sizes[GLIMPL_IMMEDIATE_COLOR], sizes[GLIMPL_IMMEDIATE_NORMAL], sizes[GLIMPL_IMMEDIATE_TEXCOORD]);
+
+    glimpl_immediate_push_current();
+}
+
+/*
+ * the download command, its two arguments and the terminator
+ */
+#define GLIMPL_DOWNLOAD_HEADER (sizeof(int) * 4)
+
+/*
+ * readbacks over the network are capped well below enet's packet limit
+ */
+#define GLIMPL_NET_DOWNLOAD_CHUNK (16 * 1024 * 1024)
+
+/*
+ * reads back whatever the last command pointed the server at; over
+ * shared memory the server writes straight into the unused part of
+ * our ring past the submit, so a readback costs one submit per
+ * ring-sized chunk rather than one per 3 KiB block
+ */
+static void glimpl_download_buffer(void *dst, size_t size)
+{
+    int *cur;
+    size_t offset = 0;
+
+    while (offset < size) {
+        size_t length = size - offset;
+        size_t ring_offset = 0;
 
-            pb_push(SGL_CMD_ENABLECLIENTSTATE);
-            pb_push(GL_TEXTURE_COORD_ARRAY);
+        if (GLIMPL_RUNTIME_USES_SHARED_MEMORY) {
+            size_t start = (pb_size() + GLIMPL_DOWNLOAD_HEADER + 63) & ~(size_t)63;
 
-            pb_push(SGL_CMD_TEXCOORDPOINTER);
-            pb_push(glimpl_tex_coord_ptr[t].size);
-            pb_push(glimpl_tex_coord_ptr[t].type);
-            pb_push(status ? 0 : glimpl_tex_coord_ptr[t].stride);
-            pb_push(status);
-            pb_push64(status ? 0 : (int64_t)(uintptr_t)glimpl_tex_coord_ptr[t].pointer);
+            /*
+             * make room by flushing what's pending if the rest of
+             * the ring can't take the whole readback
+             */
+            if (pb_size() != 0 && (start >= pb_capacity() || pb_capacity() - start < length)) {
+                glimpl_submit();
+                continue;
+            }
+        }
+        else {
+            length = MIN(length, GLIMPL_NET_DOWNLOAD_CHUNK);
         }
-    }
 
-    if (last_tex_coord_unit >= 0 && last_tex_coord_unit != glimpl_client_active_texture) {
-        pb_push(SGL_CMD_CLIENTACTIVETEXTURE);
-        pb_push(GL_TEXTURE0 + glimpl_client_active_texture);
-    }
+        cur = glimpl_begin(3);
 
-    if (glimpl_vertex_ptr.in_use) {
-        bool status = glimpl_push_client_pointer(glimpl_vertex_ptr.client_managed, first, count, glimpl_vertex_ptr.size,
-                            glimpl_vertex_ptr.type,  glimpl_vertex_ptr.stride, glimpl_vertex_ptr.pointer);
+        /*
+         * placed only now, glimpl_begin may have flushed or unbatched
+         * vertices and moved the cursor; whatever no longer fits is
+         * left to the next round
+         */
+        if (GLIMPL_RUNTIME_USES_SHARED_MEMORY) {
+            size_t start = (pb_size() + sizeof(int) + 63) & ~(size_t)63;
+            length = start < pb_capacity() ? MIN(length, pb_capacity() - start) : 0;
+            ring_offset = pb_ring_offset() + start;
+        }
+
+        *cur++ = SGL_CMD_VP_DOWNLOAD_BULK;
+        *cur++ = length;
+        *cur++ = ring_offset;
+        glimpl_submit();
+
+        if (GLIMPL_RUNTIME_USES_SHARED_MEMORY)
+            memcpy((char*)dst + offset, pb_ring_ptr(ring_offset), length);
+        else
+            memcpy((char*)dst + offset, fake_readback, MIN(length, fake_readback_size));
 
-        pb_push(SGL_CMD_VERTEXPOINTER);
-        pb_push(glimpl_vertex_ptr.size);
-        pb_push(glimpl_vertex_ptr.type);
-        pb_push(status ? 0 : glimpl_vertex_ptr.stride);
-        pb_push(status);
-        pb_push64(status ? 0 : (int64_t)(uintptr_t)glimpl_vertex_ptr.pointer);
+        offset += length;
     }
 }
 
-static bool glimpl_has_client_managed_draw_state(void)
-{
-    for (int i = 0; i < GLIMPL_MAX_OBJECTS; i++)
-        if (glimpl_vaps[i].enabled && glimpl_vaps[i].client_managed)
-            return true;
+/*
+ * buffer, texture and shader object names are handed out here and
+ * mapped onto host names by the server when first used, so creating
+ * them never has to wait on the host
+ */
+struct glimpl_name_pool {
+    GLuint next;
+    bool reuse;
+    unsigned char *live;
+    size_t live_count;
+    GLuint *free;
+    size_t free_count;
+    size_t free_capacity;
+};
 
-    if (glimpl_normal_ptr.in_use && glimpl_normal_ptr.client_managed)
-        return true;
-    if (glimpl_color_ptr.in_use && glimpl_color_ptr.client_managed)
-        return true;
-    if (glimpl_vertex_ptr.in_use && glimpl_vertex_ptr.client_managed)
-        return true;
+static struct glimpl_name_pool glimpl_buffer_names = { .next = 1, .reuse = true };
+static struct glimpl_name_pool glimpl_texture_names = { .next = 1, .reuse = true };
 
-    for (int i = 0; i < GLIMPL_MAX_TEXTURES; i++)
-        if (glimpl_tex_coord_ptr[i].in_use && glimpl_tex_coord_ptr[i].client_managed)
-            return true;
+/*
+ * deleted shaders and programs linger while attached or in use, so
+ * their names are never handed out twice
+ */
+static struct glimpl_name_pool glimpl_shader_names = { .next = 1, .reuse = false };
 
-    return false;
+static inline bool glimpl_name_is_live(struct glimpl_name_pool *pool, GLuint name)
+{
+    return name < pool->live_count && pool->live[name];
 }
 
-static inline void glimpl_push_client_managed_draw_state(int first, int count)
+static bool glimpl_name_mark(struct glimpl_name_pool *pool, GLuint name, bool live)
 {
-    bool has_client_managed_draw_state = glimpl_has_client_managed_draw_state();
-    bool restore_array_buffer_binding = has_client_managed_draw_state && glimpl_array_buffer_binding != 0;
+    if (name >= SGL_MAX_OBJECT_NAME)
+        return false;
 
-    if (restore_array_buffer_binding) {
-        pb_push(SGL_CMD_BINDBUFFER);
-        pb_push(GL_ARRAY_BUFFER);
-        pb_push(0);
-    }
+    if (name >= pool->live_count) {
+        if (!live)
+            return true;
 
-    glimpl_push_vertex_attrib_pointers(first, count);
-    glimpl_push_client_pointers(first, count);
+        size_t count = pool->live_count ? pool->live_count : 256;
+        while (count <= name)
+            count *= 2;
 
-    if (restore_array_buffer_binding) {
-        pb_push(SGL_CMD_BINDBUFFER);
-        pb_push(GL_ARRAY_BUFFER);
-        pb_push(glimpl_array_buffer_binding);
+        unsigned char *grown = realloc(pool->live, count);
+        if (grown == NULL)
+            return false;
+
+        memset(grown + pool->live_count, 0, count - pool->live_count);
+        pool->live = grown;
+        pool->live_count = count;
     }
+
+    pool->live[name] = live;
+    return true;
 }
 
-static unsigned int glimpl_get_max_index(int type, int count, const void *indices)
+static GLuint glimpl_name_alloc(struct glimpl_name_pool *pool)
 {
-    unsigned int max_index = 0;
+    while (pool->free_count != 0) {
+        GLuint name = pool->free[--pool->free_count];
+        if (!glimpl_name_is_live(pool, name) && glimpl_name_mark(pool, name, true))
+            return name;
+    }
+
+    while (glimpl_name_is_live(pool, pool->next))
+        pool->next++;
+
+    if (!glimpl_name_mark(pool, pool->next, true)) {
+        PRINT_LOG("out of object names\n");
+        return 0;
+    }
+
+    return pool->next++;
+}
+
+static void glimpl_name_release(struct glimpl_name_pool *pool, GLuint name)
+{
+    if (!glimpl_name_is_live(pool, name))
+        return;
+
+    glimpl_name_mark(pool, name, false);
+    if (!pool->reuse)
+        return;
+
+    if (pool->free_count == pool->free_capacity) {
+        size_t capacity = pool->free_capacity ? pool->free_capacity * 2 : 256;
+        GLuint *grown = realloc(pool->free, capacity * sizeof(GLuint));
+        if (grown == NULL)
+            return;
+        pool->free = grown;
+        pool->free_capacity = capacity;
+    }
+
+    pool->free[pool->free_count++] = name;
+}
+
+/*
+ * names bound without ever being generated are legal in compatibility
+ * contexts; keep them from being handed out later
+ */
+static inline void glimpl_name_reserve(struct glimpl_name_pool *pool, GLuint name)
+{
+    if (name != 0 && !glimpl_name_is_live(pool, name))
+        glimpl_name_mark(pool, name, true);
+}
+
+static void glimpl_alloc_names(struct glimpl_name_pool *pool, GLsizei n, GLuint *names)
+{
+    for (GLsizei i = 0; i < n; i++)
+        names[i] = glimpl_name_alloc(pool);
+}
+
+/*
+ * the server generates all `n` names in one command, and they come
+ * back through the bulk readback path in the same submit
+ */
+static void glimpl_gen_names(int cmd, GLsizei n, GLuint *names)
+{
+    if (n <= 0)
+        return;
+
+    glimpl_push_command(cmd);
+    pb_push(n);
+    glimpl_download_buffer(names, n * sizeof(GLuint));
+}
+
+/*
+ * names are passed inline as one counted array; only split up when
+ * more are deleted at once than fit in the push buffer
+ */
+static void glimpl_delete_names(int cmd, GLsizei n, const GLuint *names)
+{
+    size_t chunk = (pb_capacity() - GLIMPL_UPLOAD_HEADROOM) / sizeof(GLuint);
+
+    for (GLsizei i = 0; i < n;) {
+        GLsizei count = (GLsizei)MIN((size_t)(n - i), chunk);
+
+        glimpl_reserve(count * sizeof(GLuint) + GLIMPL_UPLOAD_HEADROOM);
+        glimpl_push_command(cmd);
+        pb_push(count);
+        pb_memcpy(names + i, count * sizeof(GLuint));
+        i += count;
+    }
+}
+
+/*
+ * client-side shadow of the state applications query every frame;
+ * entries start out unknown, are fetched from the host the first time
+ * they're asked for and are kept current by the setters from then on.
+ * limits never change, so they're only ever fetched once
+ */
+struct gl_state_shadow {
+    GLenum pname;
+    int count;
+    bool constant;
+    bool known;
+    /*
+     * the value was set by the client rather than queried, so it holds
+     * for every index of indexed state as well and is safe to filter
+     * repeated sets against
+     */
+    bool written;
+    GLint v[4];
+};
+
+#define GLIMPL_SHADOW(pname, count) { pname, count, false, false, false, { 0 } }
+#define GLIMPL_SHADOW_LIMIT(pname, count) { pname, count, true, false, false, { 0 } }
+
+static struct gl_state_shadow glimpl_state_shadow[] = {
+    /* capabilities */
+    GLIMPL_SHADOW(GL_BLEND, 1),
+    GLIMPL_SHADOW(GL_CULL_FACE, 1),
+    GLIMPL_SHADOW(GL_DEPTH_TEST, 1),
+    GLIMPL_SHADOW(GL_STENCIL_TEST, 1),
+    GLIMPL_SHADOW(GL_SCISSOR_TEST, 1),
+    GLIMPL_SHADOW(GL_DITHER, 1),
+    GLIMPL_SHADOW(GL_POLYGON_OFFSET_FILL, 1),
+    GLIMPL_SHADOW(GL_MULTISAMPLE, 1),
+    GLIMPL_SHADOW(GL_SAMPLE_ALPHA_TO_COVERAGE, 1),
+    GLIMPL_SHADOW(GL_FRAMEBUFFER_SRGB, 1),
+    GLIMPL_SHADOW(GL_PRIMITIVE_RESTART, 1),
+    GLIMPL_SHADOW(GL_PRIMITIVE_RESTART_FIXED_INDEX, 1),
+    GLIMPL_SHADOW(GL_RASTERIZER_DISCARD, 1),
+    GLIMPL_SHADOW(GL_DEPTH_CLAMP, 1),
+    GLIMPL_SHADOW(GL_PROGRAM_POINT_SIZE, 1),
+    GLIMPL_SHADOW(GL_TEXTURE_CUBE_MAP_SEAMLESS, 1),
+    GLIMPL_SHADOW(GL_LINE_SMOOTH, 1),
+    GLIMPL_SHADOW(GL_LIGHTING, 1),
+    GLIMPL_SHADOW(GL_ALPHA_TEST, 1),
+    GLIMPL_SHADOW(GL_FOG, 1),
+    GLIMPL_SHADOW(GL_NORMALIZE, 1),
+    GLIMPL_SHADOW(GL_COLOR_MATERIAL, 1),
+
+    /* rasterization and per-fragment state */
+    GLIMPL_SHADOW(GL_VIEWPORT, 4),
+    GLIMPL_SHADOW(GL_SCISSOR_BOX, 4),
+    GLIMPL_SHADOW(GL_COLOR_WRITEMASK, 4),
+    GLIMPL_SHADOW(GL_DEPTH_WRITEMASK, 1),
+    GLIMPL_SHADOW(GL_DEPTH_FUNC, 1),
+    GLIMPL_SHADOW(GL_CULL_FACE_MODE, 1),
+    GLIMPL_SHADOW(GL_FRONT_FACE, 1),
+    GLIMPL_SHADOW(GL_BLEND_SRC_RGB, 1),
+    GLIMPL_SHADOW(GL_BLEND_DST_RGB, 1),
+    GLIMPL_SHADOW(GL_BLEND_SRC_ALPHA, 1),
+    GLIMPL_SHADOW(GL_BLEND_DST_ALPHA, 1),
+    GLIMPL_SHADOW(GL_BLEND_EQUATION_RGB, 1),
+    GLIMPL_SHADOW(GL_BLEND_EQUATION_ALPHA, 1),
+    GLIMPL_SHADOW(GL_MATRIX_MODE, 1),
+
+    /* bindings */
+    GLIMPL_SHADOW(GL_CURRENT_PROGRAM, 1),
+    GLIMPL_SHADOW(GL_VERTEX_ARRAY_BINDING, 1),
+    GLIMPL_SHADOW(GL_ARRAY_BUFFER_BINDING, 1),
+    GLIMPL_SHADOW(GL_ELEMENT_ARRAY_BUFFER_BINDING, 1),
+    GLIMPL_SHADOW(GL_PIXEL_PACK_BUFFER_BINDING, 1),
+    GLIMPL_SHADOW(GL_PIXEL_UNPACK_BUFFER_BINDING, 1),
+    GLIMPL_SHADOW(GL_UNIFORM_BUFFER_BINDING, 1),
+    GLIMPL_SHADOW(GL_SHADER_STORAGE_BUFFER_BINDING, 1),
+    GLIMPL_SHADOW(GL_TRANSFORM_FEEDBACK_BUFFER_BINDING, 1),
+    GLIMPL_SHADOW(GL_DRAW_INDIRECT_BUFFER_BINDING, 1),
+    GLIMPL_SHADOW(GL_DISPATCH_INDIRECT_BUFFER_BINDING, 1),
+    GLIMPL_SHADOW(GL_COPY_READ_BUFFER_BINDING, 1),
+    GLIMPL_SHADOW(GL_COPY_WRITE_BUFFER_BINDING, 1),
+    GLIMPL_SHADOW(GL_DRAW_FRAMEBUFFER_BINDING, 1),
+    GLIMPL_SHADOW(GL_READ_FRAMEBUFFER_BINDING, 1),
+    GLIMPL_SHADOW(GL_RENDERBUFFER_BINDING, 1),
+    GLIMPL_SHADOW(GL_ACTIVE_TEXTURE, 1),
+    GLIMPL_SHADOW(GL_TEXTURE_BINDING_1D, 1),
+    GLIMPL_SHADOW(GL_TEXTURE_BINDING_2D, 1),
+    GLIMPL_SHADOW(GL_TEXTURE_BINDING_3D, 1),
+    GLIMPL_SHADOW(GL_TEXTURE_BINDING_CUBE_MAP, 1),
+    GLIMPL_SHADOW(GL_TEXTURE_BINDING_1D_ARRAY, 1),
+    GLIMPL_SHADOW(GL_TEXTURE_BINDING_2D_ARRAY, 1),
+    GLIMPL_SHADOW(GL_TEXTURE_BINDING_RECTANGLE, 1),
+    GLIMPL_SHADOW(GL_TEXTURE_BINDING_BUFFER, 1),
+    GLIMPL_SHADOW(GL_TEXTURE_BINDING_2D_MULTISAMPLE, 1),
+
+    /* implementation limits */
+    GLIMPL_SHADOW_LIMIT(GL_MAX_TEXTURE_SIZE, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_3D_TEXTURE_SIZE, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_CUBE_MAP_TEXTURE_SIZE, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_ARRAY_TEXTURE_LAYERS, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_RENDERBUFFER_SIZE, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_VIEWPORT_DIMS, 2),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_VERTEX_ATTRIBS, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_TEXTURE_UNITS, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_TEXTURE_COORDS, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_TEXTURE_IMAGE_UNITS, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_DRAW_BUFFERS, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_COLOR_ATTACHMENTS, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_SAMPLES, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_ELEMENTS_VERTICES, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_ELEMENTS_INDICES, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_VERTEX_UNIFORM_COMPONENTS, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_FRAGMENT_UNIFORM_COMPONENTS, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_VARYING_COMPONENTS, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_UNIFORM_BUFFER_BINDINGS, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_UNIFORM_BLOCK_SIZE, 1),
+    GLIMPL_SHADOW_LIMIT(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, 1),
+    GLIMPL_SHADOW_LIMIT(GL_MAX_CLIP_DISTANCES, 1),
+    GLIMPL_SHADOW_LIMIT(GL_SUBPIXEL_BITS, 1),
+};
+
+/*
+ * binding points that revert to 0 when the object bound to them is
+ * deleted
+ */
+static const GLenum glimpl_buffer_binding_pnames[] = {
+    GL_ARRAY_BUFFER_BINDING,
+    GL_ELEMENT_ARRAY_BUFFER_BINDING,
+    GL_PIXEL_PACK_BUFFER_BINDING,
+    GL_PIXEL_UNPACK_BUFFER_BINDING,
+    GL_UNIFORM_BUFFER_BINDING,
+    GL_SHADER_STORAGE_BUFFER_BINDING,
+    GL_TRANSFORM_FEEDBACK_BUFFER_BINDING,
+    GL_DRAW_INDIRECT_BUFFER_BINDING,
+    GL_DISPATCH_INDIRECT_BUFFER_BINDING,
+    GL_COPY_READ_BUFFER_BINDING,
+    GL_COPY_WRITE_BUFFER_BINDING
+};
+
+static const GLenum glimpl_texture_binding_pnames[] = {
+    GL_TEXTURE_BINDING_1D,
+    GL_TEXTURE_BINDING_2D,
+    GL_TEXTURE_BINDING_3D,
+    GL_TEXTURE_BINDING_CUBE_MAP,
+    GL_TEXTURE_BINDING_1D_ARRAY,
+    GL_TEXTURE_BINDING_2D_ARRAY,
+    GL_TEXTURE_BINDING_RECTANGLE,
+    GL_TEXTURE_BINDING_BUFFER,
+    GL_TEXTURE_BINDING_2D_MULTISAMPLE
+};
+
+static const GLenum glimpl_framebuffer_binding_pnames[] = {
+    GL_DRAW_FRAMEBUFFER_BINDING,
+    GL_READ_FRAMEBUFFER_BINDING
+};
+
+/*
+ * mode of the display list being recorded, 0 outside of glNewList
+ */
+static GLenum glimpl_list_mode = 0;
+
+static struct gl_state_shadow *glimpl_shadow_find(GLenum pname)
+{
+    for (size_t i = 0; i < GLIMPL_ARRAY_COUNT(glimpl_state_shadow); i++)
+        if (glimpl_state_shadow[i].pname == pname)
+            return &glimpl_state_shadow[i];
+
+    return NULL;
+}
+
+static void glimpl_shadow_invalidate(GLenum pname)
+{
+    struct gl_state_shadow *entry = glimpl_shadow_find(pname);
+    if (entry != NULL && !entry->constant)
+        entry->known = false;
+}
+
+static void glimpl_shadow_invalidate_list(const GLenum *pnames, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        glimpl_shadow_invalidate(pnames[i]);
+}
+
+/*
+ * for when the host changes state behind our back: popping attribute
+ * stacks and calling display lists
+ */
+static void glimpl_shadow_invalidate_all(void)
+{
+    for (size_t i = 0; i < GLIMPL_ARRAY_COUNT(glimpl_state_shadow); i++)
+        if (!glimpl_state_shadow[i].constant)
+            glimpl_state_shadow[i].known = false;
+}
+
+static void glimpl_shadow_set(GLenum pname, const GLint *v)
+{
+    struct gl_state_shadow *entry = glimpl_shadow_find(pname);
+    if (entry == NULL)
+        return;
+
+    /*
+     * whether a command is compiled or executed right away depends on
+     * the command, so only trust the host until the list is done
+     */
+    if (glimpl_list_mode == GL_COMPILE) {
+        entry->known = false;
+        return;
+    }
+
+    memcpy(entry->v, v, sizeof(GLint) * entry->count);
+    entry->known = true;
+    entry->written = true;
+}
+
+static inline void glimpl_shadow_set1(GLenum pname, GLint v)
+{
+    glimpl_shadow_set(pname, &v);
+}
+
+/*
+ * whether setting pname to v would leave the host as it is. never
+ * while a list is being recorded, since the command has to go into it
+ */
+static bool glimpl_shadow_matches(GLenum pname, const GLint *v)
+{
+    struct gl_state_shadow *entry = glimpl_shadow_find(pname);
+    if (entry == NULL || !entry->known || !entry->written || glimpl_list_mode != 0)
+        return false;
+
+    return memcmp(entry->v, v, sizeof(GLint) * entry->count) == 0;
+}
+
+static inline bool glimpl_shadow_matches1(GLenum pname, GLint v)
+{
+    return glimpl_shadow_matches(pname, &v);
+}
+
+static void glimpl_shadow_unbind(const GLenum *pnames, size_t count, GLuint name)
+{
+    if (name == 0)
+        return;
+
+    for (size_t i = 0; i < count; i++) {
+        struct gl_state_shadow *entry = glimpl_shadow_find(pnames[i]);
+        if (entry != NULL && entry->known && (GLuint)entry->v[0] == name)
+            entry->v[0] = 0;
+    }
+}
+
+/*
+ * returns NULL for state that isn't shadowed, fetching it from the
+ * host first if it isn't known yet
+ */
+static struct gl_state_shadow *glimpl_shadow_fetch(GLenum pname)
+{
+    struct gl_state_shadow *entry = glimpl_shadow_find(pname);
+    if (entry == NULL || entry->known)
+        return entry;
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GETINTEGERV;
+    *cur++ = pname;
+    glimpl_submit();
+
+    memcpy(entry->v, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), sizeof(GLint) * entry->count);
+    entry->known = true;
+    entry->written = false;
+    return entry;
+}
+
+static GLenum glimpl_buffer_binding_pname(GLenum target)
+{
+    switch (target) {
+    case GL_ARRAY_BUFFER:               return GL_ARRAY_BUFFER_BINDING;
+    case GL_ELEMENT_ARRAY_BUFFER:       return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+    case GL_PIXEL_PACK_BUFFER:          return GL_PIXEL_PACK_BUFFER_BINDING;
+    case GL_PIXEL_UNPACK_BUFFER:        return GL_PIXEL_UNPACK_BUFFER_BINDING;
+    case GL_UNIFORM_BUFFER:             return GL_UNIFORM_BUFFER_BINDING;
+    case GL_SHADER_STORAGE_BUFFER:      return GL_SHADER_STORAGE_BUFFER_BINDING;
+    case GL_TRANSFORM_FEEDBACK_BUFFER:  return GL_TRANSFORM_FEEDBACK_BUFFER_BINDING;
+    case GL_DRAW_INDIRECT_BUFFER:       return GL_DRAW_INDIRECT_BUFFER_BINDING;
+    case GL_DISPATCH_INDIRECT_BUFFER:   return GL_DISPATCH_INDIRECT_BUFFER_BINDING;
+    case GL_COPY_READ_BUFFER:           return GL_COPY_READ_BUFFER_BINDING;
+    case GL_COPY_WRITE_BUFFER:          return GL_COPY_WRITE_BUFFER_BINDING;
+    default:                            return GL_NONE;
+    }
+}
+
+static GLenum glimpl_texture_binding_pname(GLenum target)
+{
+    switch (target) {
+    case GL_TEXTURE_1D:                 return GL_TEXTURE_BINDING_1D;
+    case GL_TEXTURE_2D:                 return GL_TEXTURE_BINDING_2D;
+    case GL_TEXTURE_3D:                 return GL_TEXTURE_BINDING_3D;
+    case GL_TEXTURE_CUBE_MAP:           return GL_TEXTURE_BINDING_CUBE_MAP;
+    case GL_TEXTURE_1D_ARRAY:           return GL_TEXTURE_BINDING_1D_ARRAY;
+    case GL_TEXTURE_2D_ARRAY:           return GL_TEXTURE_BINDING_2D_ARRAY;
+    case GL_TEXTURE_RECTANGLE:          return GL_TEXTURE_BINDING_RECTANGLE;
+    case GL_TEXTURE_BUFFER:             return GL_TEXTURE_BINDING_BUFFER;
+    case GL_TEXTURE_2D_MULTISAMPLE:     return GL_TEXTURE_BINDING_2D_MULTISAMPLE;
+    default:                            return GL_NONE;
+    }
+}
+
+/*
+ * uniform/attribute locations and block indices only change when a
+ * program is (re)linked, so lookups are answered locally after the
+ * first one. entries are keyed on the command used to look them up,
+ * the program and the name
+ */
+struct glimpl_location {
+    struct glimpl_location *next;
+    int cmd;
+    GLuint program;
+    GLint value;
+    char name[];
+};
+
+#define GLIMPL_LOCATION_BUCKETS 1024
+
+static struct glimpl_location *glimpl_locations[GLIMPL_LOCATION_BUCKETS];
+
+static unsigned int glimpl_location_hash(int cmd, GLuint program, const char *name)
+{
+    unsigned int hash = 2166136261u ^ (unsigned int)cmd;
+
+    hash = (hash ^ program) * 16777619u;
+    for (const char *c = name; *c; c++)
+        hash = (hash ^ (unsigned char)*c) * 16777619u;
+
+    return hash % GLIMPL_LOCATION_BUCKETS;
+}
+
+static void glimpl_forget_locations(GLuint program)
+{
+    for (int i = 0; i < GLIMPL_LOCATION_BUCKETS; i++) {
+        struct glimpl_location **link = &glimpl_locations[i];
+
+        while (*link != NULL) {
+            struct glimpl_location *loc = *link;
+            if (loc->program == program) {
+                *link = loc->next;
+                free(loc);
+            }
+            else {
+                link = &loc->next;
+            }
+        }
+    }
+}
+
+static GLint glimpl_get_location(int cmd, GLuint program, const char *name)
+{
+    unsigned int bucket = glimpl_location_hash(cmd, program, name);
+
+    for (struct glimpl_location *loc = glimpl_locations[bucket]; loc != NULL; loc = loc->next)
+        if (loc->cmd == cmd && loc->program == program && strcmp(loc->name, name) == 0)
+            return loc->value;
+
+    glimpl_push_command(cmd);
+    pb_push(program);
+    push_string(name);
+
+    glimpl_submit();
+    GLint value = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+
+    size_t length = strlen(name);
+    struct glimpl_location *loc = malloc(sizeof(*loc) + length + 1);
+    if (loc != NULL) {
+        loc->cmd = cmd;
+        loc->program = program;
+        loc->value = value;
+        memcpy(loc->name, name, length + 1);
+        loc->next = glimpl_locations[bucket];
+        glimpl_locations[bucket] = loc;
+    }
+
+    return value;
+}
+
+static void glimpl_upload_texture(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels)
+{
+    if (pixels == NULL) {
+        glimpl_push_command(SGL_CMD_VP_NULL);
+        return;
+    }
+
+    size_t total_size = glimpl_get_pixel_transfer_span(&glimpl_unpack_store, width, height, depth, format, type);
+
+    glimpl_upload_asset(pixels, total_size);
+}
+
+/*
+ * client arrays interleaved in one allocation are uploaded together:
+ * arrays with the same stride whose elements all fall within a single
+ * stride of each other share one span, sent with one bulk copy
+ */
+#define GLIMPL_MAX_ARRAY_SPANS 32
+
+struct glimpl_array_span {
+    const unsigned char *base;
+    int stride;
+    size_t width;
+    int members;
+};
+
+static struct glimpl_array_span glimpl_array_spans[GLIMPL_MAX_ARRAY_SPANS];
+static int glimpl_array_span_count;
+
+/*
+ * span whose data the server's current upload holds, -1 if none
+ */
+static int glimpl_uploaded_span = -1;
+
+static void glimpl_add_array_span(bool in_use, bool client_managed, const void *pointer, int stride, int size, int type)
+{
+    const unsigned char *p = pointer;
+    size_t elem_size = (size_t)size * glimpl_type_size(type);
+
+    if (!in_use || !client_managed || stride <= 0 || (size_t)stride <= elem_size)
+        return;
+
+    for (int i = 0; i < glimpl_array_span_count; i++) {
+        struct glimpl_array_span *span = &glimpl_array_spans[i];
+        if (span->stride != stride)
+            continue;
+
+        const unsigned char *lo = MIN(span->base, p);
+        const unsigned char *hi = MAX(span->base + span->width, p + elem_size);
+        if (hi - lo > stride)
+            continue;
+
+        span->base = lo;
+        span->width = hi - lo;
+        span->members++;
+        return;
+    }
+
+    if (glimpl_array_span_count < GLIMPL_MAX_ARRAY_SPANS)
+        glimpl_array_spans[glimpl_array_span_count++] = (struct glimpl_array_span){ p, stride, elem_size, 1 };
+}
+
+static void glimpl_find_array_spans(void)
+{
+    glimpl_array_span_count = 0;
+    glimpl_uploaded_span = -1;
+
+    for (int i = 0; i < GLIMPL_MAX_OBJECTS; i++)
+        glimpl_add_array_span(glimpl_vaps[i].enabled, glimpl_vaps[i].client_managed, glimpl_vaps[i].ptr,
+            glimpl_vaps[i].stride, glimpl_vaps[i].size, glimpl_vaps[i].type);
+
+    glimpl_add_array_span(glimpl_normal_ptr.in_use, glimpl_normal_ptr.client_managed, glimpl_normal_ptr.pointer,
+        glimpl_normal_ptr.stride, 3, glimpl_normal_ptr.type);
+    glimpl_add_array_span(glimpl_color_ptr.in_use, glimpl_color_ptr.client_managed, glimpl_color_ptr.pointer,
+        glimpl_color_ptr.stride, glimpl_get_legacy_color_array_size(glimpl_color_ptr.size), glimpl_color_ptr.type);
+    glimpl_add_array_span(glimpl_vertex_ptr.in_use, glimpl_vertex_ptr.client_managed, glimpl_vertex_ptr.pointer,
+        glimpl_vertex_ptr.stride, glimpl_vertex_ptr.size, glimpl_vertex_ptr.type);
+
+    for (int t = 0; t < GLIMPL_MAX_TEXTURES; t++)
+        glimpl_add_array_span(glimpl_tex_coord_ptr[t].in_use, glimpl_tex_coord_ptr[t].client_managed, glimpl_tex_coord_ptr[t].pointer,
+            glimpl_tex_coord_ptr[t].stride, glimpl_tex_coord_ptr[t].size, glimpl_tex_coord_ptr[t].type);
+}
+
+/*
+ * shared span holding an array, -1 if it's uploaded on its own
+ */
+static int glimpl_get_array_span(const void *pointer, int stride)
+{
+    const unsigned char *p = pointer;
+
+    for (int i = 0; i < glimpl_array_span_count; i++) {
+        struct glimpl_array_span *span = &glimpl_array_spans[i];
+        if (span->members > 1 && span->stride == stride && p >= span->base && p < span->base + span->width)
+            return i;
+    }
+
+    return -1;
+}
+
+static inline size_t glimpl_array_span_upload_size(const struct glimpl_array_span *span, int count)
+{
+    return count > 0 ? (size_t)(count - 1) * span->stride + span->width : 0;
+}
+
+#define GLIMPL_GATHER(n) \
+    for (int i = 0; i < count; i++, src += stride, out += (n)) \
+        memcpy(out, src, (n));
+
+/*
+ * pack `count` elements spaced `stride` apart; the common element
+ * sizes get a fixed-size copy the compiler turns into plain moves
+ */
+static void glimpl_gather(void *dst, const unsigned char *src, int count, int stride, size_t elem_size)
+{
+    unsigned char *out = dst;
+
+    switch (elem_size) {
+    case 4:  GLIMPL_GATHER(4);  break;
+    case 8:  GLIMPL_GATHER(8);  break;
+    case 12: GLIMPL_GATHER(12); break;
+    case 16: GLIMPL_GATHER(16); break;
+    default: GLIMPL_GATHER(elem_size); break;
+    }
+}
+
+/*
+ * client arrays and indices of at least this many bytes go through
+ * the server's upload cache, smaller ones are cheaper to send again
+ */
+#define GLIMPL_UPLOAD_CACHE_MIN_SIZE 4096
+
+/*
+ * an array whose contents have changed this many times is streamed
+ * and left out of the cache, it would only churn it
+ */
+#define GLIMPL_UPLOAD_CACHE_MAX_CHANGES 4
+
+/*
+ * slots evicted per upload, few enough for the drop to fit in the
+ * headroom reserved for each array
+ */
+#define GLIMPL_UPLOAD_CACHE_MAX_EVICT 8
+
+#define GLIMPL_UPLOAD_CACHE_BUCKETS 2048
+
+/*
+ * the client owns the cache: it looks arrays up by where they are and
+ * how big, picks the slot and decides what to evict, and the server
+ * only stores and drops what it's told. entries are indexed by slot
+ */
+struct glimpl_upload_cache_entry {
+    const void *pointer;
+    size_t size;
+    uint64_t hash;
+    unsigned int draw;      /* last draw that used it, it can't be evicted during that one */
+    int changes;
+    bool dynamic;           /* streamed, the server holds nothing for it */
+    int prev, next;         /* lru order, most recently used first; next also links free slots */
+    int chain;              /* next entry in the same bucket */
+};
+
+static struct {
+    struct glimpl_upload_cache_entry entries[SGL_UPLOAD_CACHE_SLOTS];
+    int buckets[GLIMPL_UPLOAD_CACHE_BUCKETS];
+    int head, tail, free;
+    size_t used;
+    unsigned int draw;
+    bool initialized;
+} glimpl_upload_cache;
+
+static void glimpl_upload_cache_init(void)
+{
+    for (int i = 0; i < GLIMPL_UPLOAD_CACHE_BUCKETS; i++)
+        glimpl_upload_cache.buckets[i] = -1;
+    for (int i = 0; i < SGL_UPLOAD_CACHE_SLOTS; i++)
+        glimpl_upload_cache.entries[i].next = i + 1 < SGL_UPLOAD_CACHE_SLOTS ? i + 1 : -1;
+
+    glimpl_upload_cache.head = -1;
+    glimpl_upload_cache.tail = -1;
+    glimpl_upload_cache.free = 0;
+    glimpl_upload_cache.initialized = true;
+}
+
+static inline int *glimpl_upload_cache_bucket(const void *pointer, size_t size)
+{
+    uint64_t key = ((uint64_t)(uintptr_t)pointer ^ ((uint64_t)size << 32)) * SGL_HASH_PRIME_1;
+    return &glimpl_upload_cache.buckets[key >> 53 & (GLIMPL_UPLOAD_CACHE_BUCKETS - 1)];
+}
+
+static int glimpl_upload_cache_find(const void *pointer, size_t size)
+{
+    for (int slot = *glimpl_upload_cache_bucket(pointer, size); slot >= 0; slot = glimpl_upload_cache.entries[slot].chain)
+        if (glimpl_upload_cache.entries[slot].pointer == pointer && glimpl_upload_cache.entries[slot].size == size)
+            return slot;
+    return -1;
+}
+
+static void glimpl_upload_cache_unlink(int slot)
+{
+    struct glimpl_upload_cache_entry *entry = &glimpl_upload_cache.entries[slot];
+
+    if (entry->prev >= 0)
+        glimpl_upload_cache.entries[entry->prev].next = entry->next;
+    else
+        glimpl_upload_cache.head = entry->next;
+
+    if (entry->next >= 0)
+        glimpl_upload_cache.entries[entry->next].prev = entry->prev;
+    else
+        glimpl_upload_cache.tail = entry->prev;
+}
+
+/*
+ * most recently used, and pinned for the rest of the current draw
+ */
+static void glimpl_upload_cache_touch(int slot, bool linked)
+{
+    struct glimpl_upload_cache_entry *entry = &glimpl_upload_cache.entries[slot];
+
+    if (linked)
+        glimpl_upload_cache_unlink(slot);
+
+    entry->prev = -1;
+    entry->next = glimpl_upload_cache.head;
+    if (glimpl_upload_cache.head >= 0)
+        glimpl_upload_cache.entries[glimpl_upload_cache.head].prev = slot;
+    else
+        glimpl_upload_cache.tail = slot;
+    glimpl_upload_cache.head = slot;
+
+    entry->draw = glimpl_upload_cache.draw;
+}
+
+static void glimpl_upload_cache_remove(int slot)
+{
+    struct glimpl_upload_cache_entry *entry = &glimpl_upload_cache.entries[slot];
+    int *link = glimpl_upload_cache_bucket(entry->pointer, entry->size);
+
+    while (*link != slot)
+        link = &glimpl_upload_cache.entries[*link].chain;
+    *link = entry->chain;
+
+    glimpl_upload_cache_unlink(slot);
+    if (!entry->dynamic)
+        glimpl_upload_cache.used -= entry->size;
+
+    entry->next = glimpl_upload_cache.free;
+    glimpl_upload_cache.free = slot;
+}
+
+static void glimpl_push_upload_cache_drop(const int *slots, int count)
+{
+    int *cur = glimpl_begin(2 + count);
+    *cur++ = SGL_CMD_VP_CACHE_DROP;
+    *cur++ = count;
+    for (int i = 0; i < count; i++)
+        *cur++ = slots[i];
+}
+
+/*
+ * a slot for a new array, evicting the least recently used until it
+ * fits the budget; -1 if it doesn't yet, the array is sent uncached
+ */
+static int glimpl_upload_cache_insert(const void *pointer, size_t size, uint64_t hash)
+{
+    int dropped[GLIMPL_UPLOAD_CACHE_MAX_EVICT];
+    int dropped_count = 0;
+
+    while (glimpl_upload_cache.free < 0 || glimpl_upload_cache.used + size > glimpl_upload_cache_budget) {
+        int victim = glimpl_upload_cache.tail;
+        if (victim < 0 || dropped_count == GLIMPL_UPLOAD_CACHE_MAX_EVICT ||
+                glimpl_upload_cache.entries[victim].draw == glimpl_upload_cache.draw)
+            break;
+
+        if (!glimpl_upload_cache.entries[victim].dynamic)
+            dropped[dropped_count++] = victim;
+        glimpl_upload_cache_remove(victim);
+    }
+
+    if (dropped_count > 0)
+        glimpl_push_upload_cache_drop(dropped, dropped_count);
+
+    if (glimpl_upload_cache.free < 0 || glimpl_upload_cache.used + size > glimpl_upload_cache_budget)
+        return -1;
+
+    int slot = glimpl_upload_cache.free;
+    struct glimpl_upload_cache_entry *entry = &glimpl_upload_cache.entries[slot];
+    int *bucket = glimpl_upload_cache_bucket(pointer, size);
+
+    glimpl_upload_cache.free = entry->next;
+    *entry = (struct glimpl_upload_cache_entry){ 0 };
+    entry->pointer = pointer;
+    entry->size = size;
+    entry->hash = hash;
+    entry->chain = *bucket;
+    *bucket = slot;
+
+    glimpl_upload_cache_touch(slot, false);
+    glimpl_upload_cache.used += size;
+    return slot;
+}
+
+static inline void glimpl_push_upload_cache_slot(int cmd, int slot)
+{
+    int *cur = glimpl_begin(2);
+    *cur++ = cmd;
+    *cur++ = slot;
+}
+
+/*
+ * upload the bytes an array or the indices of a draw are sourced from,
+ * or have the server reuse its copy if they haven't changed since
+ */
+static void glimpl_push_array_upload(const void *data, size_t size)
+{
+    if (size < GLIMPL_UPLOAD_CACHE_MIN_SIZE || size > glimpl_upload_cache_budget / 4) {
+        glimpl_upload_buffer(data, size);
+        return;
+    }
+
+    if (!glimpl_upload_cache.initialized)
+        glimpl_upload_cache_init();
+
+    int slot = glimpl_upload_cache_find(data, size);
+    if (slot < 0) {
+        slot = glimpl_upload_cache_insert(data, size, sgl_hash(data, size, 0));
+        glimpl_upload_buffer(data, size);
+        if (slot >= 0)
+            glimpl_push_upload_cache_slot(SGL_CMD_VP_CACHE_STORE, slot);
+        return;
+    }
+
+    struct glimpl_upload_cache_entry *entry = &glimpl_upload_cache.entries[slot];
+    glimpl_upload_cache_touch(slot, true);
+
+    if (entry->dynamic) {
+        glimpl_upload_buffer(data, size);
+        return;
+    }
+
+    uint64_t hash = sgl_hash(data, size, 0);
+    if (hash == entry->hash) {
+        glimpl_push_upload_cache_slot(SGL_CMD_VP_CACHE_USE, slot);
+        return;
+    }
+
+    if (++entry->changes == GLIMPL_UPLOAD_CACHE_MAX_CHANGES) {
+        entry->dynamic = true;
+        glimpl_upload_cache.used -= size;
+        glimpl_push_upload_cache_drop(&slot, 1);
+        glimpl_upload_buffer(data, size);
+        return;
+    }
+
+    entry->hash = hash;
+    glimpl_upload_buffer(data, size);
+    glimpl_push_upload_cache_slot(SGL_CMD_VP_CACHE_STORE, slot);
+}
+
+/*
+ * stride and pointer come in as the application set them and go out
+ * as they should be sent, relative to the upload if one was made; an
+ * upload only holds elements [first, first + count), so arrays are
+ * pointed `first` elements before its start
+ */
+static inline bool glimpl_push_client_pointer(bool client_managed, int first, int count, int size, int type, int *stride, int64_t *pointer)
+{
+    const unsigned char *data = (const unsigned char*)(uintptr_t)*pointer;
+    size_t elem_size = (size_t)size * glimpl_type_size(type);
+    size_t byte_count = elem_size * count;
+
+    if (!client_managed)
+        return false;
+
+    int span_index = glimpl_get_array_span(data, *stride);
+    if (span_index >= 0) {
+        struct glimpl_array_span *span = &glimpl_array_spans[span_index];
+
+        if (glimpl_uploaded_span != span_index) {
+            glimpl_push_array_upload(span->base + (size_t)first * span->stride, glimpl_array_span_upload_size(span, count));
+            glimpl_uploaded_span = span_index;
+        }
+
+        *pointer = (int64_t)(data - span->base) - (int64_t)first * span->stride;
+        return true;
+    }
+
+    glimpl_uploaded_span = -1;
+
+    if (*stride == 0 || (size_t)*stride == elem_size) {
+        glimpl_push_array_upload(data + ((size_t)first * elem_size), byte_count);
+    }
+    else {
+        glimpl_begin_upload(CEIL_DIV(byte_count, sizeof(int)), GLIMPL_UPLOAD_HEADROOM / sizeof(int));
+
+        const unsigned char *base = data + ((size_t)first * *stride);
+        int *dst = pb_reserve(CEIL_DIV(byte_count, sizeof(int)));
+
+        if (dst != NULL) {
+            glimpl_gather(dst, base, count, *stride, elem_size);
+        }
+        else {
+            for (int i = 0; i < count; i++)
+                pb_memcpy_unaligned(base + (size_t)i * *stride, elem_size);
+            pb_realign();
+        }
+    }
+
+    *stride = 0;
+    *pointer = -(int64_t)first * (int64_t)elem_size;
+    return true;
+}
+
+static inline int glimpl_vertex_attrib_cmd(const struct gl_vertex_attrib_pointer *vap)
+{
+    switch (vap->kind) {
+    case GLIMPL_VERTEX_ATTRIB_POINTER_INT:
+        return SGL_CMD_VERTEXATTRIBIPOINTER;
+    case GLIMPL_VERTEX_ATTRIB_POINTER_LONG:
+        return SGL_CMD_VERTEXATTRIBLPOINTER;
+    case GLIMPL_VERTEX_ATTRIB_POINTER_FLOAT:
+    default:
+        return SGL_CMD_VERTEXATTRIBPOINTER;
+    }
+}
+
+static inline void glimpl_push_vertex_attrib_pointers(int first, int count)
+{
+    for (int i = 0; i < GLIMPL_MAX_OBJECTS; i++) {
+        struct gl_vertex_attrib_pointer *vap = &glimpl_vaps[i];
+        if (vap->enabled && vap->client_managed) {
+            int stride = vap->stride;
+            int64_t pointer = (int64_t)(uintptr_t)vap->ptr;
+            bool use_upload = glimpl_push_client_pointer(vap->client_managed, first, count, vap->size, vap->type, &stride, &pointer);
+
+            glimpl_push_command(glimpl_vertex_attrib_cmd(vap));
+            pb_push(vap->index);
+            pb_push(vap->size);
+            pb_push(vap->type);
+            if (vap->kind == GLIMPL_VERTEX_ATTRIB_POINTER_FLOAT)
+                pb_push(vap->normalized);
+            pb_push(stride);
+            pb_push64(pointer);
+            pb_push(use_upload);
+        }
+    }
+}
+
+static inline void glimpl_push_client_pointers(int first, int count)
+{
+    int *cur;
+    int last_tex_coord_unit = -1;
+    int stride;
+    int64_t pointer;
+
+    if (glimpl_normal_ptr.in_use) {
+        stride = glimpl_normal_ptr.stride;
+        pointer = (int64_t)(uintptr_t)glimpl_normal_ptr.pointer;
+        bool status = glimpl_push_client_pointer(glimpl_normal_ptr.client_managed, first, count, 3,
+                            glimpl_normal_ptr.type, &stride, &pointer);
+
+        cur = glimpl_begin(4);
+        *cur++ = SGL_CMD_NORMALPOINTER;
+        *cur++ = glimpl_normal_ptr.type;
+        *cur++ = stride;
+        *cur++ = status;
+        pb_push64(pointer);
+    }
+
+    if (glimpl_color_ptr.in_use) {
+        int true_size = glimpl_get_legacy_color_array_size(glimpl_color_ptr.size);
+
+        stride = glimpl_color_ptr.stride;
+        pointer = (int64_t)(uintptr_t)glimpl_color_ptr.pointer;
+        bool status = glimpl_push_client_pointer(glimpl_color_ptr.client_managed, first, count, true_size,
+                            glimpl_color_ptr.type, &stride, &pointer);
+
+        cur = glimpl_begin(5);
+        *cur++ = SGL_CMD_COLORPOINTER;
+        *cur++ = glimpl_color_ptr.size;
+        *cur++ = glimpl_color_ptr.type;
+        *cur++ = stride;
+        *cur++ = status;
+        pb_push64(pointer);
+    }
+
+    for (int t = 0; t < GLIMPL_MAX_TEXTURES; t++) {
+        if (glimpl_tex_coord_ptr[t].in_use) {
+            stride = glimpl_tex_coord_ptr[t].stride;
+            pointer = (int64_t)(uintptr_t)glimpl_tex_coord_ptr[t].pointer;
+            bool status = glimpl_push_client_pointer(glimpl_tex_coord_ptr[t].client_managed, first, count, glimpl_tex_coord_ptr[t].size,
+                                glimpl_tex_coord_ptr[t].type, &stride, &pointer);
+
+            cur = glimpl_begin(2);
+            *cur++ = SGL_CMD_CLIENTACTIVETEXTURE;
+            *cur++ = GL_TEXTURE0 + t;
+            last_tex_coord_unit = t;
+
+            cur = glimpl_begin(2);
+            *cur++ = SGL_CMD_ENABLECLIENTSTATE;
+            *cur++ = GL_TEXTURE_COORD_ARRAY;
+
+            cur = glimpl_begin(5);
+            *cur++ = SGL_CMD_TEXCOORDPOINTER;
+            *cur++ = glimpl_tex_coord_ptr[t].size;
+            *cur++ = glimpl_tex_coord_ptr[t].type;
+            *cur++ = stride;
+            *cur++ = status;
+            pb_push64(pointer);
+        }
+    }
+
+    if (last_tex_coord_unit >= 0 && last_tex_coord_unit != glimpl_client_active_texture) {
+        cur = glimpl_begin(2);
+        *cur++ = SGL_CMD_CLIENTACTIVETEXTURE;
+        *cur++ = GL_TEXTURE0 + glimpl_client_active_texture;
+    }
+
+    if (glimpl_vertex_ptr.in_use) {
+        stride = glimpl_vertex_ptr.stride;
+        pointer = (int64_t)(uintptr_t)glimpl_vertex_ptr.pointer;
+        bool status = glimpl_push_client_pointer(glimpl_vertex_ptr.client_managed, first, count, glimpl_vertex_ptr.size,
+                            glimpl_vertex_ptr.type, &stride, &pointer);
+
+        cur = glimpl_begin(5);
+        *cur++ = SGL_CMD_VERTEXPOINTER;
+        *cur++ = glimpl_vertex_ptr.size;
+        *cur++ = glimpl_vertex_ptr.type;
+        *cur++ = stride;
+        *cur++ = status;
+        pb_push64(pointer);
+    }
+}
+
+static bool glimpl_has_client_managed_draw_state(void)
+{
+    for (int i = 0; i < GLIMPL_MAX_OBJECTS; i++)
+        if (glimpl_vaps[i].enabled && glimpl_vaps[i].client_managed)
+            return true;
+
+    if (glimpl_normal_ptr.in_use && glimpl_normal_ptr.client_managed)
+        return true;
+    if (glimpl_color_ptr.in_use && glimpl_color_ptr.client_managed)
+        return true;
+    if (glimpl_vertex_ptr.in_use && glimpl_vertex_ptr.client_managed)
+        return true;
+
+    for (int i = 0; i < GLIMPL_MAX_TEXTURES; i++)
+        if (glimpl_tex_coord_ptr[i].in_use && glimpl_tex_coord_ptr[i].client_managed)
+            return true;
+
+    return false;
+}
+
+/*
+ * arrays in a shared span are counted once, with the span
+ */
+static inline size_t glimpl_client_pointer_upload_size(bool in_use, bool client_managed, int count, int size, int type, const void *pointer, int stride)
+{
+    if (!in_use || !client_managed || glimpl_get_array_span(pointer, stride) >= 0)
+        return 0;
+    return (size_t)count * (size_t)size * glimpl_type_size(type);
+}
+
+/*
+ * upper bound on what glimpl_push_client_managed_draw_state records,
+ * including the draw itself
+ */
+static size_t glimpl_client_managed_draw_state_size(int count)
+{
+    size_t size = GLIMPL_UPLOAD_HEADROOM;
+
+    glimpl_find_array_spans();
+    for (int i = 0; i < glimpl_array_span_count; i++)
+        if (glimpl_array_spans[i].members > 1)
+            size += GLIMPL_UPLOAD_HEADROOM / 2 + glimpl_array_span_upload_size(&glimpl_array_spans[i], count);
+
+    for (int i = 0; i < GLIMPL_MAX_OBJECTS; i++)
+        if (glimpl_vaps[i].enabled && glimpl_vaps[i].client_managed)
+            size += GLIMPL_UPLOAD_HEADROOM / 2 + glimpl_client_pointer_upload_size(true, true, count, glimpl_vaps[i].size, glimpl_vaps[i].type,
+                        glimpl_vaps[i].ptr, glimpl_vaps[i].stride);
+
+    size += GLIMPL_UPLOAD_HEADROOM / 2 + glimpl_client_pointer_upload_size(glimpl_normal_ptr.in_use, glimpl_normal_ptr.client_managed, count, 3, glimpl_normal_ptr.type,
+                glimpl_normal_ptr.pointer, glimpl_normal_ptr.stride);
+    size += GLIMPL_UPLOAD_HEADROOM / 2 + glimpl_client_pointer_upload_size(glimpl_color_ptr.in_use, glimpl_color_ptr.client_managed, count,
+                glimpl_get_legacy_color_array_size(glimpl_color_ptr.size), glimpl_color_ptr.type, glimpl_color_ptr.pointer, glimpl_color_ptr.stride);
+    size += GLIMPL_UPLOAD_HEADROOM / 2 + glimpl_client_pointer_upload_size(glimpl_vertex_ptr.in_use, glimpl_vertex_ptr.client_managed, count, glimpl_vertex_ptr.size, glimpl_vertex_ptr.type,
+                glimpl_vertex_ptr.pointer, glimpl_vertex_ptr.stride);
+
+    for (int t = 0; t < GLIMPL_MAX_TEXTURES; t++)
+        if (glimpl_tex_coord_ptr[t].in_use)
+            size += GLIMPL_UPLOAD_HEADROOM / 2 + glimpl_client_pointer_upload_size(true, glimpl_tex_coord_ptr[t].client_managed, count,
+                        glimpl_tex_coord_ptr[t].size, glimpl_tex_coord_ptr[t].type, glimpl_tex_coord_ptr[t].pointer, glimpl_tex_coord_ptr[t].stride);
+
+    return size;
+}
+
+/*
+ * the pointers set by the draw state point into the push buffer, so
+ * the state and the draw using it must land in the same submit; only
+ * vertices [first, first + count) are uploaded
+ */
+static inline void glimpl_push_client_managed_draw_state(int first, int count)
+{
+    int *cur;
+    bool has_client_managed_draw_state = glimpl_has_client_managed_draw_state();
+
+    count = MAX(count, 0);
+    glimpl_upload_cache.draw++;
+
+    glimpl_reserve(glimpl_client_managed_draw_state_size(count));
+    bool restore_array_buffer_binding = has_client_managed_draw_state && glimpl_array_buffer_binding != 0;
+
+    if (restore_array_buffer_binding) {
+        cur = glimpl_begin(3);
+        *cur++ = SGL_CMD_BINDBUFFER;
+        *cur++ = GL_ARRAY_BUFFER;
+        *cur++ = 0;
+    }
+
+    glimpl_push_vertex_attrib_pointers(first, count);
+    glimpl_push_client_pointers(first, count);
+
+    if (restore_array_buffer_binding) {
+        cur = glimpl_begin(3);
+        *cur++ = SGL_CMD_BINDBUFFER;
+        *cur++ = GL_ARRAY_BUFFER;
+        *cur++ = glimpl_array_buffer_binding;
+    }
+}
+
+/*
+ * lowest and highest index referenced, so only the vertices between
+ * them have to be uploaded
+ */
+static void glimpl_get_index_range(int type, int count, const void *indices, unsigned int *min_index, unsigned int *max_index)
+{
+    unsigned int lo = count > 0 ? ~0u : 0, hi = 0;
 
     switch (type) {
     case GL_UNSIGNED_BYTE: {
         const unsigned char *tindices = indices;
-        for (int i = 0; i < count; i++)
-            max_index = MAX(max_index, tindices[i]);
+        for (int i = 0; i < count; i++) {
+            lo = MIN(lo, tindices[i]);
+            hi = MAX(hi, tindices[i]);
+        }
         break;
     }
     case GL_UNSIGNED_SHORT: {
         const unsigned short *tindices = indices;
-        for (int i = 0; i < count; i++)
-            max_index = MAX(max_index, tindices[i]);
+        for (int i = 0; i < count; i++) {
+            lo = MIN(lo, tindices[i]);
+            hi = MAX(hi, tindices[i]);
+        }
         break;
     }
     case GL_UNSIGNED_INT: {
         const unsigned int *tindices = indices;
-        for (int i = 0; i < count; i++)
-            max_index = MAX(max_index, tindices[i]);
+        for (int i = 0; i < count; i++) {
+            lo = MIN(lo, tindices[i]);
+            hi = MAX(hi, tindices[i]);
+        }
         break;
     }
     default:
         STUB();
+        lo = 0;
         break;
     }
 
-    return max_index;
+    *min_index = lo;
+    *max_index = hi;
 }
 
-static bool glimpl_prepare_draw_elements(int count, int type, const void *indices, int vertex_upload_count_hint, bool *use_upload, uint64_t *index_pointer)
+/*
+ * start and end are the index range promised by the application, end
+ * is negative without one; basevertex shifts it like it does the draw
+ */
+static bool glimpl_prepare_draw_elements(int count, int type, const void *indices, int start, int end, int basevertex, bool *use_upload, uint64_t *index_pointer)
 {
     bool element_array_buffer_bound = glimpl_get_element_array_buffer_binding() != 0;
 
     if (element_array_buffer_bound) {
         if (glimpl_has_client_managed_draw_state()) {
-            if (vertex_upload_count_hint < 0) {
+            if (end < 0) {
                 fprintf(stderr, "glDrawElements: client-managed arrays with element-array-buffer offsets are unsupported without an index range hint\n");
                 return false;
             }
 
-            glimpl_push_client_managed_draw_state(0, vertex_upload_count_hint);
+            int first = MAX(start + basevertex, 0);
+            glimpl_push_client_managed_draw_state(first, end + basevertex + 1 - first);
         }
 
         *use_upload = false;
@@ -1285,31 +2773,130 @@ static bool glimpl_prepare_draw_elements(int count, int type, const void *indice
         return true;
     }
 
-    unsigned int max_index = glimpl_get_max_index(type, count, indices) + 1;
-    glimpl_push_client_managed_draw_state(0, max_index);
-    glimpl_upload_buffer(indices, (size_t)count * glimpl_type_size(type));
+    unsigned int min_index, max_index;
+    glimpl_get_index_range(type, count, indices, &min_index, &max_index);
+
+    int first = MAX((int)min_index + basevertex, 0);
+    int vertices = (int)max_index + basevertex + 1 - first;
+    size_t index_size = (size_t)count * glimpl_type_size(type);
+    glimpl_reserve(glimpl_client_managed_draw_state_size(vertices) + index_size);
+    glimpl_push_client_managed_draw_state(first, vertices);
+    glimpl_push_array_upload(indices, index_size);
 
     *use_upload = true;
     *index_pointer = 0;
     return true;
 }
 
-static inline void glimpl_draw_elements(int mode, int type, int count, const void *indices, int vertex_upload_count_hint)
+static inline void glimpl_draw_elements(int mode, int type, int count, const void *indices, int start, int end)
 {
     bool use_upload;
     uint64_t index_pointer;
 
-    if (!glimpl_prepare_draw_elements(count, type, indices, vertex_upload_count_hint, &use_upload, &index_pointer))
+    if (!glimpl_prepare_draw_elements(count, type, indices, start, end, 0, &use_upload, &index_pointer))
         return;
 
-    pb_push(SGL_CMD_DRAWELEMENTS);
-    pb_push(mode);
-    pb_push(count);
-    pb_push(type);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_DRAWELEMENTS;
+    *cur++ = mode;
+    *cur++ = count;
+    *cur++ = type;
     pb_push64(index_pointer);
     pb_push(use_upload);
 }
 
+/*
+ * whether a batch of draws covering `vertices` vertices between them
+ * can upload client arrays as the one range [lo, hi) without sending
+ * much that none of them read
+ */
+static inline bool glimpl_multidraw_dense(int lo, int hi, size_t vertices)
+{
+    return (size_t)(hi - lo) <= 2 * vertices + 1024;
+}
+
+/*
+ * one command per batch of up to SGL_MULTIDRAW_MAX draws; client
+ * indices are uploaded back to back, each starting on a whole word,
+ * and the arrays once for the union of the batch's vertex ranges
+ */
+static void glimpl_multi_draw_elements(int cmd, GLenum mode, const GLsizei *count, GLenum type,
+        const void *const *indices, GLsizei drawcount, const GLint *basevertex)
+{
+    bool client_managed = glimpl_has_client_managed_draw_state();
+    bool use_upload = glimpl_get_element_array_buffer_binding() == 0;
+    int words = basevertex != NULL ? 4 : 3; /* count, basevertex, 64-bit pointer */
+    size_t index_size = glimpl_type_size(type);
+    unsigned int min_index, max_index;
+    int *cur;
+
+    if (!use_upload && client_managed) {
+        fprintf(stderr, "glMultiDrawElements: client-managed arrays with element-array-buffer offsets are unsupported\n");
+        return;
+    }
+
+    for (int start = 0; start < drawcount;) {
+        int n = 0, lo = 0, hi = 0;
+        size_t vertices = 0, upload_words = 0;
+
+        for (; start + n < drawcount && n < SGL_MULTIDRAW_MAX; n++) {
+            int i = start + n;
+            if (!use_upload || count[i] <= 0 || indices[i] == NULL)
+                continue;
+
+            int base = basevertex != NULL ? basevertex[i] : 0;
+            glimpl_get_index_range(type, count[i], indices[i], &min_index, &max_index);
+
+            int draw_lo = MAX((int)min_index + base, 0);
+            int draw_hi = MAX((int)max_index + base + 1, draw_lo);
+            int new_lo = vertices == 0 ? draw_lo : MIN(lo, draw_lo);
+            int new_hi = vertices == 0 ? draw_hi : MAX(hi, draw_hi);
+            if (client_managed && vertices != 0 && !glimpl_multidraw_dense(new_lo, new_hi, vertices + (draw_hi - draw_lo)))
+                break;
+
+            lo = new_lo;
+            hi = new_hi;
+            vertices += draw_hi - draw_lo;
+            upload_words += CEIL_DIV((size_t)count[i] * index_size, sizeof(int));
+        }
+
+        if (use_upload) {
+            glimpl_reserve(glimpl_client_managed_draw_state_size(hi - lo) + (upload_words + 5 + (size_t)words * n) * sizeof(int));
+            glimpl_push_client_managed_draw_state(lo, hi - lo);
+
+            cur = glimpl_begin(2);
+            *cur++ = SGL_CMD_VP_UPLOAD;
+            *cur++ = upload_words;
+            for (int i = start; i < start + n; i++)
+                if (count[i] > 0 && indices[i] != NULL)
+                    pb_memcpy(indices[i], (size_t)count[i] * index_size);
+        }
+
+        cur = glimpl_begin(5 + (size_t)words * n);
+        *cur++ = cmd;
+        *cur++ = mode;
+        *cur++ = type;
+        *cur++ = n;
+        *cur++ = use_upload;
+
+        int64_t offset = 0;
+        for (int i = start; i < start + n; i++)
+            *cur++ = use_upload && indices[i] == NULL ? 0 : count[i];
+        for (int i = start; basevertex != NULL && i < start + n; i++)
+            *cur++ = basevertex[i];
+        for (int i = start; i < start + n; i++) {
+            int64_t pointer = use_upload ? offset : (int64_t)(uintptr_t)indices[i];
+            memcpy(cur, &pointer, sizeof(pointer));
+            cur += 2;
+
+            if (use_upload && count[i] > 0 && indices[i] != NULL)
+                offset += CEIL_DIV((size_t)count[i] * index_size, sizeof(int)) * sizeof(int);
+        }
+
+        start += n;
+    }
+}
+
 static void glimpl_texture_image(int cmd, int n_dims, GLuint texture, GLint level, GLint internalformat,
         GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
 {
@@ -1317,7 +2904,7 @@ static void glimpl_texture_image(int cmd, int n_dims, GLuint texture, GLint leve
 
     glimpl_upload_texture(width, n_dims > 1 ? height : 1, n_dims > 2 ? depth : 1, format, type, pixels);
 
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(texture);
     pb_push(level);
     pb_push(internalformat);
@@ -1336,7 +2923,7 @@ static void glimpl_texture_subimage(int cmd, int n_dims, GLuint texture, GLint l
 
     glimpl_upload_texture(width, n_dims > 1 ? height : 1, n_dims > 2 ? depth : 1, format, type, pixels);
 
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(texture);
     pb_push(level);
     for (int i = 0; i < n_dims; i++)
@@ -1353,9 +2940,9 @@ static void glimpl_compressed_texture_subimage(int cmd, int n_dims, GLuint textu
     const int offsets[3] = { xoffset, yoffset, zoffset };
     const int dims[3] = { width, height, depth };
 
-    glimpl_upload_buffer((void*)data, imageSize);
+    glimpl_upload_asset(data, imageSize);
 
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(texture);
     pb_push(level);
     for (int i = 0; i < n_dims; i++)
@@ -1369,9 +2956,9 @@ static void glimpl_compressed_texture_subimage(int cmd, int n_dims, GLuint textu
 static void glimpl_buffer_store_data(int cmd, GLuint buffer, GLsizeiptr size, const void *data, GLenum usage)
 {
     if (data != NULL)
-        glimpl_upload_buffer(data, size);
+        glimpl_upload_asset(data, size);
     
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(buffer);
     pb_push(size);
     pb_push(data != NULL);
@@ -1380,9 +2967,9 @@ static void glimpl_buffer_store_data(int cmd, GLuint buffer, GLsizeiptr size, co
 
 static void glimpl_buffer_subdata(int cmd, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
 {
-    glimpl_upload_buffer(data, size);
+    glimpl_upload_asset(data, size);
     
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(buffer);
     pb_push(offset);
     pb_push(size);
@@ -1391,7 +2978,7 @@ static void glimpl_buffer_subdata(int cmd, GLuint buffer, GLintptr offset, GLsiz
 static void glimpl_buffer_clear_data(int cmd, bool is_subdata, GLenum buffer, GLenum internalformat, GLintptr offset, 
         GLsizeiptr size, GLenum format, GLenum type, const void* data)
 {
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(buffer);
     pb_push(internalformat);
 
@@ -1407,7 +2994,7 @@ static void glimpl_buffer_clear_data(int cmd, bool is_subdata, GLenum buffer, GL
 
 static void glimpl_get_buffer_parameter(int cmd, GLuint buffer, GLenum pname, GLint* params)
 {
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(buffer);
     pb_push(pname);
 
@@ -1446,7 +3033,7 @@ static void *glimpl_map_buffer_range(int cmd, GLenum buffer, GLintptr offset, GL
      * this function supports both glMapBuffer and glMapBufferRange; as such, these functions have
      * different parameters to be pushed
      */
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     if (ranged) {
         pb_push(buffer);
         pb_push(offset);
@@ -1458,8 +3045,6 @@ static void *glimpl_map_buffer_range(int cmd, GLenum buffer, GLintptr offset, GL
         pb_push(access);
     }
 
-    glimpl_submit();
-
     glimpl_download_buffer(glimpl_map_buffer.mem, length);
 
     return glimpl_map_buffer.mem;
@@ -1474,7 +3059,7 @@ static inline bool glimpl_unmap_buffer(int cmd, int buffer)
 
     glimpl_upload_buffer(glimpl_map_buffer.mem, glimpl_map_buffer.length);
 
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(buffer);
     pb_push(glimpl_map_buffer.length); // internal
 
@@ -1487,7 +3072,7 @@ static inline void glimpl_flush_mapped_buffer_range(int cmd, int buffer, int off
 {
     glimpl_upload_buffer((char*)glimpl_map_buffer.mem + offset, length);
     
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(buffer);
     pb_push(offset);
     pb_push(length);
@@ -1497,7 +3082,7 @@ static void glimpl_invalidate_framebuffer(int cmd, bool is_subframebuffer, GLenu
         const GLenum *attachments, int x, int y, int width, int height)
 {
     glimpl_upload_buffer(attachments, n_attachments * sizeof(*attachments));
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(framebuffer);
     pb_push(n_attachments);
 
@@ -1517,7 +3102,7 @@ static void glimpl_invalidate_framebuffer(int cmd, bool is_subframebuffer, GLenu
 
 static void glimpl_clear_buffer(int cmd, bool is_framebuffer, GLenum type, GLuint framebuffer, GLenum buffer, GLint drawbuffer, void *value)
 {
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     if (is_framebuffer)
         pb_push(framebuffer);
     pb_push(buffer);
@@ -1546,7 +3131,7 @@ static void glimpl_clear_buffer(int cmd, bool is_framebuffer, GLenum type, GLuin
 
 static void glimpl_get_framebuffer_parameter(int cmd, bool is_attachment, GLenum framebuffer, GLenum attachment, GLenum pname, GLint* params)
 {
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(framebuffer);
     if (is_attachment)
         pb_push(attachment);
@@ -1558,7 +3143,7 @@ static void glimpl_get_framebuffer_parameter(int cmd, bool is_attachment, GLenum
 
 static void glimpl_get_renderbuffer_parameter(int cmd, GLuint renderbuffer, GLenum pname, GLint* params)
 {
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(renderbuffer);
     pb_push(pname);
 
@@ -1568,7 +3153,7 @@ static void glimpl_get_renderbuffer_parameter(int cmd, GLuint renderbuffer, GLen
 
 static void glimpl_texture_parameter_v(int cmd, GLenum texture, GLenum pname, const void *params)
 {
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(texture);
     pb_push(pname);
     if (pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA)
@@ -1583,7 +3168,7 @@ static void glimpl_texture_parameter_v(int cmd, GLenum texture, GLenum pname, co
 
 static void glimpl_get_texture_level_parameter(int cmd, GLenum texture, GLint level, GLenum pname, void *params)
 {
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(texture);
     pb_push(level);
     pb_push(pname);
@@ -1594,7 +3179,7 @@ static void glimpl_get_texture_level_parameter(int cmd, GLenum texture, GLint le
 
 static void glimpl_get_texture_parameter(int cmd, GLenum texture, GLenum pname, void *params)
 {
-    pb_push(cmd);
+    glimpl_push_command(cmd);
     pb_push(texture);
     pb_push(pname);
 
@@ -1606,26 +3191,39 @@ static void glimpl_get_texture_parameter(int cmd, GLenum texture, GLenum pname,
 
 void glAttachShader(GLuint program, GLuint shader)
 {
-    pb_push(SGL_CMD_ATTACHSHADER);
-    pb_push(program);
-    pb_push(shader);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_ATTACHSHADER;
+    *cur++ = program;
+    *cur++ = shader;
 }
 
 void glBegin(GLenum mode) 
 {
-    pb_push(SGL_CMD_BEGIN);
-    pb_push(mode);
+    /*
+     * display lists record what they're sent, keep those verbatim
+     */
+    if (!glimpl_immediate.recording && glimpl_list_mode == 0 && mode <= GL_POLYGON) {
+        glimpl_immediate_start(mode);
+        return;
+    }
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_BEGIN;
+    *cur++ = mode;
 }
 
 void glBeginQuery(GLenum target, GLuint id)
 {
-    pb_push(SGL_CMD_BEGINQUERY);
-    pb_push(target);
-    pb_push(id);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BEGINQUERY;
+    *cur++ = target;
+    *cur++ = id;
 }
 
 void glBindBuffer(GLenum target, GLuint buffer)
 {
+    glimpl_name_reserve(&glimpl_buffer_names, buffer);
+
     switch (target) {
     case GL_ARRAY_BUFFER:
         glimpl_array_buffer_binding = buffer;
@@ -1636,33 +3234,43 @@ void glBindBuffer(GLenum target, GLuint buffer)
     case GL_DRAW_INDIRECT_BUFFER:
         glimpl_draw_indirect_buffer_binding = buffer;
         break;
+    case GL_PIXEL_PACK_BUFFER:
+        glimpl_pixel_pack_buffer_binding = buffer;
+        break;
     default:
         break;
     }
 
-    pb_push(SGL_CMD_BINDBUFFER);
-    pb_push(target);
-    pb_push(buffer);
+    if (glimpl_filter_state(SGL_CMD_BINDBUFFER, glimpl_shadow_matches1(glimpl_buffer_binding_pname(target), buffer)))
+        return;
+
+    glimpl_shadow_set1(glimpl_buffer_binding_pname(target), buffer);
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDBUFFER;
+    *cur++ = target;
+    *cur++ = buffer;
 }
 
 void glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count); /* could be very bad mistake */
-    for (int i = 0; i < count; i++)
-        pb_push(buffers[i]);
-    
-    pb_push(SGL_CMD_BINDBUFFERSBASE);
-    pb_push(target);
-    pb_push(first);
-    pb_push(count);
+    glimpl_shadow_invalidate(glimpl_buffer_binding_pname(target));
+
+    glimpl_upload_buffer(buffers, (size_t)count * sizeof(*buffers));
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_BINDBUFFERSBASE;
+    *cur++ = target;
+    *cur++ = first;
+    *cur++ = count;
 }
 
 void glBindFragDataLocation(GLuint program, GLuint color, const GLchar* name)
 {
-    pb_push(SGL_CMD_BINDFRAGDATALOCATION);
-    pb_push(program);
-    pb_push(color);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDFRAGDATALOCATION;
+    *cur++ = program;
+    *cur++ = color;
     push_string(name);
 }
 
@@ -1670,32 +3278,46 @@ void glBindVertexArray(GLuint array)
 {
     glimpl_current_vertex_array = array;
     glimpl_get_vertex_array_binding(array, true);
+    glimpl_shadow_set1(GL_VERTEX_ARRAY_BINDING, array);
+    glimpl_shadow_invalidate(GL_ELEMENT_ARRAY_BUFFER_BINDING);
 
-    pb_push(SGL_CMD_BINDVERTEXARRAY);
-    pb_push(array);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_BINDVERTEXARRAY;
+    *cur++ = array;
 }
 
 void glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte* bitmap)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(width * height / 4); /* could be very bad mistake */
+    glimpl_begin_upload(width * height / 4, 7); /* could be very bad mistake */
     for (int i = 0; i < (width * height / 4); i++)
         pb_push(bitmap[i * 4] | bitmap[i * 4 + 1] << 8 | bitmap[i * 4 + 2] << 16 | bitmap[i * 4 + 3] << 24);
 
-    pb_push(SGL_CMD_BITMAP);
-    pb_push(width);
-    pb_push(height);
-    pb_push(xorig);
-    pb_push(yorig);
-    pb_push(xmove);
-    pb_push(ymove);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_BITMAP;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = xorig;
+    *cur++ = yorig;
+    *cur++ = xmove;
+    *cur++ = ymove;
 }
 
 void glBlendFunc(GLenum sfactor, GLenum dfactor)
 {
-    pb_push(SGL_CMD_BLENDFUNC);
-    pb_push(sfactor);
-    pb_push(dfactor);
+    if (glimpl_filter_state(SGL_CMD_BLENDFUNC,
+            glimpl_shadow_matches1(GL_BLEND_SRC_RGB, sfactor) && glimpl_shadow_matches1(GL_BLEND_SRC_ALPHA, sfactor) &&
+            glimpl_shadow_matches1(GL_BLEND_DST_RGB, dfactor) && glimpl_shadow_matches1(GL_BLEND_DST_ALPHA, dfactor)))
+        return;
+
+    glimpl_shadow_set1(GL_BLEND_SRC_RGB, sfactor);
+    glimpl_shadow_set1(GL_BLEND_SRC_ALPHA, sfactor);
+    glimpl_shadow_set1(GL_BLEND_DST_RGB, dfactor);
+    glimpl_shadow_set1(GL_BLEND_DST_ALPHA, dfactor);
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BLENDFUNC;
+    *cur++ = sfactor;
+    *cur++ = dfactor;
 }
 
 void glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
@@ -1705,157 +3327,203 @@ void glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage
 
 void glCallList(GLuint list)
 {
-    pb_push(SGL_CMD_CALLLIST);
-    pb_push(list);
+    glimpl_shadow_invalidate_all();
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_CALLLIST;
+    *cur++ = list;
 }
 
 void glClear(GLbitfield mask)
 {
-    pb_push(SGL_CMD_CLEAR);
-    pb_push(mask);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_CLEAR;
+    *cur++ = mask;
 }
 
 void glClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
 {
-    pb_push(SGL_CMD_CLEARCOLOR);
-    pb_pushf(red);
-    pb_pushf(green);
-    pb_pushf(blue);
-    pb_pushf(alpha);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_CLEARCOLOR;
+    *(float*)cur++ = red;
+    *(float*)cur++ = green;
+    *(float*)cur++ = blue;
+    *(float*)cur++ = alpha;
 }
 
 void glClipPlane(GLenum plane, const GLdouble* equation)
 {
-    pb_push(SGL_CMD_CLIPPLANE);
-    pb_push(plane);
-    pb_pushf(equation[0]);
-    pb_pushf(equation[1]);
-    pb_pushf(equation[2]);
-    pb_pushf(equation[3]);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_CLIPPLANE;
+    *cur++ = plane;
+    *(float*)cur++ = equation[0];
+    *(float*)cur++ = equation[1];
+    *(float*)cur++ = equation[2];
+    *(float*)cur++ = equation[3];
 }
 
 void glClipPlanef(GLenum p, const GLfloat* eqn)
 {
-    pb_push(SGL_CMD_CLIPPLANE);
-    pb_push(p);
-    pb_pushf(eqn[0]);
-    pb_pushf(eqn[1]);
-    pb_pushf(eqn[2]);
-    pb_pushf(eqn[3]);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_CLIPPLANE;
+    *cur++ = p;
+    *(float*)cur++ = eqn[0];
+    *(float*)cur++ = eqn[1];
+    *(float*)cur++ = eqn[2];
+    *(float*)cur++ = eqn[3];
 }
 
 void glColor3f(GLfloat red, GLfloat green, GLfloat blue) 
 {
-    pb_push(SGL_CMD_COLOR3F);
-    pb_pushf(red);
-    pb_pushf(green);
-    pb_pushf(blue);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, 3, red, green, blue, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_COLOR3F;
+    *(float*)cur++ = red;
+    *(float*)cur++ = green;
+    *(float*)cur++ = blue;
 }
 
 void glCompileShader(GLuint shader)
 {
-    pb_push(SGL_CMD_COMPILESHADER);
-    pb_push(shader);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_COMPILESHADER;
+    *cur++ = shader;
 }
 
 GLuint glCreateProgram()
 {
-    pb_push(SGL_CMD_CREATEPROGRAM);
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    GLuint name = glimpl_name_alloc(&glimpl_shader_names);
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_CREATEPROGRAM;
+    *cur++ = name;
+    return name;
 }
 
 GLuint glCreateShader(GLenum type)
 {
-    pb_push(SGL_CMD_CREATESHADER);
-    pb_push(type);
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    GLuint name = glimpl_name_alloc(&glimpl_shader_names);
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_CREATESHADER;
+    *cur++ = type;
+    *cur++ = name;
+    return name;
 }
 
 void glDeleteBuffers(GLsizei n, const GLuint* buffers)
 {
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEBUFFERS);
-        pb_push(buffers[i]);
+        if (glimpl_pixel_pack_buffer_binding == buffers[i])
+            glimpl_pixel_pack_buffer_binding = 0;
+        glimpl_shadow_unbind(glimpl_buffer_binding_pnames, GLIMPL_ARRAY_COUNT(glimpl_buffer_binding_pnames), buffers[i]);
+        glimpl_name_release(&glimpl_buffer_names, buffers[i]);
     }
+
+    glimpl_delete_names(SGL_CMD_DELETEBUFFERS, n, buffers);
 }
 
 void glDeleteTextures(GLsizei n, const GLuint* textures)
 {
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETETEXTURES);
-        pb_push(textures[i]);
+        glimpl_shadow_unbind(glimpl_texture_binding_pnames, GLIMPL_ARRAY_COUNT(glimpl_texture_binding_pnames), textures[i]);
+        glimpl_name_release(&glimpl_texture_names, textures[i]);
     }
+
+    glimpl_delete_names(SGL_CMD_DELETETEXTURES, n, textures);
 }
 
 void glDeleteVertexArrays(GLsizei n, const GLuint* arrays)
 {
     for (int i = 0; i < n; i++) {
-        if (glimpl_current_vertex_array == arrays[i])
+        if (glimpl_current_vertex_array == arrays[i]) {
             glimpl_current_vertex_array = 0;
+            glimpl_shadow_invalidate(GL_ELEMENT_ARRAY_BUFFER_BINDING);
+        }
+        glimpl_shadow_unbind((const GLenum[]){ GL_VERTEX_ARRAY_BINDING }, 1, arrays[i]);
         glimpl_remove_vertex_array_binding(arrays[i]);
-
-        pb_push(SGL_CMD_DELETEVERTEXARRAYS);
-        pb_push(arrays[i]);
     }
+
+    glimpl_delete_names(SGL_CMD_DELETEVERTEXARRAYS, n, arrays);
 }
 
 void glDepthFunc(GLenum func) 
 {
-    pb_push(SGL_CMD_DEPTHFUNC);
-    pb_push(func);
+    if (glimpl_filter_state(SGL_CMD_DEPTHFUNC, glimpl_shadow_matches1(GL_DEPTH_FUNC, func)))
+        return;
+
+    glimpl_shadow_set1(GL_DEPTH_FUNC, func);
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_DEPTHFUNC;
+    *cur++ = func;
 }
 
 void glDeleteProgram(GLuint program)
 {
-    pb_push(SGL_CMD_DELETEPROGRAM);
-    pb_push(program);
+    glimpl_forget_locations(program);
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_DELETEPROGRAM;
+    *cur++ = program;
 }
 
 void glDeleteShader(GLuint shader)
 {
-    pb_push(SGL_CMD_DELETESHADER);
-    pb_push(shader);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_DELETESHADER;
+    *cur++ = shader;
 }
 
 void glDetachShader(GLuint program, GLuint shader)
 {
-    pb_push(SGL_CMD_DETACHSHADER);
-    pb_push(program);
-    pb_push(shader);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_DETACHSHADER;
+    *cur++ = program;
+    *cur++ = shader;
 }
 
 void glDisable(GLenum cap)
 {
-    pb_push(SGL_CMD_DISABLE);
-    pb_push(cap);
+    if (glimpl_filter_state(SGL_CMD_DISABLE, glimpl_shadow_matches1(cap, GL_FALSE)))
+        return;
+
+    glimpl_shadow_set1(cap, GL_FALSE);
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_DISABLE;
+    *cur++ = cap;
 }
 
 void glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
 {
-    pb_push(SGL_CMD_DISPATCHCOMPUTE);
-    pb_push(num_groups_x);
-    pb_push(num_groups_y);
-    pb_push(num_groups_z);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_DISPATCHCOMPUTE;
+    *cur++ = num_groups_x;
+    *cur++ = num_groups_y;
+    *cur++ = num_groups_z;
 }
 
 void glDrawArrays(GLenum mode, GLint first, GLsizei count)
 {
-    glimpl_push_client_managed_draw_state(0, first + count);
+    glimpl_push_client_managed_draw_state(first, count);
 
-    pb_push(SGL_CMD_DRAWARRAYS);
-    pb_push(mode);
-    pb_push(first);
-    pb_push(count);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_DRAWARRAYS;
+    *cur++ = mode;
+    *cur++ = first;
+    *cur++ = count;
 
     // vap->enabled = 0;
 }
 
 void glDrawBuffer(GLenum buf)
 {
-    pb_push(SGL_CMD_DRAWBUFFER);
-    pb_push(buf);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_DRAWBUFFER;
+    *cur++ = buf;
 }
 
 void glDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices)
@@ -1864,87 +3532,89 @@ void glDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices
      * to-do: check if mode and type is valid
      */
 
-    glimpl_draw_elements(mode, type, count, indices, -1);
+    glimpl_draw_elements(mode, type, count, indices, 0, -1);
 }
 
 void glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
 {
-    glimpl_draw_elements(mode, type, count, indices, (int)end + 1);
+    glimpl_draw_elements(mode, type, count, indices, (int)start, (int)end);
 }
 
 void glEnable(GLenum cap)
 {
-    pb_push(SGL_CMD_ENABLE);
-    pb_push(cap);
+    if (glimpl_filter_state(SGL_CMD_ENABLE, glimpl_shadow_matches1(cap, GL_TRUE)))
+        return;
+
+    glimpl_shadow_set1(cap, GL_TRUE);
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ENABLE;
+    *cur++ = cap;
 }
 
 void glEnableVertexAttribArray(GLuint index)
 {
+    int *cur;
     glimpl_vaps[index].enabled = true;
 
     // if (!glimpl_vaps[index].client_managed) {
-        pb_push(SGL_CMD_ENABLEVERTEXATTRIBARRAY);
-        pb_push(index);
+        cur = glimpl_begin(2);
+        *cur++ = SGL_CMD_ENABLEVERTEXATTRIBARRAY;
+        *cur++ = index;
     // }
 }
 
 void glEnd(void) 
 {
-    pb_push(SGL_CMD_END);
+    if (glimpl_immediate.recording) {
+        glimpl_immediate_end();
+        return;
+    }
+
+    glimpl_push_command(SGL_CMD_END);
 }
 
 void glEndList(void)
 {
-    pb_push(SGL_CMD_ENDLIST);
+    glimpl_list_mode = 0;
+
+    glimpl_push_command(SGL_CMD_ENDLIST);
 }
 
 void glEndQuery(GLenum target)
 {
-    pb_push(SGL_CMD_ENDQUERY);
-    pb_push(target);   
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ENDQUERY;
+    *cur++ = target;
 }
 
 void glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
 {
-    pb_push(SGL_CMD_FRUSTUM);
-    pb_pushf(left);
-    pb_pushf(right);
-    pb_pushf(bottom);
-    pb_pushf(top);
-    pb_pushf(zNear);
-    pb_pushf(zFar);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_FRUSTUM;
+    *(float*)cur++ = left;
+    *(float*)cur++ = right;
+    *(float*)cur++ = bottom;
+    *(float*)cur++ = top;
+    *(float*)cur++ = zNear;
+    *(float*)cur++ = zFar;
 }
 
 void glGenBuffers(GLsizei n, GLuint* buffers)
 {
-    GLuint *p = buffers;
-
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENBUFFERS);
-        pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
-    }
+    glimpl_alloc_names(&glimpl_buffer_names, n, buffers);
 }
 
 void glGenFramebuffers(GLsizei n, GLuint* framebuffers)
 {
-    GLuint *p = framebuffers;
-
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENFRAMEBUFFERS);
-        pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
-    }
+    glimpl_gen_names(SGL_CMD_GENFRAMEBUFFERS, n, framebuffers);
 }
 
 GLuint glGenLists(GLsizei range)
 {
-    pb_push(SGL_CMD_GENLISTS);
-    pb_push(range);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GENLISTS;
+    *cur++ = range;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -1952,48 +3622,25 @@ GLuint glGenLists(GLsizei range)
 
 void glGenQueries(GLsizei n, GLuint* ids)
 {
-    GLuint *p = ids;
-
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENQUERIES);
-        pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
-    }
+    glimpl_gen_names(SGL_CMD_GENQUERIES, n, ids);
 }
 
 void glGenTextures(GLsizei n, GLuint* textures)
 {
-    GLuint *p = textures;
-
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENTEXTURES);
-        pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
-    }
+    glimpl_alloc_names(&glimpl_texture_names, n, textures);
 }
 
 void glGenVertexArrays(GLsizei n, GLuint* arrays)
 {
-    GLuint *p = arrays;
-
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENVERTEXARRAYS);
-        pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
-    }
+    glimpl_gen_names(SGL_CMD_GENVERTEXARRAYS, n, arrays);
 }
 
 void glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
 {
-    pb_push(SGL_CMD_GETQUERYOBJECTUI64V);
-    pb_push(id);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETQUERYOBJECTUI64V;
+    *cur++ = id;
+    *cur++ = pname;
 
     glimpl_submit();
     *params = pb_read64(SGL_OFFSET_REGISTER_RETVAL);
@@ -2001,9 +3648,10 @@ void glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
 
 void glGetProgramiv(GLuint program, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETPROGRAMIV);
-    pb_push(program);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETPROGRAMIV;
+    *cur++ = program;
+    *cur++ = pname;
 
     glimpl_submit();
     *params = pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -2011,9 +3659,10 @@ void glGetProgramiv(GLuint program, GLenum pname, GLint* params)
 
 void glGetShaderiv(GLuint shader, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETSHADERIV);
-    pb_push(shader);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETSHADERIV;
+    *cur++ = shader;
+    *cur++ = pname;
 
     glimpl_submit();
     *params = pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -2021,9 +3670,10 @@ void glGetShaderiv(GLuint shader, GLenum pname, GLint* params)
 
 void glGetObjectParameterivARB(GLhandleARB obj, GLenum pname, GLint *params)
 {
-    pb_push(SGL_CMD_GETOBJECTPARAMETERIVARB);
-    pb_push(obj);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETOBJECTPARAMETERIVARB;
+    *cur++ = obj;
+    *cur++ = pname;
 
     glimpl_submit();
     *params = pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -2031,8 +3681,9 @@ void glGetObjectParameterivARB(GLhandleARB obj, GLenum pname, GLint *params)
 
 static inline void real_glGetString(GLenum name, char *string)
 {
-    pb_push(SGL_CMD_GETSTRING);
-    pb_push(name);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GETSTRING;
+    *cur++ = name;
 
     glimpl_submit();
     
@@ -2122,28 +3773,26 @@ const GLubyte *glGetStringi(GLenum name, GLuint index)
 
 GLint glGetUniformLocation(GLuint program, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETUNIFORMLOCATION);
-    pb_push(program);
-    push_string(name);
-
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    return glimpl_get_location(SGL_CMD_GETUNIFORMLOCATION, program, name);
 }
 
 GLint glGetAttribLocation(GLuint program, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETATTRIBLOCATION);
-    pb_push(program);
-    push_string(name);
-
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    return glimpl_get_location(SGL_CMD_GETATTRIBLOCATION, program, name);
 }
 
 void glGetFloatv(GLenum pname, GLfloat* data)
 {
-    pb_push(SGL_CMD_GETFLOATV);
-    pb_push(pname);
+    struct gl_state_shadow *entry = glimpl_shadow_find(pname);
+    if (entry != NULL && entry->known) {
+        for (int i = 0; i < entry->count; i++)
+            data[i] = (GLfloat)entry->v[i];
+        return;
+    }
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GETFLOATV;
+    *cur++ = pname;
     glimpl_submit();
     GL_GET_MEMCPY_RETVAL(data, float);
 }
@@ -2172,24 +3821,47 @@ void glGetIntegerv(GLenum pname, GLint* data)
         return;
     }
 
-    pb_push(SGL_CMD_GETINTEGERV);
-    pb_push(pname);
+    struct gl_state_shadow *entry = glimpl_shadow_fetch(pname);
+    if (entry != NULL) {
+        memcpy(data, entry->v, sizeof(GLint) * entry->count);
+        return;
+    }
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GETINTEGERV;
+    *cur++ = pname;
     glimpl_submit();
     GL_GET_MEMCPY_RETVAL(data, int);
 }
 
 void glGetBooleanv(GLenum pname, GLboolean* data)
 {
-    pb_push(SGL_CMD_GETBOOLEANV);
-    pb_push(pname);
+    struct gl_state_shadow *entry = glimpl_shadow_fetch(pname);
+    if (entry != NULL) {
+        for (int i = 0; i < entry->count; i++)
+            data[i] = entry->v[i] != 0 ? GL_TRUE : GL_FALSE;
+        return;
+    }
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GETBOOLEANV;
+    *cur++ = pname;
     glimpl_submit();
     GL_GET_MEMCPY_RETVAL(data, GLboolean);
 }
 
 void glGetDoublev(GLenum pname, GLdouble* data)
 {
-    pb_push(SGL_CMD_GETDOUBLEV);
-    pb_push(pname);
+    struct gl_state_shadow *entry = glimpl_shadow_find(pname);
+    if (entry != NULL && entry->known) {
+        for (int i = 0; i < entry->count; i++)
+            data[i] = (GLdouble)entry->v[i];
+        return;
+    }
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GETDOUBLEV;
+    *cur++ = pname;
     glimpl_submit();
     GL_GET_MEMCPY_RETVAL(data, double);
 }
@@ -2223,22 +3895,23 @@ void glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void*
 
     size_t total_size = glimpl_get_pixel_transfer_span(&glimpl_pack_store, width, height, depth, format, type);
     
-    pb_push(SGL_CMD_GETTEXIMAGE);
-    pb_push(target);
-    pb_push(level);
-    pb_push(format);
-    pb_push(type);
-    pb_push(total_size);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_GETTEXIMAGE;
+    *cur++ = target;
+    *cur++ = level;
+    *cur++ = format;
+    *cur++ = type;
+    *cur++ = total_size;
 
-    glimpl_submit();
     glimpl_download_buffer(pixels, total_size);
 }
 
 void glLightModelfv(GLenum pname, const GLfloat* params)
 {
-    pb_push(SGL_CMD_LIGHTMODELFV);
-    pb_push(pname);
-    pb_pushf(params[0]);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_LIGHTMODELFV;
+    *cur++ = pname;
+    *(float*)cur++ = params[0];
     pb_pushf(params[1]); // to-do: check if this is causing an issues (overreading)
     pb_pushf(params[2]);
     pb_pushf(params[3]);
@@ -2246,95 +3919,183 @@ void glLightModelfv(GLenum pname, const GLfloat* params)
 
 void glLightfv(GLenum light, GLenum pname, const GLfloat* params)
 {
-    pb_push(SGL_CMD_LIGHTFV);
-    pb_push(light);
-    pb_push(pname);
-    pb_pushf(params[0]);
-    pb_pushf(params[1]);
-    pb_pushf(params[2]);
-    pb_pushf(params[3]);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_LIGHTFV;
+    *cur++ = light;
+    *cur++ = pname;
+    *(float*)cur++ = params[0];
+    *(float*)cur++ = params[1];
+    *(float*)cur++ = params[2];
+    *(float*)cur++ = params[3];
 }
 
 void glLinkProgram(GLuint program)
 {
-    pb_push(SGL_CMD_LINKPROGRAM);
-    pb_push(program);
+    glimpl_forget_locations(program);
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_LINKPROGRAM;
+    *cur++ = program;
 }
 
 void glLoadIdentity(void)
 {
-    pb_push(SGL_CMD_LOADIDENTITY);
+    glimpl_push_command(SGL_CMD_LOADIDENTITY);
 }
 
 void glMaterialfv(GLenum face, GLenum pname, const GLfloat* params)
 {
-    pb_push(SGL_CMD_MATERIALFV);
-    pb_push(face);
-    pb_push(pname);
-    pb_pushf(params[0]);
-    pb_pushf(params[1]);
-    pb_pushf(params[2]);
-    pb_pushf(params[3]);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_MATERIALFV;
+    *cur++ = face;
+    *cur++ = pname;
+    *(float*)cur++ = params[0];
+    *(float*)cur++ = params[1];
+    *(float*)cur++ = params[2];
+    *(float*)cur++ = params[3];
 }
 
 void glMatrixMode(GLenum mode)
 {
-    pb_push(SGL_CMD_MATRIXMODE);
-    pb_push(mode);
+    glimpl_shadow_set1(GL_MATRIX_MODE, mode);
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_MATRIXMODE;
+    *cur++ = mode;
 }
 
 void glNewList(GLuint list, GLenum mode)
 {
-    pb_push(SGL_CMD_NEWLIST);
-    pb_push(list);
-    pb_push(mode);
+    glimpl_list_mode = mode;
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_NEWLIST;
+    *cur++ = list;
+    *cur++ = mode;
 }
 
 void glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz)
 {
-    pb_push(SGL_CMD_NORMAL3F);
-    pb_pushf(nx);
-    pb_pushf(ny);
-    pb_pushf(nz);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_NORMAL, 3, nx, ny, nz, 0.0f))
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_NORMAL3F;
+    *(float*)cur++ = nx;
+    *(float*)cur++ = ny;
+    *(float*)cur++ = nz;
 }
 
 void glPopMatrix(void)
 {
-    pb_push(SGL_CMD_POPMATRIX);
+    glimpl_push_command(SGL_CMD_POPMATRIX);
 }
 
 void glPushMatrix(void)
 {
-    pb_push(SGL_CMD_PUSHMATRIX);
+    glimpl_push_command(SGL_CMD_PUSHMATRIX);
 }
 
 void glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
 {
-    pb_push(SGL_CMD_ROTATEF);
-    pb_pushf(angle);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_ROTATEF;
+    *(float*)cur++ = angle;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glShadeModel(GLenum mode)
 {
-    pb_push(SGL_CMD_SHADEMODEL);
-    pb_push(mode);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_SHADEMODEL;
+    *cur++ = mode;
+}
+
+/*
+ * sources the server said it keeps, by key; the next time one comes up
+ * only its key is sent
+ */
+#define GLIMPL_SHADER_SOURCE_SLOTS 1024
+
+static struct sgl_blob_key glimpl_shader_sources[GLIMPL_SHADER_SOURCE_SLOTS];
+
+static inline int glimpl_shader_string_length(const GLchar **string, const GLint *length, int i)
+{
+    return length && length[i] >= 0 ? length[i] : (int)strlen(string[i]);
+}
+
+static bool glimpl_shader_source_by_key(GLuint shader, const struct sgl_blob_key *key)
+{
+    int *cur = glimpl_begin(2 + SGL_BLOB_KEY_WORDS);
+    *cur++ = SGL_CMD_VP_SHADER_SOURCE_KEY;
+    *cur++ = shader;
+    memcpy(cur, key, sizeof(*key));
+
+    glimpl_submit();
+    return pb_read(SGL_OFFSET_REGISTER_RETVAL) != 0;
 }
 
 void glShaderSource(GLuint shader, GLsizei count, const GLchar** string, const GLint* length)
 {
-    pb_push(SGL_CMD_SHADERSOURCE);
-    pb_push(shader);
-    pb_push(count);
+    size_t size = 0;
+    for (int i = 0; i < count; i++)
+        size += glimpl_shader_string_length(string, length, i);
 
-    for (int i = 0; i < count; i++) {
-        int len = length && length[i] >= 0 ? length[i] : strlen(string[i]);
-        push_counted_string(string[i], len);
+    /*
+     * sent as one string, which is how the server hashes it
+     */
+    char *joined = count != 1 ? malloc(size ? size : 1) : NULL;
+    const char *source = count != 1 ? joined : string[0];
+
+    if (source == NULL) {
+        int *cur = glimpl_begin(3);
+        *cur++ = SGL_CMD_SHADERSOURCE;
+        *cur++ = shader;
+        *cur++ = count;
+
+        for (int i = 0; i < count; i++) {
+            int len = glimpl_shader_string_length(string, length, i);
+            push_counted_string(string[i], len);
+        }
+
+        glimpl_submit();
+        return;
     }
 
-    glimpl_submit();
+    for (int i = 0, offset = 0; joined != NULL && i < count; i++) {
+        int len = glimpl_shader_string_length(string, length, i);
+        memcpy(joined + offset, string[i], len);
+        offset += len;
+    }
+
+    struct sgl_blob_key key = sgl_blob_key_of(source, size);
+    struct sgl_blob_key *slot = &glimpl_shader_sources[key.hash[0] % GLIMPL_SHADER_SOURCE_SLOTS];
+
+    /*
+     * with lookups by content on, sources the server may still have
+     * from an earlier run are tried by key too
+     */
+    bool known = false;
+    if (memcmp(slot, &key, sizeof(key)) == 0 || glimpl_blob_store)
+        known = glimpl_shader_source_by_key(shader, &key);
+
+    if (!known) {
+        int *cur = glimpl_begin(3);
+        *cur++ = SGL_CMD_SHADERSOURCE;
+        *cur++ = shader;
+        *cur++ = 1;
+        push_counted_string(source, (int)size);
+
+        glimpl_submit();
+        known = pb_read(SGL_OFFSET_REGISTER_RETVAL) != 0;
+    }
+
+    if (known)
+        *slot = key;
+
+    free(joined);
 }
 
 void glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void* pixels)
@@ -2375,56 +4136,68 @@ void glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, G
 
 void glTranslated(GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_TRANSLATED);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TRANSLATED;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glTranslatef(GLfloat x, GLfloat y, GLfloat z)
 {
-    pb_push(SGL_CMD_TRANSLATEF);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TRANSLATEF;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glUniform1f(GLint location, GLfloat v0)
 {
-    pb_push(SGL_CMD_UNIFORM1F);
-    pb_push(location);
-    pb_pushf(v0);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_UNIFORM1F;
+    *cur++ = location;
+    *(float*)cur++ = v0;
 }
 
 void glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 4 * 4);
-    for (int i = 0; i < count * 4 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 4 * 4 * sizeof(*value));
 
-    pb_push(SGL_CMD_UNIFORMMATRIX4FV);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_UNIFORMMATRIX4FV;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glUseProgram(GLuint program)
 {
-    pb_push(SGL_CMD_USEPROGRAM);
-    pb_push(program);
+    if (glimpl_filter_state(SGL_CMD_USEPROGRAM, glimpl_shadow_matches1(GL_CURRENT_PROGRAM, program)))
+        return;
+
+    glimpl_shadow_set1(GL_CURRENT_PROGRAM, program);
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_USEPROGRAM;
+    *cur++ = program;
 }
 
 void glVertex3f(GLfloat x, GLfloat y, GLfloat z) 
 {
-    pb_push(SGL_CMD_VERTEX3F);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    if (glimpl_immediate_vertex(3, x, y, z, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VERTEX3F;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
 {
+    int *cur;
     bool client_managed = glimpl_array_buffer_binding == 0;
 
     glimpl_vaps[index] = (struct gl_vertex_attrib_pointer){ 
@@ -2440,12 +4213,13 @@ void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean norm
     };
 
     if (!client_managed) {
-        pb_push(SGL_CMD_VERTEXATTRIBPOINTER);
-        pb_push(index);
-        pb_push(size);
-        pb_push(type);
-        pb_push(normalized);
-        pb_push(stride);
+        cur = glimpl_begin(6);
+        *cur++ = SGL_CMD_VERTEXATTRIBPOINTER;
+        *cur++ = index;
+        *cur++ = size;
+        *cur++ = type;
+        *cur++ = normalized;
+        *cur++ = stride;
         pb_push64((int64_t)(uintptr_t)pointer);
         pb_push(false);
     }
@@ -2453,40 +4227,47 @@ void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean norm
 
 void glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_VIEWPORT);
-    pb_push(x);
-    pb_push(y);
-    pb_push(width);
-    pb_push(height);
+    glimpl_shadow_set(GL_VIEWPORT, (const GLint[]){ x, y, width, height });
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VIEWPORT;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = width;
+    *cur++ = height;
     icd_resize(width, height);
 }
 
 void glMultMatrixd(const GLdouble* m)
 {
-    pb_push(SGL_CMD_MULTMATRIXF);
+    int *cur = glimpl_begin(17);
+    *cur++ = SGL_CMD_MULTMATRIXF;
     for (int i = 0; i < 16; i++)
-        pb_pushf(m[i]);
+        *(float*)cur++ = m[i];
 }
 
 void glMultMatrixf(const GLfloat* m)
 {
-    pb_push(SGL_CMD_MULTMATRIXF);
+    int *cur = glimpl_begin(17);
+    *cur++ = SGL_CMD_MULTMATRIXF;
     for (int i = 0; i < 16; i++)
-        pb_pushf(m[i]);
+        *(float*)cur++ = m[i];
 }
 
 void glLoadMatrixd(const GLdouble* m)
 {
-    pb_push(SGL_CMD_LOADMATRIXF);
+    int *cur = glimpl_begin(17);
+    *cur++ = SGL_CMD_LOADMATRIXF;
     for (int i = 0; i < 16; i++)
-        pb_pushf(m[i]);
+        *(float*)cur++ = m[i];
 }
 
 void glLoadMatrixf(const GLfloat* m)
 {
-    pb_push(SGL_CMD_LOADMATRIXF);
+    int *cur = glimpl_begin(17);
+    *cur++ = SGL_CMD_LOADMATRIXF;
     for (int i = 0; i < 16; i++)
-        pb_pushf(m[i]);
+        *(float*)cur++ = m[i];
 }
 
 void glColorPointer(GLint size, GLenum type, GLsizei stride, const void* pointer)
@@ -2588,49 +4369,62 @@ void glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void
 
 void glCullFace(GLenum mode)
 {
-    pb_push(SGL_CMD_CULLFACE);
-    pb_push(mode);
+    glimpl_shadow_set1(GL_CULL_FACE_MODE, mode);
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_CULLFACE;
+    *cur++ = mode;
 }
 
 void glFrontFace(GLenum mode)
 {
-    pb_push(SGL_CMD_FRONTFACE);
-    pb_push(mode);
+    glimpl_shadow_set1(GL_FRONT_FACE, mode);
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_FRONTFACE;
+    *cur++ = mode;
 }
 
 void glHint(GLenum target, GLenum mode)
 {
-    pb_push(SGL_CMD_HINT);
-    pb_push(target);
-    pb_push(mode);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_HINT;
+    *cur++ = target;
+    *cur++ = mode;
 }
 
 void glLineWidth(GLfloat width)
 {
-    pb_push(SGL_CMD_LINEWIDTH);
-    pb_pushf(width);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_LINEWIDTH;
+    *(float*)cur++ = width;
 }
 
 void glPointSize(GLfloat size)
 {
-    pb_push(SGL_CMD_POINTSIZE);
-    pb_pushf(size);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_POINTSIZE;
+    *(float*)cur++ = size;
 }
 
 void glPolygonMode(GLenum face, GLenum mode)
 {
-    pb_push(SGL_CMD_POLYGONMODE);
-    pb_push(face);
-    pb_push(mode);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_POLYGONMODE;
+    *cur++ = face;
+    *cur++ = mode;
 }
 
 void glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_SCISSOR);
-    pb_push(x);
-    pb_push(y);
-    pb_push(width);
-    pb_push(height);
+    glimpl_shadow_set(GL_SCISSOR_BOX, (const GLint[]){ x, y, width, height });
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_SCISSOR;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = width;
+    *cur++ = height;
 
     /* 
      * icd hack for WineD3D bc it doesn't appear to call glViewport
@@ -2641,828 +4435,1091 @@ void glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
 
 void glTexParameterf(GLenum target, GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_TEXPARAMETERF);
-    pb_push(target);
-    pb_push(pname);
-    pb_pushf(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXPARAMETERF;
+    *cur++ = target;
+    *cur++ = pname;
+    *(float*)cur++ = param;
 }
 
 void glTexParameteri(GLenum target, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_TEXPARAMETERI);
-    pb_push(target);
-    pb_push(pname);
-    pb_push(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXPARAMETERI;
+    *cur++ = target;
+    *cur++ = pname;
+    *cur++ = param;
 }
 
 void glClearStencil(GLint s)
 {
-    pb_push(SGL_CMD_CLEARSTENCIL);
-    pb_push(s);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_CLEARSTENCIL;
+    *cur++ = s;
 }
 
 void glClearDepth(GLdouble depth)
 {
-    pb_push(SGL_CMD_CLEARDEPTH);
-    pb_pushf(depth);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_CLEARDEPTH;
+    *(float*)cur++ = depth;
 }
 
 void glStencilMask(GLuint mask)
 {
-    pb_push(SGL_CMD_STENCILMASK);
-    pb_push(mask);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_STENCILMASK;
+    *cur++ = mask;
 }
 
 void glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
 {
-    pb_push(SGL_CMD_COLORMASK);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
-    pb_push(alpha);
+    glimpl_shadow_set(GL_COLOR_WRITEMASK, (const GLint[]){ red != 0, green != 0, blue != 0, alpha != 0 });
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_COLORMASK;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
+    *cur++ = alpha;
 }
 
 void glDepthMask(GLboolean flag)
 {
-    pb_push(SGL_CMD_DEPTHMASK);
-    pb_push(flag);
+    glimpl_shadow_set1(GL_DEPTH_WRITEMASK, flag != 0);
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_DEPTHMASK;
+    *cur++ = flag;
 }
 
 void glFinish(void)
 {
-    pb_push(SGL_CMD_FINISH);
+    glimpl_push_command(SGL_CMD_FINISH);
 }
 
 void glFlush(void)
 {
-    pb_push(SGL_CMD_FLUSH);
+    glimpl_push_command(SGL_CMD_FLUSH);
 }
 
 void glLogicOp(GLenum opcode)
 {
-    pb_push(SGL_CMD_LOGICOP);
-    pb_push(opcode);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_LOGICOP;
+    *cur++ = opcode;
 }
 
 void glStencilFunc(GLenum func, GLint ref, GLuint mask)
 {
-    pb_push(SGL_CMD_STENCILFUNC);
-    pb_push(func);
-    pb_push(ref);
-    pb_push(mask);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_STENCILFUNC;
+    *cur++ = func;
+    *cur++ = ref;
+    *cur++ = mask;
 }
 
 void glStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 {
-    pb_push(SGL_CMD_STENCILOP);
-    pb_push(fail);
-    pb_push(zfail);
-    pb_push(zpass);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_STENCILOP;
+    *cur++ = fail;
+    *cur++ = zfail;
+    *cur++ = zpass;
 }
 
 void glPixelStoref(GLenum pname, GLfloat param)
 {
     glimpl_set_pixel_store(pname, (GLint)param);
-    pb_push(SGL_CMD_PIXELSTOREF);
-    pb_push(pname);
-    pb_pushf(param);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_PIXELSTOREF;
+    *cur++ = pname;
+    *(float*)cur++ = param;
 }
 
 void glPixelStorei(GLenum pname, GLint param)
 {
     glimpl_set_pixel_store(pname, param);
-    pb_push(SGL_CMD_PIXELSTOREI);
-    pb_push(pname);
-    pb_push(param);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_PIXELSTOREI;
+    *cur++ = pname;
+    *cur++ = param;
 }
 
 void glReadBuffer(GLenum src)
 {
-    pb_push(SGL_CMD_READBUFFER);
-    pb_push(src);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_READBUFFER;
+    *cur++ = src;
 }
 
+/*
+ * the server keeps the first error it sees as a sticky error and
+ * reports it back with every submit, so this only has to wait when
+ * there are commands the server hasn't run yet
+ */
 GLenum glGetError(void)
 {
-    return GL_NO_ERROR;
+    if (pb_size() != 0)
+        glimpl_submit();
+    pb_sync();
+
+    GLenum error = pb_read(SGL_OFFSET_REGISTER_ERROR);
+    if (error != GL_NO_ERROR)
+        glimpl_push_command(SGL_CMD_VP_CLEAR_ERROR);
+
+    return error;
 }
 
 void glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels)
 {
-    STUB();
+    bool to_pack_buffer = glimpl_pixel_pack_buffer_binding != 0;
+    size_t total_size = 0;
+
+    if (!to_pack_buffer) {
+        total_size = glimpl_get_pixel_transfer_span(&glimpl_pack_store, width, height, 1, format, type);
+        if (total_size == 0)
+            return;
+    }
+
+    int *cur = glimpl_begin(8);
+    *cur++ = SGL_CMD_READPIXELS;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = format;
+    *cur++ = type;
+    *cur++ = to_pack_buffer;
+
+    /*
+     * with a pack buffer bound, `pixels` is an offset into it and the
+     * copy stays on the host; nothing comes back until it's mapped
+     */
+    if (to_pack_buffer) {
+        pb_push((int)(uintptr_t)pixels);
+        return;
+    }
+
+    pb_push(total_size);
+    glimpl_download_buffer(pixels, total_size);
 }
 
 GLboolean glIsEnabled(GLenum cap)
 {
-    pb_push(SGL_CMD_ISENABLED);
-    pb_push(cap);
+    struct gl_state_shadow *entry = glimpl_shadow_find(cap);
+    if (entry != NULL && entry->known)
+        return entry->v[0] != 0;
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ISENABLED;
+    *cur++ = cap;
     
     glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    GLboolean enabled = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+
+    if (entry != NULL) {
+        entry->v[0] = enabled;
+        entry->known = true;
+    }
+
+    return enabled;
 }
 
 void glDepthRange(GLdouble n, GLdouble f)
 {
-    pb_push(SGL_CMD_DEPTHRANGE);
-    pb_pushf(n);
-    pb_pushf(f);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_DEPTHRANGE;
+    *(float*)cur++ = n;
+    *(float*)cur++ = f;
 }
 
 void glDeleteLists(GLuint list, GLsizei range)
 {
-    pb_push(SGL_CMD_DELETELISTS);
-    pb_push(list);
-    pb_push(range);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_DELETELISTS;
+    *cur++ = list;
+    *cur++ = range;
 }
 
 void glListBase(GLuint base)
 {
-    pb_push(SGL_CMD_LISTBASE);
-    pb_push(base);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_LISTBASE;
+    *cur++ = base;
 }
 
 void glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
 {
-    pb_push(SGL_CMD_TEXIMAGE2DMULTISAMPLE);
-    pb_push(target);
-    pb_push(samples);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
-    pb_push(fixedsamplelocations);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_TEXIMAGE2DMULTISAMPLE;
+    *cur++ = target;
+    *cur++ = samples;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = fixedsamplelocations;
 }
 
 void glColor3b(GLbyte red, GLbyte green, GLbyte blue)
 {
-    pb_push(SGL_CMD_COLOR3B);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_COLOR3B;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
 }
 
 void glColor3d(GLdouble red, GLdouble green, GLdouble blue)
 {
-    pb_push(SGL_CMD_COLOR3D);
-    pb_pushf(red);
-    pb_pushf(green);
-    pb_pushf(blue);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, 3, red, green, blue, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_COLOR3D;
+    *(float*)cur++ = red;
+    *(float*)cur++ = green;
+    *(float*)cur++ = blue;
 }
 
 void glColor3i(GLint red, GLint green, GLint blue)
 {
-    pb_push(SGL_CMD_COLOR3I);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_COLOR3I;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
 }
 
 void glColor3s(GLshort red, GLshort green, GLshort blue)
 {
-    pb_push(SGL_CMD_COLOR3S);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_COLOR3S;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
 }
 
 void glColor3ub(GLubyte red, GLubyte green, GLubyte blue)
 {
-    pb_push(SGL_CMD_COLOR3UB);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, 3, red / 255.0f, green / 255.0f, blue / 255.0f, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_COLOR3UB;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
 }
 
 void glColor3ui(GLuint red, GLuint green, GLuint blue)
 {
-    pb_push(SGL_CMD_COLOR3UI);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_COLOR3UI;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
 }
 
 void glColor3us(GLushort red, GLushort green, GLushort blue)
 {
-    pb_push(SGL_CMD_COLOR3US);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_COLOR3US;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
 }
 
 void glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
 {
-    pb_push(SGL_CMD_COLOR4B);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
-    pb_push(alpha);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_COLOR4B;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
+    *cur++ = alpha;
 }
 
 void glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha)
 {
-    pb_push(SGL_CMD_COLOR4D);
-    pb_pushf(red);
-    pb_pushf(green);
-    pb_pushf(blue);
-    pb_pushf(alpha);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, 4, red, green, blue, alpha))
+        return;
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_COLOR4D;
+    *(float*)cur++ = red;
+    *(float*)cur++ = green;
+    *(float*)cur++ = blue;
+    *(float*)cur++ = alpha;
 }
 
 void glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
-    pb_push(SGL_CMD_COLOR4F);
-    pb_pushf(red);
-    pb_pushf(green);
-    pb_pushf(blue);
-    pb_pushf(alpha);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, 4, red, green, blue, alpha))
+        return;
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_COLOR4F;
+    *(float*)cur++ = red;
+    *(float*)cur++ = green;
+    *(float*)cur++ = blue;
+    *(float*)cur++ = alpha;
 }
 
 void glColor4fv(const GLfloat* v)
 {
-    pb_push(SGL_CMD_COLOR4F);
-    pb_pushf(v[0]);
-    pb_pushf(v[1]);
-    pb_pushf(v[2]);
-    pb_pushf(v[3]);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, 4, v[0], v[1], v[2], v[3]))
+        return;
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_COLOR4F;
+    *(float*)cur++ = v[0];
+    *(float*)cur++ = v[1];
+    *(float*)cur++ = v[2];
+    *(float*)cur++ = v[3];
 }
 
 void glColor4i(GLint red, GLint green, GLint blue, GLint alpha)
 {
-    pb_push(SGL_CMD_COLOR4I);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
-    pb_push(alpha);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_COLOR4I;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
+    *cur++ = alpha;
 }
 
 void glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha)
 {
-    pb_push(SGL_CMD_COLOR4S);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
-    pb_push(alpha);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_COLOR4S;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
+    *cur++ = alpha;
 }
 
 void glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
 {
-    pb_push(SGL_CMD_COLOR4UB);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
-    pb_push(alpha);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, 4, red / 255.0f, green / 255.0f, blue / 255.0f, alpha / 255.0f))
+        return;
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_COLOR4UB;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
+    *cur++ = alpha;
 }
 
 void glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha)
 {
-    pb_push(SGL_CMD_COLOR4UI);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
-    pb_push(alpha);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_COLOR4UI;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
+    *cur++ = alpha;
 }
 
 void glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha)
 {
-    pb_push(SGL_CMD_COLOR4US);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
-    pb_push(alpha);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_COLOR4US;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
+    *cur++ = alpha;
 }
 
 void glEdgeFlag(GLboolean flag)
 {
-    pb_push(SGL_CMD_EDGEFLAG);
-    pb_push(flag);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_EDGEFLAG;
+    *cur++ = flag;
 }
 
 void glIndexd(GLdouble c)
 {
-    pb_push(SGL_CMD_INDEXD);
-    pb_pushf(c);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_INDEXD;
+    *(float*)cur++ = c;
 }
 
 void glIndexf(GLfloat c)
 {
-    pb_push(SGL_CMD_INDEXF);
-    pb_pushf(c);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_INDEXF;
+    *(float*)cur++ = c;
 }
 
 void glIndexi(GLint c)
 {
-    pb_push(SGL_CMD_INDEXI);
-    pb_push(c);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_INDEXI;
+    *cur++ = c;
 }
 
 void glIndexs(GLshort c)
 {
-    pb_push(SGL_CMD_INDEXS);
-    pb_push(c);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_INDEXS;
+    *cur++ = c;
 }
 
 void glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz)
 {
-    pb_push(SGL_CMD_NORMAL3B);
-    pb_push(nx);
-    pb_push(ny);
-    pb_push(nz);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_NORMAL3B;
+    *cur++ = nx;
+    *cur++ = ny;
+    *cur++ = nz;
 }
 
 void glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz)
 {
-    pb_push(SGL_CMD_NORMAL3D);
-    pb_pushf(nx);
-    pb_pushf(ny);
-    pb_pushf(nz);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_NORMAL, 3, nx, ny, nz, 0.0f))
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_NORMAL3D;
+    *(float*)cur++ = nx;
+    *(float*)cur++ = ny;
+    *(float*)cur++ = nz;
 }
 
 void glNormal3i(GLint nx, GLint ny, GLint nz)
 {
-    pb_push(SGL_CMD_NORMAL3I);
-    pb_push(nx);
-    pb_push(ny);
-    pb_push(nz);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_NORMAL3I;
+    *cur++ = nx;
+    *cur++ = ny;
+    *cur++ = nz;
 }
 
 void glNormal3s(GLshort nx, GLshort ny, GLshort nz)
 {
-    pb_push(SGL_CMD_NORMAL3S);
-    pb_push(nx);
-    pb_push(ny);
-    pb_push(nz);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_NORMAL3S;
+    *cur++ = nx;
+    *cur++ = ny;
+    *cur++ = nz;
 }
 
 void glRasterPos2d(GLdouble x, GLdouble y)
 {
-    pb_push(SGL_CMD_RASTERPOS2D);
-    pb_pushf(x);
-    pb_pushf(y);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_RASTERPOS2D;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
 }
 
 void glRasterPos2f(GLfloat x, GLfloat y)
 {
-    pb_push(SGL_CMD_RASTERPOS2F);
-    pb_pushf(x);
-    pb_pushf(y);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_RASTERPOS2F;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
 }
 
 void glRasterPos2i(GLint x, GLint y)
 {
-    pb_push(SGL_CMD_RASTERPOS2I);
-    pb_push(x);
-    pb_push(y);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_RASTERPOS2I;
+    *cur++ = x;
+    *cur++ = y;
 }
 
 void glRasterPos2s(GLshort x, GLshort y)
 {
-    pb_push(SGL_CMD_RASTERPOS2S);
-    pb_push(x);
-    pb_push(y);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_RASTERPOS2S;
+    *cur++ = x;
+    *cur++ = y;
 }
 
 void glRasterPos3d(GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_RASTERPOS3D);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_RASTERPOS3D;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glRasterPos3f(GLfloat x, GLfloat y, GLfloat z)
 {
-    pb_push(SGL_CMD_RASTERPOS3F);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_RASTERPOS3F;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glRasterPos3i(GLint x, GLint y, GLint z)
 {
-    pb_push(SGL_CMD_RASTERPOS3I);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_RASTERPOS3I;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
 }
 
 void glRasterPos3s(GLshort x, GLshort y, GLshort z)
 {
-    pb_push(SGL_CMD_RASTERPOS3S);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_RASTERPOS3S;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
 }
 
 void glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
-    pb_push(SGL_CMD_RASTERPOS4D);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
-    pb_pushf(w);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_RASTERPOS4D;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
+    *(float*)cur++ = w;
 }
 
 void glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
-    pb_push(SGL_CMD_RASTERPOS4F);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
-    pb_pushf(w);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_RASTERPOS4F;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
+    *(float*)cur++ = w;
 }
 
 void glRasterPos4i(GLint x, GLint y, GLint z, GLint w)
 {
-    pb_push(SGL_CMD_RASTERPOS4I);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
-    pb_push(w);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_RASTERPOS4I;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
+    *cur++ = w;
 }
 
 void glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
 {
-    pb_push(SGL_CMD_RASTERPOS4S);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
-    pb_push(w);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_RASTERPOS4S;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
+    *cur++ = w;
 }
 
 void glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
 {
-    pb_push(SGL_CMD_RECTD);
-    pb_pushf(x1);
-    pb_pushf(y1);
-    pb_pushf(x2);
-    pb_pushf(y2);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_RECTD;
+    *(float*)cur++ = x1;
+    *(float*)cur++ = y1;
+    *(float*)cur++ = x2;
+    *(float*)cur++ = y2;
 }
 
 void glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
 {
-    pb_push(SGL_CMD_RECTF);
-    pb_pushf(x1);
-    pb_pushf(y1);
-    pb_pushf(x2);
-    pb_pushf(y2);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_RECTF;
+    *(float*)cur++ = x1;
+    *(float*)cur++ = y1;
+    *(float*)cur++ = x2;
+    *(float*)cur++ = y2;
 }
 
 void glRecti(GLint x1, GLint y1, GLint x2, GLint y2)
 {
-    pb_push(SGL_CMD_RECTI);
-    pb_push(x1);
-    pb_push(y1);
-    pb_push(x2);
-    pb_push(y2);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_RECTI;
+    *cur++ = x1;
+    *cur++ = y1;
+    *cur++ = x2;
+    *cur++ = y2;
 }
 
 void glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
 {
-    pb_push(SGL_CMD_RECTS);
-    pb_push(x1);
-    pb_push(y1);
-    pb_push(x2);
-    pb_push(y2);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_RECTS;
+    *cur++ = x1;
+    *cur++ = y1;
+    *cur++ = x2;
+    *cur++ = y2;
 }
 
 void glTexCoord1d(GLdouble s)
 {
-    pb_push(SGL_CMD_TEXCOORD1D);
-    pb_pushf(s);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 1, s, 0.0f, 0.0f, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_TEXCOORD1D;
+    *(float*)cur++ = s;
 }
 
 void glTexCoord1f(GLfloat s)
 {
-    pb_push(SGL_CMD_TEXCOORD1F);
-    pb_pushf(s);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 1, s, 0.0f, 0.0f, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_TEXCOORD1F;
+    *(float*)cur++ = s;
 }
 
 void glTexCoord1i(GLint s)
 {
-    pb_push(SGL_CMD_TEXCOORD1I);
-    pb_push(s);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 1, s, 0.0f, 0.0f, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_TEXCOORD1I;
+    *cur++ = s;
 }
 
 void glTexCoord1s(GLshort s)
 {
-    pb_push(SGL_CMD_TEXCOORD1S);
-    pb_push(s);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 1, s, 0.0f, 0.0f, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_TEXCOORD1S;
+    *cur++ = s;
 }
 
 void glTexCoord2d(GLdouble s, GLdouble t)
 {
-    pb_push(SGL_CMD_TEXCOORD2D);
-    pb_pushf(s);
-    pb_pushf(t);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 2, s, t, 0.0f, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_TEXCOORD2D;
+    *(float*)cur++ = s;
+    *(float*)cur++ = t;
 }
 
 void glTexCoord2f(GLfloat s, GLfloat t)
 {
-    pb_push(SGL_CMD_TEXCOORD2F);
-    pb_pushf(s);
-    pb_pushf(t);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 2, s, t, 0.0f, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_TEXCOORD2F;
+    *(float*)cur++ = s;
+    *(float*)cur++ = t;
 }
 
 void glTexCoord2i(GLint s, GLint t)
 {
-    pb_push(SGL_CMD_TEXCOORD2I);
-    pb_push(s);
-    pb_push(t);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 2, s, t, 0.0f, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_TEXCOORD2I;
+    *cur++ = s;
+    *cur++ = t;
 }
 
 void glTexCoord2s(GLshort s, GLshort t)
 {
-    pb_push(SGL_CMD_TEXCOORD2S);
-    pb_push(s);
-    pb_push(t);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 2, s, t, 0.0f, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_TEXCOORD2S;
+    *cur++ = s;
+    *cur++ = t;
 }
 
 void glTexCoord3d(GLdouble s, GLdouble t, GLdouble r)
 {
-    pb_push(SGL_CMD_TEXCOORD3D);
-    pb_pushf(s);
-    pb_pushf(t);
-    pb_pushf(r);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 3, s, t, r, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXCOORD3D;
+    *(float*)cur++ = s;
+    *(float*)cur++ = t;
+    *(float*)cur++ = r;
 }
 
 void glTexCoord3f(GLfloat s, GLfloat t, GLfloat r)
 {
-    pb_push(SGL_CMD_TEXCOORD3F);
-    pb_pushf(s);
-    pb_pushf(t);
-    pb_pushf(r);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 3, s, t, r, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXCOORD3F;
+    *(float*)cur++ = s;
+    *(float*)cur++ = t;
+    *(float*)cur++ = r;
 }
 
 void glTexCoord3i(GLint s, GLint t, GLint r)
 {
-    pb_push(SGL_CMD_TEXCOORD3I);
-    pb_push(s);
-    pb_push(t);
-    pb_push(r);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 3, s, t, r, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXCOORD3I;
+    *cur++ = s;
+    *cur++ = t;
+    *cur++ = r;
 }
 
 void glTexCoord3s(GLshort s, GLshort t, GLshort r)
 {
-    pb_push(SGL_CMD_TEXCOORD3S);
-    pb_push(s);
-    pb_push(t);
-    pb_push(r);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 3, s, t, r, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXCOORD3S;
+    *cur++ = s;
+    *cur++ = t;
+    *cur++ = r;
 }
 
 void glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
 {
-    pb_push(SGL_CMD_TEXCOORD4D);
-    pb_pushf(s);
-    pb_pushf(t);
-    pb_pushf(r);
-    pb_pushf(q);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 4, s, t, r, q))
+        return;
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_TEXCOORD4D;
+    *(float*)cur++ = s;
+    *(float*)cur++ = t;
+    *(float*)cur++ = r;
+    *(float*)cur++ = q;
 }
 
 void glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
 {
-    pb_push(SGL_CMD_TEXCOORD4F);
-    pb_pushf(s);
-    pb_pushf(t);
-    pb_pushf(r);
-    pb_pushf(q);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 4, s, t, r, q))
+        return;
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_TEXCOORD4F;
+    *(float*)cur++ = s;
+    *(float*)cur++ = t;
+    *(float*)cur++ = r;
+    *(float*)cur++ = q;
 }
 
 void glTexCoord4i(GLint s, GLint t, GLint r, GLint q)
 {
-    pb_push(SGL_CMD_TEXCOORD4I);
-    pb_push(s);
-    pb_push(t);
-    pb_push(r);
-    pb_push(q);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 4, s, t, r, q))
+        return;
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_TEXCOORD4I;
+    *cur++ = s;
+    *cur++ = t;
+    *cur++ = r;
+    *cur++ = q;
 }
 
 void glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
 {
-    pb_push(SGL_CMD_TEXCOORD4S);
-    pb_push(s);
-    pb_push(t);
-    pb_push(r);
-    pb_push(q);
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, 4, s, t, r, q))
+        return;
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_TEXCOORD4S;
+    *cur++ = s;
+    *cur++ = t;
+    *cur++ = r;
+    *cur++ = q;
 }
 
 void glVertex2d(GLdouble x, GLdouble y)
 {
-    pb_push(SGL_CMD_VERTEX2D);
-    pb_pushf(x);
-    pb_pushf(y);
+    if (glimpl_immediate_vertex(2, x, y, 0.0f, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEX2D;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
 }
 
 void glVertex2f(GLfloat x, GLfloat y)
 {
-    pb_push(SGL_CMD_VERTEX2F);
-    pb_pushf(x);
-    pb_pushf(y);
+    if (glimpl_immediate_vertex(2, x, y, 0.0f, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEX2F;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
 }
 
 void glVertex2i(GLint x, GLint y)
 {
-    pb_push(SGL_CMD_VERTEX2I);
-    pb_push(x);
-    pb_push(y);
+    if (glimpl_immediate_vertex(2, x, y, 0.0f, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEX2I;
+    *cur++ = x;
+    *cur++ = y;
 }
 
 void glVertex2s(GLshort x, GLshort y)
 {
-    pb_push(SGL_CMD_VERTEX2S);
-    pb_push(x);
-    pb_push(y);
+    if (glimpl_immediate_vertex(2, x, y, 0.0f, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEX2S;
+    *cur++ = x;
+    *cur++ = y;
 }
 
 void glVertex3d(GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_VERTEX3D);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    if (glimpl_immediate_vertex(3, x, y, z, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VERTEX3D;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glVertex3i(GLint x, GLint y, GLint z)
 {
-    pb_push(SGL_CMD_VERTEX3I);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
+    if (glimpl_immediate_vertex(3, x, y, z, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VERTEX3I;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
 }
 
 void glVertex3s(GLshort x, GLshort y, GLshort z)
 {
-    pb_push(SGL_CMD_VERTEX3S);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
+    if (glimpl_immediate_vertex(3, x, y, z, 1.0f))
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VERTEX3S;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
 }
 
 void glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
-    pb_push(SGL_CMD_VERTEX4D);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
-    pb_pushf(w);
+    if (glimpl_immediate_vertex(4, x, y, z, w))
+        return;
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEX4D;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
+    *(float*)cur++ = w;
 }
 
 void glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
-    pb_push(SGL_CMD_VERTEX4F);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
-    pb_pushf(w);
+    if (glimpl_immediate_vertex(4, x, y, z, w))
+        return;
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEX4F;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
+    *(float*)cur++ = w;
 }
 
 void glVertex4i(GLint x, GLint y, GLint z, GLint w)
 {
-    pb_push(SGL_CMD_VERTEX4I);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
-    pb_push(w);
+    if (glimpl_immediate_vertex(4, x, y, z, w))
+        return;
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEX4I;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
+    *cur++ = w;
 }
 
 void glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
 {
-    pb_push(SGL_CMD_VERTEX4S);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
-    pb_push(w);
+    if (glimpl_immediate_vertex(4, x, y, z, w))
+        return;
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEX4S;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
+    *cur++ = w;
 }
 
 void glColorMaterial(GLenum face, GLenum mode)
 {
-    pb_push(SGL_CMD_COLORMATERIAL);
-    pb_push(face);
-    pb_push(mode);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_COLORMATERIAL;
+    *cur++ = face;
+    *cur++ = mode;
 }
 
 void glFogf(GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_FOGF);
-    pb_push(pname);
-    pb_pushf(param);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_FOGF;
+    *cur++ = pname;
+    *(float*)cur++ = param;
 }
 
 void glFogfv(GLenum pname, const GLfloat* params)
 {
+    int *cur;
     if (pname != GL_FOG_COLOR)
         glFogf(pname, params[0]);
     else {
-        pb_push(SGL_CMD_FOGFV);
-        pb_push(pname);
-        pb_pushf(params[0]);
-        pb_pushf(params[1]);
-        pb_pushf(params[2]);
-        pb_pushf(params[3]);
+        cur = glimpl_begin(6);
+        *cur++ = SGL_CMD_FOGFV;
+        *cur++ = pname;
+        *(float*)cur++ = params[0];
+        *(float*)cur++ = params[1];
+        *(float*)cur++ = params[2];
+        *(float*)cur++ = params[3];
     }
 }
 
 void glFogi(GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_FOGI);
-    pb_push(pname);
-    pb_push(param);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_FOGI;
+    *cur++ = pname;
+    *cur++ = param;
 }
 
 void glLightf(GLenum light, GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_LIGHTF);
-    pb_push(light);
-    pb_push(pname);
-    pb_pushf(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_LIGHTF;
+    *cur++ = light;
+    *cur++ = pname;
+    *(float*)cur++ = param;
 }
 
 void glLighti(GLenum light, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_LIGHTI);
-    pb_push(light);
-    pb_push(pname);
-    pb_push(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_LIGHTI;
+    *cur++ = light;
+    *cur++ = pname;
+    *cur++ = param;
 }
 
 void glLightModelf(GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_LIGHTMODELF);
-    pb_push(pname);
-    pb_pushf(param);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_LIGHTMODELF;
+    *cur++ = pname;
+    *(float*)cur++ = param;
 }
 
 void glLightModeli(GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_LIGHTMODELI);
-    pb_push(pname);
-    pb_push(param);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_LIGHTMODELI;
+    *cur++ = pname;
+    *cur++ = param;
 }
 
 void glLineStipple(GLint factor, GLushort pattern)
 {
-    pb_push(SGL_CMD_LINESTIPPLE);
-    pb_push(factor);
-    pb_push(pattern);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_LINESTIPPLE;
+    *cur++ = factor;
+    *cur++ = pattern;
 }
 
 void glMaterialf(GLenum face, GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_MATERIALF);
-    pb_push(face);
-    pb_push(pname);
-    pb_pushf(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_MATERIALF;
+    *cur++ = face;
+    *cur++ = pname;
+    *(float*)cur++ = param;
 }
 
 void glMateriali(GLenum face, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_MATERIALI);
-    pb_push(face);
-    pb_push(pname);
-    pb_push(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_MATERIALI;
+    *cur++ = face;
+    *cur++ = pname;
+    *cur++ = param;
 }
 
 void glTexEnvf(GLenum target, GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_TEXENVF);
-    pb_push(target);
-    pb_push(pname);
-    pb_pushf(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXENVF;
+    *cur++ = target;
+    *cur++ = pname;
+    *(float*)cur++ = param;
 }
 
 void glTexEnvi(GLenum target, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_TEXENVI);
-    pb_push(target);
-    pb_push(pname);
-    pb_push(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXENVI;
+    *cur++ = target;
+    *cur++ = pname;
+    *cur++ = param;
 }
 
 void glTexGend(GLenum coord, GLenum pname, GLdouble param)
 {
-    pb_push(SGL_CMD_TEXGEND);
-    pb_push(coord);
-    pb_push(pname);
-    pb_pushf(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXGEND;
+    *cur++ = coord;
+    *cur++ = pname;
+    *(float*)cur++ = param;
 }
 
 void glTexGenf(GLenum coord, GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_TEXGENF);
-    pb_push(coord);
-    pb_push(pname);
-    pb_pushf(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXGENF;
+    *cur++ = coord;
+    *cur++ = pname;
+    *(float*)cur++ = param;
 }
 
 void glTexGeni(GLenum coord, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_TEXGENI);
-    pb_push(coord);
-    pb_push(pname);
-    pb_push(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXGENI;
+    *cur++ = coord;
+    *cur++ = pname;
+    *cur++ = param;
 }
 
 GLint glRenderMode(GLenum mode)
 {
-    pb_push(SGL_CMD_RENDERMODE);
-    pb_push(mode);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_RENDERMODE;
+    *cur++ = mode;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -3470,208 +5527,236 @@ GLint glRenderMode(GLenum mode)
 
 void glInitNames(void)
 {
-    pb_push(SGL_CMD_INITNAMES);
+    glimpl_push_command(SGL_CMD_INITNAMES);
 }
 
 void glLoadName(GLuint name)
 {
-    pb_push(SGL_CMD_LOADNAME);
-    pb_push(name);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_LOADNAME;
+    *cur++ = name;
 }
 
 void glPassThrough(GLfloat token)
 {
-    pb_push(SGL_CMD_PASSTHROUGH);
-    pb_pushf(token);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_PASSTHROUGH;
+    *(float*)cur++ = token;
 }
 
 void glPopName(void)
 {
-    pb_push(SGL_CMD_POPNAME);
+    glimpl_push_command(SGL_CMD_POPNAME);
 }
 
 void glPushName(GLuint name)
 {
-    pb_push(SGL_CMD_PUSHNAME);
-    pb_push(name);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_PUSHNAME;
+    *cur++ = name;
 }
 
 void glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
-    pb_push(SGL_CMD_CLEARACCUM);
-    pb_pushf(red);
-    pb_pushf(green);
-    pb_pushf(blue);
-    pb_pushf(alpha);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_CLEARACCUM;
+    *(float*)cur++ = red;
+    *(float*)cur++ = green;
+    *(float*)cur++ = blue;
+    *(float*)cur++ = alpha;
 }
 
 void glClearIndex(GLfloat c)
 {
-    pb_push(SGL_CMD_CLEARINDEX);
-    pb_pushf(c);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_CLEARINDEX;
+    *(float*)cur++ = c;
 }
 
 void glIndexMask(GLuint mask)
 {
-    pb_push(SGL_CMD_INDEXMASK);
-    pb_push(mask);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_INDEXMASK;
+    *cur++ = mask;
 }
 
 void glAccum(GLenum op, GLfloat value)
 {
-    pb_push(SGL_CMD_ACCUM);
-    pb_push(op);
-    pb_pushf(value);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_ACCUM;
+    *cur++ = op;
+    *(float*)cur++ = value;
 }
 
 void glPopAttrib(void)
 {
-    pb_push(SGL_CMD_POPATTRIB);
+    glimpl_shadow_invalidate_all();
+
+    glimpl_push_command(SGL_CMD_POPATTRIB);
 }
 
 void glPushAttrib(GLbitfield mask)
 {
-    pb_push(SGL_CMD_PUSHATTRIB);
-    pb_push(mask);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_PUSHATTRIB;
+    *cur++ = mask;
 }
 
 void glMapGrid1d(GLint un, GLdouble u1, GLdouble u2)
 {
-    pb_push(SGL_CMD_MAPGRID1D);
-    pb_push(un);
-    pb_pushf(u1);
-    pb_pushf(u2);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_MAPGRID1D;
+    *cur++ = un;
+    *(float*)cur++ = u1;
+    *(float*)cur++ = u2;
 }
 
 void glMapGrid1f(GLint un, GLfloat u1, GLfloat u2)
 {
-    pb_push(SGL_CMD_MAPGRID1F);
-    pb_push(un);
-    pb_pushf(u1);
-    pb_pushf(u2);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_MAPGRID1F;
+    *cur++ = un;
+    *(float*)cur++ = u1;
+    *(float*)cur++ = u2;
 }
 
 void glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2)
 {
-    pb_push(SGL_CMD_MAPGRID2D);
-    pb_push(un);
-    pb_pushf(u1);
-    pb_pushf(u2);
-    pb_push(vn);
-    pb_pushf(v1);
-    pb_pushf(v2);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_MAPGRID2D;
+    *cur++ = un;
+    *(float*)cur++ = u1;
+    *(float*)cur++ = u2;
+    *cur++ = vn;
+    *(float*)cur++ = v1;
+    *(float*)cur++ = v2;
 }
 
 void glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2)
 {
-    pb_push(SGL_CMD_MAPGRID2F);
-    pb_push(un);
-    pb_pushf(u1);
-    pb_pushf(u2);
-    pb_push(vn);
-    pb_pushf(v1);
-    pb_pushf(v2);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_MAPGRID2F;
+    *cur++ = un;
+    *(float*)cur++ = u1;
+    *(float*)cur++ = u2;
+    *cur++ = vn;
+    *(float*)cur++ = v1;
+    *(float*)cur++ = v2;
 }
 
 void glEvalCoord1d(GLdouble u)
 {
-    pb_push(SGL_CMD_EVALCOORD1D);
-    pb_pushf(u);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_EVALCOORD1D;
+    *(float*)cur++ = u;
 }
 
 void glEvalCoord1f(GLfloat u)
 {
-    pb_push(SGL_CMD_EVALCOORD1F);
-    pb_pushf(u);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_EVALCOORD1F;
+    *(float*)cur++ = u;
 }
 
 void glEvalCoord2d(GLdouble u, GLdouble v)
 {
-    pb_push(SGL_CMD_EVALCOORD2D);
-    pb_pushf(u);
-    pb_pushf(v);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_EVALCOORD2D;
+    *(float*)cur++ = u;
+    *(float*)cur++ = v;
 }
 
 void glEvalCoord2f(GLfloat u, GLfloat v)
 {
-    pb_push(SGL_CMD_EVALCOORD2F);
-    pb_pushf(u);
-    pb_pushf(v);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_EVALCOORD2F;
+    *(float*)cur++ = u;
+    *(float*)cur++ = v;
 }
 
 void glEvalMesh1(GLenum mode, GLint i1, GLint i2)
 {
-    pb_push(SGL_CMD_EVALMESH1);
-    pb_push(mode);
-    pb_push(i1);
-    pb_push(i2);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_EVALMESH1;
+    *cur++ = mode;
+    *cur++ = i1;
+    *cur++ = i2;
 }
 
 void glEvalPoint1(GLint i)
 {
-    pb_push(SGL_CMD_EVALPOINT1);
-    pb_push(i);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_EVALPOINT1;
+    *cur++ = i;
 }
 
 void glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2)
 {
-    pb_push(SGL_CMD_EVALMESH2);
-    pb_push(mode);
-    pb_push(i1);
-    pb_push(i2);
-    pb_push(j1);
-    pb_push(j2);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_EVALMESH2;
+    *cur++ = mode;
+    *cur++ = i1;
+    *cur++ = i2;
+    *cur++ = j1;
+    *cur++ = j2;
 }
 
 void glEvalPoint2(GLint i, GLint j)
 {
-    pb_push(SGL_CMD_EVALPOINT2);
-    pb_push(i);
-    pb_push(j);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_EVALPOINT2;
+    *cur++ = i;
+    *cur++ = j;
 }
 
 void glAlphaFunc(GLenum func, GLfloat ref)
 {
-    pb_push(SGL_CMD_ALPHAFUNC);
-    pb_push(func);
-    pb_pushf(ref);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_ALPHAFUNC;
+    *cur++ = func;
+    *(float*)cur++ = ref;
 }
 
 void glPixelZoom(GLfloat xfactor, GLfloat yfactor)
 {
-    pb_push(SGL_CMD_PIXELZOOM);
-    pb_pushf(xfactor);
-    pb_pushf(yfactor);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_PIXELZOOM;
+    *(float*)cur++ = xfactor;
+    *(float*)cur++ = yfactor;
 }
 
 void glPixelTransferf(GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_PIXELTRANSFERF);
-    pb_push(pname);
-    pb_pushf(param);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_PIXELTRANSFERF;
+    *cur++ = pname;
+    *(float*)cur++ = param;
 }
 
 void glPixelTransferi(GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_PIXELTRANSFERI);
-    pb_push(pname);
-    pb_push(param);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_PIXELTRANSFERI;
+    *cur++ = pname;
+    *cur++ = param;
 }
 
 void glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type)
 {
-    pb_push(SGL_CMD_COPYPIXELS);
-    pb_push(x);
-    pb_push(y);
-    pb_push(width);
-    pb_push(height);
-    pb_push(type);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_COPYPIXELS;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = type;
 }
 
 GLboolean glIsList(GLuint list)
 {
-    pb_push(SGL_CMD_ISLIST);
-    pb_push(list);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ISLIST;
+    *cur++ = list;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -3679,107 +5764,124 @@ GLboolean glIsList(GLuint list)
 
 void glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
 {
-    pb_push(SGL_CMD_ORTHO);
-    pb_pushf(left);
-    pb_pushf(right);
-    pb_pushf(bottom);
-    pb_pushf(top);
-    pb_pushf(zNear);
-    pb_pushf(zFar);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_ORTHO;
+    *(float*)cur++ = left;
+    *(float*)cur++ = right;
+    *(float*)cur++ = bottom;
+    *(float*)cur++ = top;
+    *(float*)cur++ = zNear;
+    *(float*)cur++ = zFar;
 }
 
 void glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_ROTATED);
-    pb_pushf(angle);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_ROTATED;
+    *(float*)cur++ = angle;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glScaled(GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_SCALED);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SCALED;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glScalef(GLfloat x, GLfloat y, GLfloat z)
 {
-    pb_push(SGL_CMD_SCALEF);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SCALEF;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glPolygonOffset(GLfloat factor, GLfloat units)
 {
-    pb_push(SGL_CMD_POLYGONOFFSET);
-    pb_pushf(factor);
-    pb_pushf(units);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_POLYGONOFFSET;
+    *(float*)cur++ = factor;
+    *(float*)cur++ = units;
 }
 
 void glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
 {
-    pb_push(SGL_CMD_COPYTEXIMAGE1D);
-    pb_push(target);
-    pb_push(level);
-    pb_push(internalformat);
-    pb_push(x);
-    pb_push(y);
-    pb_push(width);
-    pb_push(border);
+    int *cur = glimpl_begin(8);
+    *cur++ = SGL_CMD_COPYTEXIMAGE1D;
+    *cur++ = target;
+    *cur++ = level;
+    *cur++ = internalformat;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = width;
+    *cur++ = border;
 }
 
 void glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
 {
-    pb_push(SGL_CMD_COPYTEXIMAGE2D);
-    pb_push(target);
-    pb_push(level);
-    pb_push(internalformat);
-    pb_push(x);
-    pb_push(y);
-    pb_push(width);
-    pb_push(height);
-    pb_push(border);
+    int *cur = glimpl_begin(9);
+    *cur++ = SGL_CMD_COPYTEXIMAGE2D;
+    *cur++ = target;
+    *cur++ = level;
+    *cur++ = internalformat;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = border;
 }
 
 void glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
 {
-    pb_push(SGL_CMD_COPYTEXSUBIMAGE1D);
-    pb_push(target);
-    pb_push(level);
-    pb_push(xoffset);
-    pb_push(x);
-    pb_push(y);
-    pb_push(width);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_COPYTEXSUBIMAGE1D;
+    *cur++ = target;
+    *cur++ = level;
+    *cur++ = xoffset;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = width;
 }
 
 void glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_COPYTEXSUBIMAGE2D);
-    pb_push(target);
-    pb_push(level);
-    pb_push(xoffset);
-    pb_push(yoffset);
-    pb_push(x);
-    pb_push(y);
-    pb_push(width);
-    pb_push(height);
+    int *cur = glimpl_begin(9);
+    *cur++ = SGL_CMD_COPYTEXSUBIMAGE2D;
+    *cur++ = target;
+    *cur++ = level;
+    *cur++ = xoffset;
+    *cur++ = yoffset;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = width;
+    *cur++ = height;
 }
 
 void glBindTexture(GLenum target, GLuint texture)
 {
-    pb_push(SGL_CMD_BINDTEXTURE);
-    pb_push(target);
-    pb_push(texture);
+    if (glimpl_filter_state(SGL_CMD_BINDTEXTURE, glimpl_shadow_matches1(glimpl_texture_binding_pname(target), texture)))
+        return;
+
+    glimpl_name_reserve(&glimpl_texture_names, texture);
+    glimpl_shadow_set1(glimpl_texture_binding_pname(target), texture);
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDTEXTURE;
+    *cur++ = target;
+    *cur++ = texture;
 }
 
 GLboolean glIsTexture(GLuint texture)
 {
-    pb_push(SGL_CMD_ISTEXTURE);
-    pb_push(texture);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ISTEXTURE;
+    *cur++ = texture;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -3787,8 +5889,9 @@ GLboolean glIsTexture(GLuint texture)
 
 void glArrayElement(GLint i)
 {
-    pb_push(SGL_CMD_ARRAYELEMENT);
-    pb_push(i);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ARRAYELEMENT;
+    *cur++ = i;
 }
 
 void glDisableClientState(GLenum array)
@@ -3808,8 +5911,9 @@ void glDisableClientState(GLenum array)
         break;
     }
 
-    pb_push(SGL_CMD_DISABLECLIENTSTATE);
-    pb_push(array);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_DISABLECLIENTSTATE;
+    *cur++ = array;
 }
 
 void glEnableClientState(GLenum array)
@@ -3829,70 +5933,86 @@ void glEnableClientState(GLenum array)
         break;
     }
 
-    pb_push(SGL_CMD_ENABLECLIENTSTATE);
-    pb_push(array);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ENABLECLIENTSTATE;
+    *cur++ = array;
 }
 
 void glIndexub(GLubyte c)
 {
-    pb_push(SGL_CMD_INDEXUB);
-    pb_push(c);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_INDEXUB;
+    *cur++ = c;
 }
 
 void glPopClientAttrib(void)
 {
-    pb_push(SGL_CMD_POPCLIENTATTRIB);
+    glimpl_shadow_invalidate_all();
+
+    glimpl_push_command(SGL_CMD_POPCLIENTATTRIB);
 }
 
 void glPushClientAttrib(GLbitfield mask)
 {
-    pb_push(SGL_CMD_PUSHCLIENTATTRIB);
-    pb_push(mask);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_PUSHCLIENTATTRIB;
+    *cur++ = mask;
 }
 
 void glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
 {
-    pb_push(SGL_CMD_TEXIMAGE3DMULTISAMPLE);
-    pb_push(target);
-    pb_push(samples);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
-    pb_push(depth);
-    pb_push(fixedsamplelocations);
+    int *cur = glimpl_begin(8);
+    *cur++ = SGL_CMD_TEXIMAGE3DMULTISAMPLE;
+    *cur++ = target;
+    *cur++ = samples;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = depth;
+    *cur++ = fixedsamplelocations;
 }
 
 void glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_COPYTEXSUBIMAGE3D);
-    pb_push(target);
-    pb_push(level);
-    pb_push(xoffset);
-    pb_push(yoffset);
-    pb_push(zoffset);
-    pb_push(x);
-    pb_push(y);
-    pb_push(width);
-    pb_push(height);
+    int *cur = glimpl_begin(10);
+    *cur++ = SGL_CMD_COPYTEXSUBIMAGE3D;
+    *cur++ = target;
+    *cur++ = level;
+    *cur++ = xoffset;
+    *cur++ = yoffset;
+    *cur++ = zoffset;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = width;
+    *cur++ = height;
 }
 
 void glActiveTexture(GLenum texture)
 {
-    pb_push(SGL_CMD_ACTIVETEXTURE);
-    pb_push(texture);
+    if (glimpl_filter_state(SGL_CMD_ACTIVETEXTURE, glimpl_shadow_matches1(GL_ACTIVE_TEXTURE, texture)))
+        return;
+
+    glimpl_shadow_set1(GL_ACTIVE_TEXTURE, texture);
+    glimpl_shadow_invalidate_list(glimpl_texture_binding_pnames, GLIMPL_ARRAY_COUNT(glimpl_texture_binding_pnames));
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ACTIVETEXTURE;
+    *cur++ = texture;
 }
 
 void glSampleCoverage(GLfloat value, GLboolean invert)
 {
-    pb_push(SGL_CMD_SAMPLECOVERAGE);
-    pb_pushf(value);
-    pb_push(invert);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_SAMPLECOVERAGE;
+    *(float*)cur++ = value;
+    *cur++ = invert;
 }
 
 void glClientActiveTexture(GLenum texture)
 {
-    pb_push(SGL_CMD_CLIENTACTIVETEXTURE);
-    pb_push(texture);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_CLIENTACTIVETEXTURE;
+    *cur++ = texture;
 
     glimpl_client_active_texture = texture - (GLenum)GL_TEXTURE0;
 }
@@ -3904,318 +6024,366 @@ void glClientActiveTextureARB(GLenum texture)
 
 void glMultiTexCoord1d(GLenum target, GLdouble s)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD1D);
-    pb_push(target);
-    pb_pushf(s);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_MULTITEXCOORD1D;
+    *cur++ = target;
+    *(float*)cur++ = s;
 }
 
 void glMultiTexCoord1f(GLenum target, GLfloat s)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD1F);
-    pb_push(target);
-    pb_pushf(s);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_MULTITEXCOORD1F;
+    *cur++ = target;
+    *(float*)cur++ = s;
 }
 
 void glMultiTexCoord1i(GLenum target, GLint s)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD1I);
-    pb_push(target);
-    pb_push(s);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_MULTITEXCOORD1I;
+    *cur++ = target;
+    *cur++ = s;
 }
 
 void glMultiTexCoord1s(GLenum target, GLshort s)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD1S);
-    pb_push(target);
-    pb_push(s);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_MULTITEXCOORD1S;
+    *cur++ = target;
+    *cur++ = s;
 }
 
 void glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD2D);
-    pb_push(target);
-    pb_pushf(s);
-    pb_pushf(t);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_MULTITEXCOORD2D;
+    *cur++ = target;
+    *(float*)cur++ = s;
+    *(float*)cur++ = t;
 }
 
 void glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD2F);
-    pb_push(target);
-    pb_pushf(s);
-    pb_pushf(t);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_MULTITEXCOORD2F;
+    *cur++ = target;
+    *(float*)cur++ = s;
+    *(float*)cur++ = t;
 }
 
 void glMultiTexCoord2i(GLenum target, GLint s, GLint t)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD2I);
-    pb_push(target);
-    pb_push(s);
-    pb_push(t);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_MULTITEXCOORD2I;
+    *cur++ = target;
+    *cur++ = s;
+    *cur++ = t;
 }
 
 void glMultiTexCoord2s(GLenum target, GLshort s, GLshort t)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD2S);
-    pb_push(target);
-    pb_push(s);
-    pb_push(t);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_MULTITEXCOORD2S;
+    *cur++ = target;
+    *cur++ = s;
+    *cur++ = t;
 }
 
 void glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD3D);
-    pb_push(target);
-    pb_pushf(s);
-    pb_pushf(t);
-    pb_pushf(r);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_MULTITEXCOORD3D;
+    *cur++ = target;
+    *(float*)cur++ = s;
+    *(float*)cur++ = t;
+    *(float*)cur++ = r;
 }
 
 void glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD3F);
-    pb_push(target);
-    pb_pushf(s);
-    pb_pushf(t);
-    pb_pushf(r);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_MULTITEXCOORD3F;
+    *cur++ = target;
+    *(float*)cur++ = s;
+    *(float*)cur++ = t;
+    *(float*)cur++ = r;
 }
 
 void glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD3I);
-    pb_push(target);
-    pb_push(s);
-    pb_push(t);
-    pb_push(r);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_MULTITEXCOORD3I;
+    *cur++ = target;
+    *cur++ = s;
+    *cur++ = t;
+    *cur++ = r;
 }
 
 void glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD3S);
-    pb_push(target);
-    pb_push(s);
-    pb_push(t);
-    pb_push(r);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_MULTITEXCOORD3S;
+    *cur++ = target;
+    *cur++ = s;
+    *cur++ = t;
+    *cur++ = r;
 }
 
 void glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD4D);
-    pb_push(target);
-    pb_pushf(s);
-    pb_pushf(t);
-    pb_pushf(r);
-    pb_pushf(q);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_MULTITEXCOORD4D;
+    *cur++ = target;
+    *(float*)cur++ = s;
+    *(float*)cur++ = t;
+    *(float*)cur++ = r;
+    *(float*)cur++ = q;
 }
 
 void glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD4F);
-    pb_push(target);
-    pb_pushf(s);
-    pb_pushf(t);
-    pb_pushf(r);
-    pb_pushf(q);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_MULTITEXCOORD4F;
+    *cur++ = target;
+    *(float*)cur++ = s;
+    *(float*)cur++ = t;
+    *(float*)cur++ = r;
+    *(float*)cur++ = q;
 }
 
 void glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD4I);
-    pb_push(target);
-    pb_push(s);
-    pb_push(t);
-    pb_push(r);
-    pb_push(q);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_MULTITEXCOORD4I;
+    *cur++ = target;
+    *cur++ = s;
+    *cur++ = t;
+    *cur++ = r;
+    *cur++ = q;
 }
 
 void glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD4S);
-    pb_push(target);
-    pb_push(s);
-    pb_push(t);
-    pb_push(r);
-    pb_push(q);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_MULTITEXCOORD4S;
+    *cur++ = target;
+    *cur++ = s;
+    *cur++ = t;
+    *cur++ = r;
+    *cur++ = q;
 }
 
 void glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
 {
-    pb_push(SGL_CMD_BLENDFUNCSEPARATE);
-    pb_push(sfactorRGB);
-    pb_push(dfactorRGB);
-    pb_push(sfactorAlpha);
-    pb_push(dfactorAlpha);
+    glimpl_shadow_set1(GL_BLEND_SRC_RGB, sfactorRGB);
+    glimpl_shadow_set1(GL_BLEND_DST_RGB, dfactorRGB);
+    glimpl_shadow_set1(GL_BLEND_SRC_ALPHA, sfactorAlpha);
+    glimpl_shadow_set1(GL_BLEND_DST_ALPHA, dfactorAlpha);
+
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_BLENDFUNCSEPARATE;
+    *cur++ = sfactorRGB;
+    *cur++ = dfactorRGB;
+    *cur++ = sfactorAlpha;
+    *cur++ = dfactorAlpha;
 }
 
 void glPointParameterf(GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_POINTPARAMETERF);
-    pb_push(pname);
-    pb_pushf(param);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_POINTPARAMETERF;
+    *cur++ = pname;
+    *(float*)cur++ = param;
 }
 
 void glPointParameteri(GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_POINTPARAMETERI);
-    pb_push(pname);
-    pb_push(param);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_POINTPARAMETERI;
+    *cur++ = pname;
+    *cur++ = param;
 }
 
 void glFogCoordf(GLfloat coord)
 {
-    pb_push(SGL_CMD_FOGCOORDF);
-    pb_pushf(coord);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_FOGCOORDF;
+    *(float*)cur++ = coord;
 }
 
 void glFogCoordd(GLdouble coord)
 {
-    pb_push(SGL_CMD_FOGCOORDD);
-    pb_pushf(coord);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_FOGCOORDD;
+    *(float*)cur++ = coord;
 }
 
 void glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3B);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SECONDARYCOLOR3B;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
 }
 
 void glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3D);
-    pb_pushf(red);
-    pb_pushf(green);
-    pb_pushf(blue);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SECONDARYCOLOR3D;
+    *(float*)cur++ = red;
+    *(float*)cur++ = green;
+    *(float*)cur++ = blue;
 }
 
 void glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3F);
-    pb_pushf(red);
-    pb_pushf(green);
-    pb_pushf(blue);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SECONDARYCOLOR3F;
+    *(float*)cur++ = red;
+    *(float*)cur++ = green;
+    *(float*)cur++ = blue;
 }
 
 void glSecondaryColor3i(GLint red, GLint green, GLint blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3I);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SECONDARYCOLOR3I;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
 }
 
 void glSecondaryColor3s(GLshort red, GLshort green, GLshort blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3S);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SECONDARYCOLOR3S;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
 }
 
 void glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3UB);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SECONDARYCOLOR3UB;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
 }
 
 void glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3UI);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SECONDARYCOLOR3UI;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
 }
 
 void glSecondaryColor3us(GLushort red, GLushort green, GLushort blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3US);
-    pb_push(red);
-    pb_push(green);
-    pb_push(blue);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SECONDARYCOLOR3US;
+    *cur++ = red;
+    *cur++ = green;
+    *cur++ = blue;
 }
 
 void glWindowPos2d(GLdouble x, GLdouble y)
 {
-    pb_push(SGL_CMD_WINDOWPOS2D);
-    pb_pushf(x);
-    pb_pushf(y);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_WINDOWPOS2D;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
 }
 
 void glWindowPos2f(GLfloat x, GLfloat y)
 {
-    pb_push(SGL_CMD_WINDOWPOS2F);
-    pb_pushf(x);
-    pb_pushf(y);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_WINDOWPOS2F;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
 }
 
 void glWindowPos2i(GLint x, GLint y)
 {
-    pb_push(SGL_CMD_WINDOWPOS2I);
-    pb_push(x);
-    pb_push(y);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_WINDOWPOS2I;
+    *cur++ = x;
+    *cur++ = y;
 }
 
 void glWindowPos2s(GLshort x, GLshort y)
 {
-    pb_push(SGL_CMD_WINDOWPOS2S);
-    pb_push(x);
-    pb_push(y);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_WINDOWPOS2S;
+    *cur++ = x;
+    *cur++ = y;
 }
 
 void glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_WINDOWPOS3D);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_WINDOWPOS3D;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)
 {
-    pb_push(SGL_CMD_WINDOWPOS3F);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_WINDOWPOS3F;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glWindowPos3i(GLint x, GLint y, GLint z)
 {
-    pb_push(SGL_CMD_WINDOWPOS3I);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_WINDOWPOS3I;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
 }
 
 void glWindowPos3s(GLshort x, GLshort y, GLshort z)
 {
-    pb_push(SGL_CMD_WINDOWPOS3S);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_WINDOWPOS3S;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
 }
 
 void glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
-    pb_push(SGL_CMD_BLENDCOLOR);
-    pb_pushf(red);
-    pb_pushf(green);
-    pb_pushf(blue);
-    pb_pushf(alpha);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_BLENDCOLOR;
+    *(float*)cur++ = red;
+    *(float*)cur++ = green;
+    *(float*)cur++ = blue;
+    *(float*)cur++ = alpha;
 }
 
 void glBlendEquation(GLenum mode)
 {
-    pb_push(SGL_CMD_BLENDEQUATION);
-    pb_push(mode);
+    glimpl_shadow_set1(GL_BLEND_EQUATION_RGB, mode);
+    glimpl_shadow_set1(GL_BLEND_EQUATION_ALPHA, mode);
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_BLENDEQUATION;
+    *cur++ = mode;
 }
 
 GLboolean glIsQuery(GLuint id)
 {
-    pb_push(SGL_CMD_ISQUERY);
-    pb_push(id);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ISQUERY;
+    *cur++ = id;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -4223,8 +6391,9 @@ GLboolean glIsQuery(GLuint id)
 
 GLboolean glIsBuffer(GLuint buffer)
 {
-    pb_push(SGL_CMD_ISBUFFER);
-    pb_push(buffer);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ISBUFFER;
+    *cur++ = buffer;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -4237,50 +6406,60 @@ GLboolean glUnmapBuffer(GLenum target)
 
 void glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 {
-    pb_push(SGL_CMD_BLENDEQUATIONSEPARATE);
-    pb_push(modeRGB);
-    pb_push(modeAlpha);
+    glimpl_shadow_set1(GL_BLEND_EQUATION_RGB, modeRGB);
+    glimpl_shadow_set1(GL_BLEND_EQUATION_ALPHA, modeAlpha);
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BLENDEQUATIONSEPARATE;
+    *cur++ = modeRGB;
+    *cur++ = modeAlpha;
 }
 
 void glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
 {
-    pb_push(SGL_CMD_STENCILOPSEPARATE);
-    pb_push(face);
-    pb_push(sfail);
-    pb_push(dpfail);
-    pb_push(dppass);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_STENCILOPSEPARATE;
+    *cur++ = face;
+    *cur++ = sfail;
+    *cur++ = dpfail;
+    *cur++ = dppass;
 }
 
 void glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
 {
-    pb_push(SGL_CMD_STENCILFUNCSEPARATE);
-    pb_push(face);
-    pb_push(func);
-    pb_push(ref);
-    pb_push(mask);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_STENCILFUNCSEPARATE;
+    *cur++ = face;
+    *cur++ = func;
+    *cur++ = ref;
+    *cur++ = mask;
 }
 
 void glStencilMaskSeparate(GLenum face, GLuint mask)
 {
-    pb_push(SGL_CMD_STENCILMASKSEPARATE);
-    pb_push(face);
-    pb_push(mask);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_STENCILMASKSEPARATE;
+    *cur++ = face;
+    *cur++ = mask;
 }
 
 void glDisableVertexAttribArray(GLuint index)
 {
+    int *cur;
     glimpl_vaps[index].enabled = false;
 
     // if (!glimpl_vaps[index].client_managed) {
-        pb_push(SGL_CMD_DISABLEVERTEXATTRIBARRAY);
-        pb_push(index);
+        cur = glimpl_begin(2);
+        *cur++ = SGL_CMD_DISABLEVERTEXATTRIBARRAY;
+        *cur++ = index;
     // }
 }
 
 GLboolean glIsProgram(GLuint program)
 {
-    pb_push(SGL_CMD_ISPROGRAM);
-    pb_push(program);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ISPROGRAM;
+    *cur++ = program;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -4288,8 +6467,9 @@ GLboolean glIsProgram(GLuint program)
 
 GLboolean glIsShader(GLuint shader)
 {
-    pb_push(SGL_CMD_ISSHADER);
-    pb_push(shader);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ISSHADER;
+    *cur++ = shader;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -4297,212 +6477,243 @@ GLboolean glIsShader(GLuint shader)
 
 void glUniform2f(GLint location, GLfloat v0, GLfloat v1)
 {
-    pb_push(SGL_CMD_UNIFORM2F);
-    pb_push(location);
-    pb_pushf(v0);
-    pb_pushf(v1);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_UNIFORM2F;
+    *cur++ = location;
+    *(float*)cur++ = v0;
+    *(float*)cur++ = v1;
 }
 
 void glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
-    pb_push(SGL_CMD_UNIFORM3F);
-    pb_push(location);
-    pb_pushf(v0);
-    pb_pushf(v1);
-    pb_pushf(v2);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_UNIFORM3F;
+    *cur++ = location;
+    *(float*)cur++ = v0;
+    *(float*)cur++ = v1;
+    *(float*)cur++ = v2;
 }
 
 void glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 {
-    pb_push(SGL_CMD_UNIFORM4F);
-    pb_push(location);
-    pb_pushf(v0);
-    pb_pushf(v1);
-    pb_pushf(v2);
-    pb_pushf(v3);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_UNIFORM4F;
+    *cur++ = location;
+    *(float*)cur++ = v0;
+    *(float*)cur++ = v1;
+    *(float*)cur++ = v2;
+    *(float*)cur++ = v3;
 }
 
 void glUniform1i(GLint location, GLint v0)
 {
-    pb_push(SGL_CMD_UNIFORM1I);
-    pb_push(location);
-    pb_push(v0);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_UNIFORM1I;
+    *cur++ = location;
+    *cur++ = v0;
 }
 
 void glUniform2i(GLint location, GLint v0, GLint v1)
 {
-    pb_push(SGL_CMD_UNIFORM2I);
-    pb_push(location);
-    pb_push(v0);
-    pb_push(v1);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_UNIFORM2I;
+    *cur++ = location;
+    *cur++ = v0;
+    *cur++ = v1;
 }
 
 void glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
 {
-    pb_push(SGL_CMD_UNIFORM3I);
-    pb_push(location);
-    pb_push(v0);
-    pb_push(v1);
-    pb_push(v2);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_UNIFORM3I;
+    *cur++ = location;
+    *cur++ = v0;
+    *cur++ = v1;
+    *cur++ = v2;
 }
 
 void glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
-    pb_push(SGL_CMD_UNIFORM4I);
-    pb_push(location);
-    pb_push(v0);
-    pb_push(v1);
-    pb_push(v2);
-    pb_push(v3);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_UNIFORM4I;
+    *cur++ = location;
+    *cur++ = v0;
+    *cur++ = v1;
+    *cur++ = v2;
+    *cur++ = v3;
 }
 
 void glValidateProgram(GLuint program)
 {
-    pb_push(SGL_CMD_VALIDATEPROGRAM);
-    pb_push(program);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_VALIDATEPROGRAM;
+    *cur++ = program;
 }
 
 void glVertexAttrib1d(GLuint index, GLdouble x)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB1D);
-    pb_push(index);
-    pb_pushf(x);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEXATTRIB1D;
+    *cur++ = index;
+    *(float*)cur++ = x;
 }
 
 void glVertexAttrib1f(GLuint index, GLfloat x)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB1F);
-    pb_push(index);
-    pb_pushf(x);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEXATTRIB1F;
+    *cur++ = index;
+    *(float*)cur++ = x;
 }
 
 void glVertexAttrib1s(GLuint index, GLshort x)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB1S);
-    pb_push(index);
-    pb_push(x);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEXATTRIB1S;
+    *cur++ = index;
+    *cur++ = x;
 }
 
 void glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB2D);
-    pb_push(index);
-    pb_pushf(x);
-    pb_pushf(y);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VERTEXATTRIB2D;
+    *cur++ = index;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
 }
 
 void glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB2F);
-    pb_push(index);
-    pb_pushf(x);
-    pb_pushf(y);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VERTEXATTRIB2F;
+    *cur++ = index;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
 }
 
 void glVertexAttrib2s(GLuint index, GLshort x, GLshort y)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB2S);
-    pb_push(index);
-    pb_push(x);
-    pb_push(y);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VERTEXATTRIB2S;
+    *cur++ = index;
+    *cur++ = x;
+    *cur++ = y;
 }
 
 void glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB3D);
-    pb_push(index);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEXATTRIB3D;
+    *cur++ = index;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB3F);
-    pb_push(index);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEXATTRIB3F;
+    *cur++ = index;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB3S);
-    pb_push(index);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEXATTRIB3S;
+    *cur++ = index;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
 }
 
 void glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4NUB);
-    pb_push(index);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
-    pb_push(w);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIB4NUB;
+    *cur++ = index;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
+    *cur++ = w;
 }
 
 void glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4D);
-    pb_push(index);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
-    pb_pushf(w);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIB4D;
+    *cur++ = index;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
+    *(float*)cur++ = w;
 }
 
 void glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4F);
-    pb_push(index);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
-    pb_pushf(w);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIB4F;
+    *cur++ = index;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
+    *(float*)cur++ = w;
 }
 
 void glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4S);
-    pb_push(index);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
-    pb_push(w);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIB4S;
+    *cur++ = index;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
+    *cur++ = w;
 }
 
 void glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
 {
-    pb_push(SGL_CMD_COLORMASKI);
-    pb_push(index);
-    pb_push(r);
-    pb_push(g);
-    pb_push(b);
-    pb_push(a);
+    glimpl_shadow_invalidate(GL_COLOR_WRITEMASK);
+
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_COLORMASKI;
+    *cur++ = index;
+    *cur++ = r;
+    *cur++ = g;
+    *cur++ = b;
+    *cur++ = a;
 }
 
 void glEnablei(GLenum target, GLuint index)
 {
-    pb_push(SGL_CMD_ENABLEI);
-    pb_push(target);
-    pb_push(index);
+    glimpl_shadow_invalidate(target);
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_ENABLEI;
+    *cur++ = target;
+    *cur++ = index;
 }
 
 void glDisablei(GLenum target, GLuint index)
 {
-    pb_push(SGL_CMD_DISABLEI);
-    pb_push(target);
-    pb_push(index);
+    glimpl_shadow_invalidate(target);
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_DISABLEI;
+    *cur++ = target;
+    *cur++ = index;
 }
 
 GLboolean glIsEnabledi(GLenum target, GLuint index)
 {
-    pb_push(SGL_CMD_ISENABLEDI);
-    pb_push(target);
-    pb_push(index);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_ISENABLEDI;
+    *cur++ = target;
+    *cur++ = index;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -4510,167 +6721,190 @@ GLboolean glIsEnabledi(GLenum target, GLuint index)
 
 void glBeginTransformFeedback(GLenum primitiveMode)
 {
-    pb_push(SGL_CMD_BEGINTRANSFORMFEEDBACK);
-    pb_push(primitiveMode);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_BEGINTRANSFORMFEEDBACK;
+    *cur++ = primitiveMode;
 }
 
 void glEndTransformFeedback(void)
 {
-    pb_push(SGL_CMD_ENDTRANSFORMFEEDBACK);
+    glimpl_push_command(SGL_CMD_ENDTRANSFORMFEEDBACK);
 }
 
 void glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
-    pb_push(SGL_CMD_BINDBUFFERRANGE);
-    pb_push(target);
-    pb_push(index);
-    pb_push(buffer);
-    pb_push(offset);
-    pb_push(size);
+    glimpl_shadow_set1(glimpl_buffer_binding_pname(target), buffer);
+
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_BINDBUFFERRANGE;
+    *cur++ = target;
+    *cur++ = index;
+    *cur++ = buffer;
+    *cur++ = offset;
+    *cur++ = size;
 }
 
 void glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
 {
-    pb_push(SGL_CMD_BINDBUFFERBASE);
-    pb_push(target);
-    pb_push(index);
-    pb_push(buffer);
+    glimpl_shadow_set1(glimpl_buffer_binding_pname(target), buffer);
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_BINDBUFFERBASE;
+    *cur++ = target;
+    *cur++ = index;
+    *cur++ = buffer;
 }
 
 void glClampColor(GLenum target, GLenum clamp)
 {
-    pb_push(SGL_CMD_CLAMPCOLOR);
-    pb_push(target);
-    pb_push(clamp);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_CLAMPCOLOR;
+    *cur++ = target;
+    *cur++ = clamp;
 }
 
 void glBeginConditionalRender(GLuint id, GLenum mode)
 {
-    pb_push(SGL_CMD_BEGINCONDITIONALRENDER);
-    pb_push(id);
-    pb_push(mode);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BEGINCONDITIONALRENDER;
+    *cur++ = id;
+    *cur++ = mode;
 }
 
 void glEndConditionalRender(void)
 {
-    pb_push(SGL_CMD_ENDCONDITIONALRENDER);
+    glimpl_push_command(SGL_CMD_ENDCONDITIONALRENDER);
 }
 
 void glVertexAttribI1i(GLuint index, GLint x)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI1I);
-    pb_push(index);
-    pb_push(x);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEXATTRIBI1I;
+    *cur++ = index;
+    *cur++ = x;
 }
 
 void glVertexAttribI2i(GLuint index, GLint x, GLint y)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI2I);
-    pb_push(index);
-    pb_push(x);
-    pb_push(y);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VERTEXATTRIBI2I;
+    *cur++ = index;
+    *cur++ = x;
+    *cur++ = y;
 }
 
 void glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI3I);
-    pb_push(index);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEXATTRIBI3I;
+    *cur++ = index;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
 }
 
 void glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI4I);
-    pb_push(index);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
-    pb_push(w);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIBI4I;
+    *cur++ = index;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
+    *cur++ = w;
 }
 
 void glVertexAttribI1ui(GLuint index, GLuint x)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI1UI);
-    pb_push(index);
-    pb_push(x);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEXATTRIBI1UI;
+    *cur++ = index;
+    *cur++ = x;
 }
 
 void glVertexAttribI2ui(GLuint index, GLuint x, GLuint y)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI2UI);
-    pb_push(index);
-    pb_push(x);
-    pb_push(y);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VERTEXATTRIBI2UI;
+    *cur++ = index;
+    *cur++ = x;
+    *cur++ = y;
 }
 
 void glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI3UI);
-    pb_push(index);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEXATTRIBI3UI;
+    *cur++ = index;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
 }
 
 void glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI4UI);
-    pb_push(index);
-    pb_push(x);
-    pb_push(y);
-    pb_push(z);
-    pb_push(w);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIBI4UI;
+    *cur++ = index;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = z;
+    *cur++ = w;
 }
 
 void glUniform1ui(GLint location, GLuint v0)
 {
-    pb_push(SGL_CMD_UNIFORM1UI);
-    pb_push(location);
-    pb_push(v0);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_UNIFORM1UI;
+    *cur++ = location;
+    *cur++ = v0;
 }
 
 void glUniform2ui(GLint location, GLuint v0, GLuint v1)
 {
-    pb_push(SGL_CMD_UNIFORM2UI);
-    pb_push(location);
-    pb_push(v0);
-    pb_push(v1);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_UNIFORM2UI;
+    *cur++ = location;
+    *cur++ = v0;
+    *cur++ = v1;
 }
 
 void glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
 {
-    pb_push(SGL_CMD_UNIFORM3UI);
-    pb_push(location);
-    pb_push(v0);
-    pb_push(v1);
-    pb_push(v2);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_UNIFORM3UI;
+    *cur++ = location;
+    *cur++ = v0;
+    *cur++ = v1;
+    *cur++ = v2;
 }
 
 void glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
 {
-    pb_push(SGL_CMD_UNIFORM4UI);
-    pb_push(location);
-    pb_push(v0);
-    pb_push(v1);
-    pb_push(v2);
-    pb_push(v3);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_UNIFORM4UI;
+    *cur++ = location;
+    *cur++ = v0;
+    *cur++ = v1;
+    *cur++ = v2;
+    *cur++ = v3;
 }
 
 void glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
 {
-    pb_push(SGL_CMD_CLEARBUFFERFI);
-    pb_push(buffer);
-    pb_push(drawbuffer);
-    pb_pushf(depth);
-    pb_push(stencil);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_CLEARBUFFERFI;
+    *cur++ = buffer;
+    *cur++ = drawbuffer;
+    *(float*)cur++ = depth;
+    *cur++ = stencil;
 }
 
 GLboolean glIsRenderbuffer(GLuint renderbuffer)
 {
-    pb_push(SGL_CMD_ISRENDERBUFFER);
-    pb_push(renderbuffer);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ISRENDERBUFFER;
+    *cur++ = renderbuffer;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -4678,24 +6912,29 @@ GLboolean glIsRenderbuffer(GLuint renderbuffer)
 
 void glBindRenderbuffer(GLenum target, GLuint renderbuffer)
 {
-    pb_push(SGL_CMD_BINDRENDERBUFFER);
-    pb_push(target);
-    pb_push(renderbuffer);
+    glimpl_shadow_set1(GL_RENDERBUFFER_BINDING, renderbuffer);
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDRENDERBUFFER;
+    *cur++ = target;
+    *cur++ = renderbuffer;
 }
 
 void glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_RENDERBUFFERSTORAGE);
-    pb_push(target);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_RENDERBUFFERSTORAGE;
+    *cur++ = target;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
 }
 
 GLboolean glIsFramebuffer(GLuint framebuffer)
 {
-    pb_push(SGL_CMD_ISFRAMEBUFFER);
-    pb_push(framebuffer);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ISFRAMEBUFFER;
+    *cur++ = framebuffer;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -4703,15 +6942,22 @@ GLboolean glIsFramebuffer(GLuint framebuffer)
 
 void glBindFramebuffer(GLenum target, GLuint framebuffer)
 {
-    pb_push(SGL_CMD_BINDFRAMEBUFFER);
-    pb_push(target);
-    pb_push(framebuffer);
+    if (target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER)
+        glimpl_shadow_set1(GL_DRAW_FRAMEBUFFER_BINDING, framebuffer);
+    if (target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER)
+        glimpl_shadow_set1(GL_READ_FRAMEBUFFER_BINDING, framebuffer);
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDFRAMEBUFFER;
+    *cur++ = target;
+    *cur++ = framebuffer;
 }
 
 GLenum glCheckFramebufferStatus(GLenum target)
 {
-    pb_push(SGL_CMD_CHECKFRAMEBUFFERSTATUS);
-    pb_push(target);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_CHECKFRAMEBUFFERSTATUS;
+    *cur++ = target;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -4719,83 +6965,91 @@ GLenum glCheckFramebufferStatus(GLenum target)
 
 void glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
 {
-    pb_push(SGL_CMD_FRAMEBUFFERTEXTURE1D);
-    pb_push(target);
-    pb_push(attachment);
-    pb_push(textarget);
-    pb_push(texture);
-    pb_push(level);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_FRAMEBUFFERTEXTURE1D;
+    *cur++ = target;
+    *cur++ = attachment;
+    *cur++ = textarget;
+    *cur++ = texture;
+    *cur++ = level;
 }
 
 void glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
 {
-    pb_push(SGL_CMD_FRAMEBUFFERTEXTURE2D);
-    pb_push(target);
-    pb_push(attachment);
-    pb_push(textarget);
-    pb_push(texture);
-    pb_push(level);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_FRAMEBUFFERTEXTURE2D;
+    *cur++ = target;
+    *cur++ = attachment;
+    *cur++ = textarget;
+    *cur++ = texture;
+    *cur++ = level;
 }
 
 void glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
 {
-    pb_push(SGL_CMD_FRAMEBUFFERTEXTURE3D);
-    pb_push(target);
-    pb_push(attachment);
-    pb_push(textarget);
-    pb_push(texture);
-    pb_push(level);
-    pb_push(zoffset);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_FRAMEBUFFERTEXTURE3D;
+    *cur++ = target;
+    *cur++ = attachment;
+    *cur++ = textarget;
+    *cur++ = texture;
+    *cur++ = level;
+    *cur++ = zoffset;
 }
 
 void glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
 {
-    pb_push(SGL_CMD_FRAMEBUFFERRENDERBUFFER);
-    pb_push(target);
-    pb_push(attachment);
-    pb_push(renderbuffertarget);
-    pb_push(renderbuffer);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_FRAMEBUFFERRENDERBUFFER;
+    *cur++ = target;
+    *cur++ = attachment;
+    *cur++ = renderbuffertarget;
+    *cur++ = renderbuffer;
 }
 
 void glGenerateMipmap(GLenum target)
 {
-    pb_push(SGL_CMD_GENERATEMIPMAP);
-    pb_push(target);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GENERATEMIPMAP;
+    *cur++ = target;
 }
 
 void glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
 {
-    pb_push(SGL_CMD_BLITFRAMEBUFFER);
-    pb_push(srcX0);
-    pb_push(srcY0);
-    pb_push(srcX1);
-    pb_push(srcY1);
-    pb_push(dstX0);
-    pb_push(dstY0);
-    pb_push(dstX1);
-    pb_push(dstY1);
-    pb_push(mask);
-    pb_push(filter);
+    int *cur = glimpl_begin(11);
+    *cur++ = SGL_CMD_BLITFRAMEBUFFER;
+    *cur++ = srcX0;
+    *cur++ = srcY0;
+    *cur++ = srcX1;
+    *cur++ = srcY1;
+    *cur++ = dstX0;
+    *cur++ = dstY0;
+    *cur++ = dstX1;
+    *cur++ = dstY1;
+    *cur++ = mask;
+    *cur++ = filter;
 }
 
 void glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_RENDERBUFFERSTORAGEMULTISAMPLE);
-    pb_push(target);
-    pb_push(samples);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_RENDERBUFFERSTORAGEMULTISAMPLE;
+    *cur++ = target;
+    *cur++ = samples;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
 }
 
 void glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
 {
-    pb_push(SGL_CMD_FRAMEBUFFERTEXTURELAYER);
-    pb_push(target);
-    pb_push(attachment);
-    pb_push(texture);
-    pb_push(level);
-    pb_push(layer);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_FRAMEBUFFERTEXTURELAYER;
+    *cur++ = target;
+    *cur++ = attachment;
+    *cur++ = texture;
+    *cur++ = level;
+    *cur++ = layer;
 }
 
 void glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
@@ -4805,8 +7059,9 @@ void glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
 
 GLboolean glIsVertexArray(GLuint array)
 {
-    pb_push(SGL_CMD_ISVERTEXARRAY);
-    pb_push(array);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ISVERTEXARRAY;
+    *cur++ = array;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -4814,73 +7069,82 @@ GLboolean glIsVertexArray(GLuint array)
 
 void glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
 {
-    glimpl_push_client_managed_draw_state(0, first + count);
+    glimpl_push_client_managed_draw_state(first, count);
 
-    pb_push(SGL_CMD_DRAWARRAYSINSTANCED);
-    pb_push(mode);
-    pb_push(first);
-    pb_push(count);
-    pb_push(instancecount);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_DRAWARRAYSINSTANCED;
+    *cur++ = mode;
+    *cur++ = first;
+    *cur++ = count;
+    *cur++ = instancecount;
 }
 
 void glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
 {
-    pb_push(SGL_CMD_TEXBUFFER);
-    pb_push(target);
-    pb_push(internalformat);
-    pb_push(buffer);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXBUFFER;
+    *cur++ = target;
+    *cur++ = internalformat;
+    *cur++ = buffer;
 }
 
 void glPrimitiveRestartIndex(GLuint index)
 {
-    pb_push(SGL_CMD_PRIMITIVERESTARTINDEX);
-    pb_push(index);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_PRIMITIVERESTARTINDEX;
+    *cur++ = index;
 }
 
 void glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
 {
-    pb_push(SGL_CMD_COPYBUFFERSUBDATA);
-    pb_push(readTarget);
-    pb_push(writeTarget);
-    pb_push(readOffset);
-    pb_push(writeOffset);
-    pb_push(size);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_COPYBUFFERSUBDATA;
+    *cur++ = readTarget;
+    *cur++ = writeTarget;
+    *cur++ = readOffset;
+    *cur++ = writeOffset;
+    *cur++ = size;
 }
 
 void glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
 {
-    pb_push(SGL_CMD_UNIFORMBLOCKBINDING);
-    pb_push(program);
-    pb_push(uniformBlockIndex);
-    pb_push(uniformBlockBinding);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_UNIFORMBLOCKBINDING;
+    *cur++ = program;
+    *cur++ = uniformBlockIndex;
+    *cur++ = uniformBlockBinding;
 }
 
 void glProvokingVertex(GLenum mode)
 {
-    pb_push(SGL_CMD_PROVOKINGVERTEX);
-    pb_push(mode);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_PROVOKINGVERTEX;
+    *cur++ = mode;
 }
 
 void glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
 {
-    pb_push(SGL_CMD_FRAMEBUFFERTEXTURE);
-    pb_push(target);
-    pb_push(attachment);
-    pb_push(texture);
-    pb_push(level);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_FRAMEBUFFERTEXTURE;
+    *cur++ = target;
+    *cur++ = attachment;
+    *cur++ = texture;
+    *cur++ = level;
 }
 
 void glSampleMaski(GLuint maskNumber, GLbitfield mask)
 {
-    pb_push(SGL_CMD_SAMPLEMASKI);
-    pb_push(maskNumber);
-    pb_push(mask);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_SAMPLEMASKI;
+    *cur++ = maskNumber;
+    *cur++ = mask;
 }
 
 GLboolean glIsSampler(GLuint sampler)
 {
-    pb_push(SGL_CMD_ISSAMPLER);
-    pb_push(sampler);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ISSAMPLER;
+    *cur++ = sampler;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -4888,277 +7152,321 @@ GLboolean glIsSampler(GLuint sampler)
 
 void glBindSampler(GLuint unit, GLuint sampler)
 {
-    pb_push(SGL_CMD_BINDSAMPLER);
-    pb_push(unit);
-    pb_push(sampler);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDSAMPLER;
+    *cur++ = unit;
+    *cur++ = sampler;
 }
 
 void glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_SAMPLERPARAMETERI);
-    pb_push(sampler);
-    pb_push(pname);
-    pb_push(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SAMPLERPARAMETERI;
+    *cur++ = sampler;
+    *cur++ = pname;
+    *cur++ = param;
 }
 
 void glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_SAMPLERPARAMETERF);
-    pb_push(sampler);
-    pb_push(pname);
-    pb_pushf(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SAMPLERPARAMETERF;
+    *cur++ = sampler;
+    *cur++ = pname;
+    *(float*)cur++ = param;
 }
 
 void glQueryCounter(GLuint id, GLenum target)
 {
-    pb_push(SGL_CMD_QUERYCOUNTER);
-    pb_push(id);
-    pb_push(target);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_QUERYCOUNTER;
+    *cur++ = id;
+    *cur++ = target;
 }
 
 void glVertexAttribDivisor(GLuint index, GLuint divisor)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBDIVISOR);
-    pb_push(index);
-    pb_push(divisor);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEXATTRIBDIVISOR;
+    *cur++ = index;
+    *cur++ = divisor;
 }
 
 void glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBP1UI);
-    pb_push(index);
-    pb_push(type);
-    pb_push(normalized);
-    pb_push(value);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEXATTRIBP1UI;
+    *cur++ = index;
+    *cur++ = type;
+    *cur++ = normalized;
+    *cur++ = value;
 }
 
 void glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBP2UI);
-    pb_push(index);
-    pb_push(type);
-    pb_push(normalized);
-    pb_push(value);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEXATTRIBP2UI;
+    *cur++ = index;
+    *cur++ = type;
+    *cur++ = normalized;
+    *cur++ = value;
 }
 
 void glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBP3UI);
-    pb_push(index);
-    pb_push(type);
-    pb_push(normalized);
-    pb_push(value);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEXATTRIBP3UI;
+    *cur++ = index;
+    *cur++ = type;
+    *cur++ = normalized;
+    *cur++ = value;
 }
 
 void glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBP4UI);
-    pb_push(index);
-    pb_push(type);
-    pb_push(normalized);
-    pb_push(value);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEXATTRIBP4UI;
+    *cur++ = index;
+    *cur++ = type;
+    *cur++ = normalized;
+    *cur++ = value;
 }
 
 void glVertexP2ui(GLenum type, GLuint value)
 {
-    pb_push(SGL_CMD_VERTEXP2UI);
-    pb_push(type);
-    pb_push(value);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEXP2UI;
+    *cur++ = type;
+    *cur++ = value;
 }
 
 void glVertexP3ui(GLenum type, GLuint value)
 {
-    pb_push(SGL_CMD_VERTEXP3UI);
-    pb_push(type);
-    pb_push(value);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEXP3UI;
+    *cur++ = type;
+    *cur++ = value;
 }
 
 void glVertexP4ui(GLenum type, GLuint value)
 {
-    pb_push(SGL_CMD_VERTEXP4UI);
-    pb_push(type);
-    pb_push(value);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEXP4UI;
+    *cur++ = type;
+    *cur++ = value;
 }
 
 void glTexCoordP1ui(GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_TEXCOORDP1UI);
-    pb_push(type);
-    pb_push(coords);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_TEXCOORDP1UI;
+    *cur++ = type;
+    *cur++ = coords;
 }
 
 void glTexCoordP2ui(GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_TEXCOORDP2UI);
-    pb_push(type);
-    pb_push(coords);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_TEXCOORDP2UI;
+    *cur++ = type;
+    *cur++ = coords;
 }
 
 void glTexCoordP3ui(GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_TEXCOORDP3UI);
-    pb_push(type);
-    pb_push(coords);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_TEXCOORDP3UI;
+    *cur++ = type;
+    *cur++ = coords;
 }
 
 void glTexCoordP4ui(GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_TEXCOORDP4UI);
-    pb_push(type);
-    pb_push(coords);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_TEXCOORDP4UI;
+    *cur++ = type;
+    *cur++ = coords;
 }
 
 void glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_MULTITEXCOORDP1UI);
-    pb_push(texture);
-    pb_push(type);
-    pb_push(coords);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_MULTITEXCOORDP1UI;
+    *cur++ = texture;
+    *cur++ = type;
+    *cur++ = coords;
 }
 
 void glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_MULTITEXCOORDP2UI);
-    pb_push(texture);
-    pb_push(type);
-    pb_push(coords);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_MULTITEXCOORDP2UI;
+    *cur++ = texture;
+    *cur++ = type;
+    *cur++ = coords;
 }
 
 void glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_MULTITEXCOORDP3UI);
-    pb_push(texture);
-    pb_push(type);
-    pb_push(coords);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_MULTITEXCOORDP3UI;
+    *cur++ = texture;
+    *cur++ = type;
+    *cur++ = coords;
 }
 
 void glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_MULTITEXCOORDP4UI);
-    pb_push(texture);
-    pb_push(type);
-    pb_push(coords);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_MULTITEXCOORDP4UI;
+    *cur++ = texture;
+    *cur++ = type;
+    *cur++ = coords;
 }
 
 void glNormalP3ui(GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_NORMALP3UI);
-    pb_push(type);
-    pb_push(coords);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_NORMALP3UI;
+    *cur++ = type;
+    *cur++ = coords;
 }
 
 void glColorP3ui(GLenum type, GLuint color)
 {
-    pb_push(SGL_CMD_COLORP3UI);
-    pb_push(type);
-    pb_push(color);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_COLORP3UI;
+    *cur++ = type;
+    *cur++ = color;
 }
 
 void glColorP4ui(GLenum type, GLuint color)
 {
-    pb_push(SGL_CMD_COLORP4UI);
-    pb_push(type);
-    pb_push(color);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_COLORP4UI;
+    *cur++ = type;
+    *cur++ = color;
 }
 
 void glSecondaryColorP3ui(GLenum type, GLuint color)
 {
-    pb_push(SGL_CMD_SECONDARYCOLORP3UI);
-    pb_push(type);
-    pb_push(color);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_SECONDARYCOLORP3UI;
+    *cur++ = type;
+    *cur++ = color;
 }
 
 void glMinSampleShading(GLfloat value)
 {
-    pb_push(SGL_CMD_MINSAMPLESHADING);
-    pb_pushf(value);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_MINSAMPLESHADING;
+    *(float*)cur++ = value;
 }
 
 void glBlendEquationi(GLuint buf, GLenum mode)
 {
-    pb_push(SGL_CMD_BLENDEQUATIONI);
-    pb_push(buf);
-    pb_push(mode);
+    glimpl_shadow_invalidate_list((const GLenum[]){ GL_BLEND_EQUATION_RGB, GL_BLEND_EQUATION_ALPHA }, 2);
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BLENDEQUATIONI;
+    *cur++ = buf;
+    *cur++ = mode;
 }
 
 void glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
 {
-    pb_push(SGL_CMD_BLENDEQUATIONSEPARATEI);
-    pb_push(buf);
-    pb_push(modeRGB);
-    pb_push(modeAlpha);
+    glimpl_shadow_invalidate_list((const GLenum[]){ GL_BLEND_EQUATION_RGB, GL_BLEND_EQUATION_ALPHA }, 2);
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_BLENDEQUATIONSEPARATEI;
+    *cur++ = buf;
+    *cur++ = modeRGB;
+    *cur++ = modeAlpha;
 }
 
 void glBlendFunci(GLuint buf, GLenum src, GLenum dst)
 {
-    pb_push(SGL_CMD_BLENDFUNCI);
-    pb_push(buf);
-    pb_push(src);
-    pb_push(dst);
+    glimpl_shadow_invalidate_list((const GLenum[]){ GL_BLEND_SRC_RGB, GL_BLEND_DST_RGB, GL_BLEND_SRC_ALPHA, GL_BLEND_DST_ALPHA }, 4);
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_BLENDFUNCI;
+    *cur++ = buf;
+    *cur++ = src;
+    *cur++ = dst;
 }
 
 void glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
 {
-    pb_push(SGL_CMD_BLENDFUNCSEPARATEI);
-    pb_push(buf);
-    pb_push(srcRGB);
-    pb_push(dstRGB);
-    pb_push(srcAlpha);
-    pb_push(dstAlpha);
+    glimpl_shadow_invalidate_list((const GLenum[]){ GL_BLEND_SRC_RGB, GL_BLEND_DST_RGB, GL_BLEND_SRC_ALPHA, GL_BLEND_DST_ALPHA }, 4);
+
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_BLENDFUNCSEPARATEI;
+    *cur++ = buf;
+    *cur++ = srcRGB;
+    *cur++ = dstRGB;
+    *cur++ = srcAlpha;
+    *cur++ = dstAlpha;
 }
 
 void glUniform1d(GLint location, GLdouble x)
 {
-    pb_push(SGL_CMD_UNIFORM1D);
-    pb_push(location);
-    pb_pushf(x);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_UNIFORM1D;
+    *cur++ = location;
+    *(float*)cur++ = x;
 }
 
 void glUniform2d(GLint location, GLdouble x, GLdouble y)
 {
-    pb_push(SGL_CMD_UNIFORM2D);
-    pb_push(location);
-    pb_pushf(x);
-    pb_pushf(y);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_UNIFORM2D;
+    *cur++ = location;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
 }
 
 void glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_UNIFORM3D);
-    pb_push(location);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_UNIFORM3D;
+    *cur++ = location;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
-    pb_push(SGL_CMD_UNIFORM4D);
-    pb_push(location);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
-    pb_pushf(w);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_UNIFORM4D;
+    *cur++ = location;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
+    *(float*)cur++ = w;
 }
 
 void glPatchParameteri(GLenum pname, GLint value)
 {
-    pb_push(SGL_CMD_PATCHPARAMETERI);
-    pb_push(pname);
-    pb_push(value);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_PATCHPARAMETERI;
+    *cur++ = pname;
+    *cur++ = value;
 }
 
 void glBindTransformFeedback(GLenum target, GLuint id)
 {
-    pb_push(SGL_CMD_BINDTRANSFORMFEEDBACK);
-    pb_push(target);
-    pb_push(id);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDTRANSFORMFEEDBACK;
+    *cur++ = target;
+    *cur++ = id;
 }
 
 GLboolean glIsTransformFeedback(GLuint id)
 {
-    pb_push(SGL_CMD_ISTRANSFORMFEEDBACK);
-    pb_push(id);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ISTRANSFORMFEEDBACK;
+    *cur++ = id;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -5166,95 +7474,106 @@ GLboolean glIsTransformFeedback(GLuint id)
 
 void glPauseTransformFeedback(void)
 {
-    pb_push(SGL_CMD_PAUSETRANSFORMFEEDBACK);
+    glimpl_push_command(SGL_CMD_PAUSETRANSFORMFEEDBACK);
 }
 
 void glResumeTransformFeedback(void)
 {
-    pb_push(SGL_CMD_RESUMETRANSFORMFEEDBACK);
+    glimpl_push_command(SGL_CMD_RESUMETRANSFORMFEEDBACK);
 }
 
 void glDrawTransformFeedback(GLenum mode, GLuint id)
 {
-    pb_push(SGL_CMD_DRAWTRANSFORMFEEDBACK);
-    pb_push(mode);
-    pb_push(id);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_DRAWTRANSFORMFEEDBACK;
+    *cur++ = mode;
+    *cur++ = id;
 }
 
 void glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
 {
-    pb_push(SGL_CMD_DRAWTRANSFORMFEEDBACKSTREAM);
-    pb_push(mode);
-    pb_push(id);
-    pb_push(stream);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_DRAWTRANSFORMFEEDBACKSTREAM;
+    *cur++ = mode;
+    *cur++ = id;
+    *cur++ = stream;
 }
 
 void glBeginQueryIndexed(GLenum target, GLuint index, GLuint id)
 {
-    pb_push(SGL_CMD_BEGINQUERYINDEXED);
-    pb_push(target);
-    pb_push(index);
-    pb_push(id);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_BEGINQUERYINDEXED;
+    *cur++ = target;
+    *cur++ = index;
+    *cur++ = id;
 }
 
 void glEndQueryIndexed(GLenum target, GLuint index)
 {
-    pb_push(SGL_CMD_ENDQUERYINDEXED);
-    pb_push(target);
-    pb_push(index);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_ENDQUERYINDEXED;
+    *cur++ = target;
+    *cur++ = index;
 }
 
 void glReleaseShaderCompiler(void)
 {
-    pb_push(SGL_CMD_RELEASESHADERCOMPILER);
+    glimpl_push_command(SGL_CMD_RELEASESHADERCOMPILER);
 }
 
 void glDepthRangef(GLfloat n, GLfloat f)
 {
-    pb_push(SGL_CMD_DEPTHRANGEF);
-    pb_pushf(n);
-    pb_pushf(f);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_DEPTHRANGEF;
+    *(float*)cur++ = n;
+    *(float*)cur++ = f;
 }
 
 void glClearDepthf(GLfloat d)
 {
-    pb_push(SGL_CMD_CLEARDEPTHF);
-    pb_pushf(d);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_CLEARDEPTHF;
+    *(float*)cur++ = d;
 }
 
 void glProgramParameteri(GLuint program, GLenum pname, GLint value)
 {
-    pb_push(SGL_CMD_PROGRAMPARAMETERI);
-    pb_push(program);
-    pb_push(pname);
-    pb_push(value);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_PROGRAMPARAMETERI;
+    *cur++ = program;
+    *cur++ = pname;
+    *cur++ = value;
 }
 
 void glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program)
 {
-    pb_push(SGL_CMD_USEPROGRAMSTAGES);
-    pb_push(pipeline);
-    pb_push(stages);
-    pb_push(program);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_USEPROGRAMSTAGES;
+    *cur++ = pipeline;
+    *cur++ = stages;
+    *cur++ = program;
 }
 
 void glActiveShaderProgram(GLuint pipeline, GLuint program)
 {
-    pb_push(SGL_CMD_ACTIVESHADERPROGRAM);
-    pb_push(pipeline);
-    pb_push(program);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_ACTIVESHADERPROGRAM;
+    *cur++ = pipeline;
+    *cur++ = program;
 }
 
 void glBindProgramPipeline(GLuint pipeline)
 {
-    pb_push(SGL_CMD_BINDPROGRAMPIPELINE);
-    pb_push(pipeline);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_BINDPROGRAMPIPELINE;
+    *cur++ = pipeline;
 }
 
 GLboolean glIsProgramPipeline(GLuint pipeline)
 {
-    pb_push(SGL_CMD_ISPROGRAMPIPELINE);
-    pb_push(pipeline);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ISPROGRAMPIPELINE;
+    *cur++ = pipeline;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -5262,214 +7581,241 @@ GLboolean glIsProgramPipeline(GLuint pipeline)
 
 void glProgramUniform1i(GLuint program, GLint location, GLint v0)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM1I);
-    pb_push(program);
-    pb_push(location);
-    pb_push(v0);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM1I;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = v0;
 }
 
 void glProgramUniform1f(GLuint program, GLint location, GLfloat v0)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM1F);
-    pb_push(program);
-    pb_push(location);
-    pb_pushf(v0);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM1F;
+    *cur++ = program;
+    *cur++ = location;
+    *(float*)cur++ = v0;
 }
 
 void glProgramUniform1d(GLuint program, GLint location, GLdouble v0)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM1D);
-    pb_push(program);
-    pb_push(location);
-    pb_pushf(v0);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM1D;
+    *cur++ = program;
+    *cur++ = location;
+    *(float*)cur++ = v0;
 }
 
 void glProgramUniform1ui(GLuint program, GLint location, GLuint v0)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM1UI);
-    pb_push(program);
-    pb_push(location);
-    pb_push(v0);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM1UI;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = v0;
 }
 
 void glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM2I);
-    pb_push(program);
-    pb_push(location);
-    pb_push(v0);
-    pb_push(v1);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM2I;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = v0;
+    *cur++ = v1;
 }
 
 void glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM2F);
-    pb_push(program);
-    pb_push(location);
-    pb_pushf(v0);
-    pb_pushf(v1);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM2F;
+    *cur++ = program;
+    *cur++ = location;
+    *(float*)cur++ = v0;
+    *(float*)cur++ = v1;
 }
 
 void glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM2D);
-    pb_push(program);
-    pb_push(location);
-    pb_pushf(v0);
-    pb_pushf(v1);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM2D;
+    *cur++ = program;
+    *cur++ = location;
+    *(float*)cur++ = v0;
+    *(float*)cur++ = v1;
 }
 
 void glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM2UI);
-    pb_push(program);
-    pb_push(location);
-    pb_push(v0);
-    pb_push(v1);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM2UI;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = v0;
+    *cur++ = v1;
 }
 
 void glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM3I);
-    pb_push(program);
-    pb_push(location);
-    pb_push(v0);
-    pb_push(v1);
-    pb_push(v2);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM3I;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = v0;
+    *cur++ = v1;
+    *cur++ = v2;
 }
 
 void glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM3F);
-    pb_push(program);
-    pb_push(location);
-    pb_pushf(v0);
-    pb_pushf(v1);
-    pb_pushf(v2);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM3F;
+    *cur++ = program;
+    *cur++ = location;
+    *(float*)cur++ = v0;
+    *(float*)cur++ = v1;
+    *(float*)cur++ = v2;
 }
 
 void glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM3D);
-    pb_push(program);
-    pb_push(location);
-    pb_pushf(v0);
-    pb_pushf(v1);
-    pb_pushf(v2);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM3D;
+    *cur++ = program;
+    *cur++ = location;
+    *(float*)cur++ = v0;
+    *(float*)cur++ = v1;
+    *(float*)cur++ = v2;
 }
 
 void glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM3UI);
-    pb_push(program);
-    pb_push(location);
-    pb_push(v0);
-    pb_push(v1);
-    pb_push(v2);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM3UI;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = v0;
+    *cur++ = v1;
+    *cur++ = v2;
 }
 
 void glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM4I);
-    pb_push(program);
-    pb_push(location);
-    pb_push(v0);
-    pb_push(v1);
-    pb_push(v2);
-    pb_push(v3);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM4I;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = v0;
+    *cur++ = v1;
+    *cur++ = v2;
+    *cur++ = v3;
 }
 
 void glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM4F);
-    pb_push(program);
-    pb_push(location);
-    pb_pushf(v0);
-    pb_pushf(v1);
-    pb_pushf(v2);
-    pb_pushf(v3);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM4F;
+    *cur++ = program;
+    *cur++ = location;
+    *(float*)cur++ = v0;
+    *(float*)cur++ = v1;
+    *(float*)cur++ = v2;
+    *(float*)cur++ = v3;
 }
 
 void glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM4D);
-    pb_push(program);
-    pb_push(location);
-    pb_pushf(v0);
-    pb_pushf(v1);
-    pb_pushf(v2);
-    pb_pushf(v3);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM4D;
+    *cur++ = program;
+    *cur++ = location;
+    *(float*)cur++ = v0;
+    *(float*)cur++ = v1;
+    *(float*)cur++ = v2;
+    *(float*)cur++ = v3;
 }
 
 void glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM4UI);
-    pb_push(program);
-    pb_push(location);
-    pb_push(v0);
-    pb_push(v1);
-    pb_push(v2);
-    pb_push(v3);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_PROGRAMUNIFORM4UI;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = v0;
+    *cur++ = v1;
+    *cur++ = v2;
+    *cur++ = v3;
 }
 
 void glValidateProgramPipeline(GLuint pipeline)
 {
-    pb_push(SGL_CMD_VALIDATEPROGRAMPIPELINE);
-    pb_push(pipeline);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_VALIDATEPROGRAMPIPELINE;
+    *cur++ = pipeline;
 }
 
 void glVertexAttribL1d(GLuint index, GLdouble x)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBL1D);
-    pb_push(index);
-    pb_pushf(x);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEXATTRIBL1D;
+    *cur++ = index;
+    *(float*)cur++ = x;
 }
 
 void glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBL2D);
-    pb_push(index);
-    pb_pushf(x);
-    pb_pushf(y);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VERTEXATTRIBL2D;
+    *cur++ = index;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
 }
 
 void glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBL3D);
-    pb_push(index);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEXATTRIBL3D;
+    *cur++ = index;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
 }
 
 void glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBL4D);
-    pb_push(index);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(z);
-    pb_pushf(w);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIBL4D;
+    *cur++ = index;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = z;
+    *(float*)cur++ = w;
 }
 
 void glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
 {
-    pb_push(SGL_CMD_VIEWPORTINDEXEDF);
-    pb_push(index);
-    pb_pushf(x);
-    pb_pushf(y);
-    pb_pushf(w);
-    pb_pushf(h);
+    glimpl_shadow_invalidate(GL_VIEWPORT);
+
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VIEWPORTINDEXEDF;
+    *cur++ = index;
+    *(float*)cur++ = x;
+    *(float*)cur++ = y;
+    *(float*)cur++ = w;
+    *(float*)cur++ = h;
 }
 
 void glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_SCISSORINDEXED);
-    pb_push(index);
-    pb_push(left);
-    pb_push(bottom);
-    pb_push(width);
-    pb_push(height);
+    glimpl_shadow_invalidate(GL_SCISSOR_BOX);
+
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_SCISSORINDEXED;
+    *cur++ = index;
+    *cur++ = left;
+    *cur++ = bottom;
+    *cur++ = width;
+    *cur++ = height;
 }
 
 void glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
@@ -5477,298 +7823,329 @@ void glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
     const GLdouble range[2] = { n, f };
 
     glimpl_upload_buffer(range, sizeof(range));
-    pb_push(SGL_CMD_DEPTHRANGEINDEXED);
-    pb_push(index);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_DEPTHRANGEINDEXED;
+    *cur++ = index;
 }
 
 void glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
 {
-    glimpl_push_client_managed_draw_state(0, first + count);
+    glimpl_push_client_managed_draw_state(first, count);
 
-    pb_push(SGL_CMD_DRAWARRAYSINSTANCEDBASEINSTANCE);
-    pb_push(mode);
-    pb_push(first);
-    pb_push(count);
-    pb_push(instancecount);
-    pb_push(baseinstance);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_DRAWARRAYSINSTANCEDBASEINSTANCE;
+    *cur++ = mode;
+    *cur++ = first;
+    *cur++ = count;
+    *cur++ = instancecount;
+    *cur++ = baseinstance;
 }
 
 void glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
 {
-    pb_push(SGL_CMD_BINDIMAGETEXTURE);
-    pb_push(unit);
-    pb_push(texture);
-    pb_push(level);
-    pb_push(layered);
-    pb_push(layer);
-    pb_push(access);
-    pb_push(format);
+    int *cur = glimpl_begin(8);
+    *cur++ = SGL_CMD_BINDIMAGETEXTURE;
+    *cur++ = unit;
+    *cur++ = texture;
+    *cur++ = level;
+    *cur++ = layered;
+    *cur++ = layer;
+    *cur++ = access;
+    *cur++ = format;
 }
 
 void glMemoryBarrier(GLbitfield barriers)
 {
-    pb_push(SGL_CMD_MEMORYBARRIER);
-    pb_push(barriers);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_MEMORYBARRIER;
+    *cur++ = barriers;
 }
 
 void glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
 {
-    pb_push(SGL_CMD_TEXSTORAGE1D);
-    pb_push(target);
-    pb_push(levels);
-    pb_push(internalformat);
-    pb_push(width);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_TEXSTORAGE1D;
+    *cur++ = target;
+    *cur++ = levels;
+    *cur++ = internalformat;
+    *cur++ = width;
 }
 
 void glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_TEXSTORAGE2D);
-    pb_push(target);
-    pb_push(levels);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_TEXSTORAGE2D;
+    *cur++ = target;
+    *cur++ = levels;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
 }
 
 void glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
 {
-    pb_push(SGL_CMD_TEXSTORAGE3D);
-    pb_push(target);
-    pb_push(levels);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
-    pb_push(depth);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_TEXSTORAGE3D;
+    *cur++ = target;
+    *cur++ = levels;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = depth;
 }
 
 void glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount)
 {
-    pb_push(SGL_CMD_DRAWTRANSFORMFEEDBACKINSTANCED);
-    pb_push(mode);
-    pb_push(id);
-    pb_push(instancecount);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_DRAWTRANSFORMFEEDBACKINSTANCED;
+    *cur++ = mode;
+    *cur++ = id;
+    *cur++ = instancecount;
 }
 
 void glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
 {
-    pb_push(SGL_CMD_DRAWTRANSFORMFEEDBACKSTREAMINSTANCED);
-    pb_push(mode);
-    pb_push(id);
-    pb_push(stream);
-    pb_push(instancecount);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_DRAWTRANSFORMFEEDBACKSTREAMINSTANCED;
+    *cur++ = mode;
+    *cur++ = id;
+    *cur++ = stream;
+    *cur++ = instancecount;
 }
 
 void glDispatchComputeIndirect(GLintptr indirect)
 {
-    pb_push(SGL_CMD_DISPATCHCOMPUTEINDIRECT);
-    pb_push(indirect);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_DISPATCHCOMPUTEINDIRECT;
+    *cur++ = indirect;
 }
 
 void glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
 {
-    pb_push(SGL_CMD_COPYIMAGESUBDATA);
-    pb_push(srcName);
-    pb_push(srcTarget);
-    pb_push(srcLevel);
-    pb_push(srcX);
-    pb_push(srcY);
-    pb_push(srcZ);
-    pb_push(dstName);
-    pb_push(dstTarget);
-    pb_push(dstLevel);
-    pb_push(dstX);
-    pb_push(dstY);
-    pb_push(dstZ);
-    pb_push(srcWidth);
-    pb_push(srcHeight);
-    pb_push(srcDepth);
+    int *cur = glimpl_begin(16);
+    *cur++ = SGL_CMD_COPYIMAGESUBDATA;
+    *cur++ = srcName;
+    *cur++ = srcTarget;
+    *cur++ = srcLevel;
+    *cur++ = srcX;
+    *cur++ = srcY;
+    *cur++ = srcZ;
+    *cur++ = dstName;
+    *cur++ = dstTarget;
+    *cur++ = dstLevel;
+    *cur++ = dstX;
+    *cur++ = dstY;
+    *cur++ = dstZ;
+    *cur++ = srcWidth;
+    *cur++ = srcHeight;
+    *cur++ = srcDepth;
 }
 
 void glFramebufferParameteri(GLenum target, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_FRAMEBUFFERPARAMETERI);
-    pb_push(target);
-    pb_push(pname);
-    pb_push(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_FRAMEBUFFERPARAMETERI;
+    *cur++ = target;
+    *cur++ = pname;
+    *cur++ = param;
 }
 
 void glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
 {
-    pb_push(SGL_CMD_INVALIDATETEXSUBIMAGE);
-    pb_push(texture);
-    pb_push(level);
-    pb_push(xoffset);
-    pb_push(yoffset);
-    pb_push(zoffset);
-    pb_push(width);
-    pb_push(height);
-    pb_push(depth);
+    int *cur = glimpl_begin(9);
+    *cur++ = SGL_CMD_INVALIDATETEXSUBIMAGE;
+    *cur++ = texture;
+    *cur++ = level;
+    *cur++ = xoffset;
+    *cur++ = yoffset;
+    *cur++ = zoffset;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = depth;
 }
 
 void glInvalidateTexImage(GLuint texture, GLint level)
 {
-    pb_push(SGL_CMD_INVALIDATETEXIMAGE);
-    pb_push(texture);
-    pb_push(level);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_INVALIDATETEXIMAGE;
+    *cur++ = texture;
+    *cur++ = level;
 }
 
 void glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length)
 {
-    pb_push(SGL_CMD_INVALIDATEBUFFERSUBDATA);
-    pb_push(buffer);
-    pb_push(offset);
-    pb_push(length);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_INVALIDATEBUFFERSUBDATA;
+    *cur++ = buffer;
+    *cur++ = offset;
+    *cur++ = length;
 }
 
 void glInvalidateBufferData(GLuint buffer)
 {
-    pb_push(SGL_CMD_INVALIDATEBUFFERDATA);
-    pb_push(buffer);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_INVALIDATEBUFFERDATA;
+    *cur++ = buffer;
 }
 
 void glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
 {
-    pb_push(SGL_CMD_SHADERSTORAGEBLOCKBINDING);
-    pb_push(program);
-    pb_push(storageBlockIndex);
-    pb_push(storageBlockBinding);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SHADERSTORAGEBLOCKBINDING;
+    *cur++ = program;
+    *cur++ = storageBlockIndex;
+    *cur++ = storageBlockBinding;
 }
 
 void glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
-    pb_push(SGL_CMD_TEXBUFFERRANGE);
-    pb_push(target);
-    pb_push(internalformat);
-    pb_push(buffer);
-    pb_push(offset);
-    pb_push(size);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_TEXBUFFERRANGE;
+    *cur++ = target;
+    *cur++ = internalformat;
+    *cur++ = buffer;
+    *cur++ = offset;
+    *cur++ = size;
 }
 
 void glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
 {
-    pb_push(SGL_CMD_TEXSTORAGE2DMULTISAMPLE);
-    pb_push(target);
-    pb_push(samples);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
-    pb_push(fixedsamplelocations);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_TEXSTORAGE2DMULTISAMPLE;
+    *cur++ = target;
+    *cur++ = samples;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = fixedsamplelocations;
 }
 
 void glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
 {
-    pb_push(SGL_CMD_TEXSTORAGE3DMULTISAMPLE);
-    pb_push(target);
-    pb_push(samples);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
-    pb_push(depth);
-    pb_push(fixedsamplelocations);
+    int *cur = glimpl_begin(8);
+    *cur++ = SGL_CMD_TEXSTORAGE3DMULTISAMPLE;
+    *cur++ = target;
+    *cur++ = samples;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = depth;
+    *cur++ = fixedsamplelocations;
 }
 
 void glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
 {
-    pb_push(SGL_CMD_TEXTUREVIEW);
-    pb_push(texture);
-    pb_push(target);
-    pb_push(origtexture);
-    pb_push(internalformat);
-    pb_push(minlevel);
-    pb_push(numlevels);
-    pb_push(minlayer);
-    pb_push(numlayers);
+    int *cur = glimpl_begin(9);
+    *cur++ = SGL_CMD_TEXTUREVIEW;
+    *cur++ = texture;
+    *cur++ = target;
+    *cur++ = origtexture;
+    *cur++ = internalformat;
+    *cur++ = minlevel;
+    *cur++ = numlevels;
+    *cur++ = minlayer;
+    *cur++ = numlayers;
 }
 
 void glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
 {
-    pb_push(SGL_CMD_BINDVERTEXBUFFER);
-    pb_push(bindingindex);
-    pb_push(buffer);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDVERTEXBUFFER;
+    *cur++ = bindingindex;
+    *cur++ = buffer;
     pb_push64(offset);
     pb_push(stride);
 }
 
 void glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBFORMAT);
-    pb_push(attribindex);
-    pb_push(size);
-    pb_push(type);
-    pb_push(normalized);
-    pb_push(relativeoffset);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIBFORMAT;
+    *cur++ = attribindex;
+    *cur++ = size;
+    *cur++ = type;
+    *cur++ = normalized;
+    *cur++ = relativeoffset;
 }
 
 void glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBIFORMAT);
-    pb_push(attribindex);
-    pb_push(size);
-    pb_push(type);
-    pb_push(relativeoffset);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEXATTRIBIFORMAT;
+    *cur++ = attribindex;
+    *cur++ = size;
+    *cur++ = type;
+    *cur++ = relativeoffset;
 }
 
 void glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBLFORMAT);
-    pb_push(attribindex);
-    pb_push(size);
-    pb_push(type);
-    pb_push(relativeoffset);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_VERTEXATTRIBLFORMAT;
+    *cur++ = attribindex;
+    *cur++ = size;
+    *cur++ = type;
+    *cur++ = relativeoffset;
 }
 
 void glVertexAttribBinding(GLuint attribindex, GLuint bindingindex)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBBINDING);
-    pb_push(attribindex);
-    pb_push(bindingindex);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEXATTRIBBINDING;
+    *cur++ = attribindex;
+    *cur++ = bindingindex;
 }
 
 void glVertexBindingDivisor(GLuint bindingindex, GLuint divisor)
 {
-    pb_push(SGL_CMD_VERTEXBINDINGDIVISOR);
-    pb_push(bindingindex);
-    pb_push(divisor);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEXBINDINGDIVISOR;
+    *cur++ = bindingindex;
+    *cur++ = divisor;
 }
 
 void glPopDebugGroup(void)
 {
-    pb_push(SGL_CMD_POPDEBUGGROUP);
+    glimpl_push_command(SGL_CMD_POPDEBUGGROUP);
 }
 
 void glClipControl(GLenum origin, GLenum depth)
 {
-    pb_push(SGL_CMD_CLIPCONTROL);
-    pb_push(origin);
-    pb_push(depth);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_CLIPCONTROL;
+    *cur++ = origin;
+    *cur++ = depth;
 }
 
 void glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer)
 {
-    pb_push(SGL_CMD_TRANSFORMFEEDBACKBUFFERBASE);
-    pb_push(xfb);
-    pb_push(index);
-    pb_push(buffer);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TRANSFORMFEEDBACKBUFFERBASE;
+    *cur++ = xfb;
+    *cur++ = index;
+    *cur++ = buffer;
 }
 
 void glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
-    pb_push(SGL_CMD_TRANSFORMFEEDBACKBUFFERRANGE);
-    pb_push(xfb);
-    pb_push(index);
-    pb_push(buffer);
-    pb_push(offset);
-    pb_push(size);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_TRANSFORMFEEDBACKBUFFERRANGE;
+    *cur++ = xfb;
+    *cur++ = index;
+    *cur++ = buffer;
+    *cur++ = offset;
+    *cur++ = size;
 }
 
 void glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
 {
-    pb_push(SGL_CMD_COPYNAMEDBUFFERSUBDATA);
-    pb_push(readBuffer);
-    pb_push(writeBuffer);
-    pb_push(readOffset);
-    pb_push(writeOffset);
-    pb_push(size);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_COPYNAMEDBUFFERSUBDATA;
+    *cur++ = readBuffer;
+    *cur++ = writeBuffer;
+    *cur++ = readOffset;
+    *cur++ = writeOffset;
+    *cur++ = size;
 }
 
 GLboolean glUnmapNamedBuffer(GLuint buffer)
@@ -5783,86 +8160,95 @@ void glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr le
 
 void glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
 {
-    pb_push(SGL_CMD_NAMEDFRAMEBUFFERRENDERBUFFER);
-    pb_push(framebuffer);
-    pb_push(attachment);
-    pb_push(renderbuffertarget);
-    pb_push(renderbuffer);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_NAMEDFRAMEBUFFERRENDERBUFFER;
+    *cur++ = framebuffer;
+    *cur++ = attachment;
+    *cur++ = renderbuffertarget;
+    *cur++ = renderbuffer;
 }
 
 void glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_NAMEDFRAMEBUFFERPARAMETERI);
-    pb_push(framebuffer);
-    pb_push(pname);
-    pb_push(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_NAMEDFRAMEBUFFERPARAMETERI;
+    *cur++ = framebuffer;
+    *cur++ = pname;
+    *cur++ = param;
 }
 
 void glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
 {
-    pb_push(SGL_CMD_NAMEDFRAMEBUFFERTEXTURE);
-    pb_push(framebuffer);
-    pb_push(attachment);
-    pb_push(texture);
-    pb_push(level);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_NAMEDFRAMEBUFFERTEXTURE;
+    *cur++ = framebuffer;
+    *cur++ = attachment;
+    *cur++ = texture;
+    *cur++ = level;
 }
 
 void glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
 {
-    pb_push(SGL_CMD_NAMEDFRAMEBUFFERTEXTURELAYER);
-    pb_push(framebuffer);
-    pb_push(attachment);
-    pb_push(texture);
-    pb_push(level);
-    pb_push(layer);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_NAMEDFRAMEBUFFERTEXTURELAYER;
+    *cur++ = framebuffer;
+    *cur++ = attachment;
+    *cur++ = texture;
+    *cur++ = level;
+    *cur++ = layer;
 }
 
 void glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf)
 {
-    pb_push(SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFER);
-    pb_push(framebuffer);
-    pb_push(buf);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFER;
+    *cur++ = framebuffer;
+    *cur++ = buf;
 }
 
 void glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src)
 {
-    pb_push(SGL_CMD_NAMEDFRAMEBUFFERREADBUFFER);
-    pb_push(framebuffer);
-    pb_push(src);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_NAMEDFRAMEBUFFERREADBUFFER;
+    *cur++ = framebuffer;
+    *cur++ = src;
 }
 
 void glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
 {
-    pb_push(SGL_CMD_CLEARNAMEDFRAMEBUFFERFI);
-    pb_push(framebuffer);
-    pb_push(buffer);
-    pb_push(drawbuffer);
-    pb_pushf(depth);
-    pb_push(stencil);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_CLEARNAMEDFRAMEBUFFERFI;
+    *cur++ = framebuffer;
+    *cur++ = buffer;
+    *cur++ = drawbuffer;
+    *(float*)cur++ = depth;
+    *cur++ = stencil;
 }
 
 void glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
 {
-    pb_push(SGL_CMD_BLITNAMEDFRAMEBUFFER);
-    pb_push(readFramebuffer);
-    pb_push(drawFramebuffer);
-    pb_push(srcX0);
-    pb_push(srcY0);
-    pb_push(srcX1);
-    pb_push(srcY1);
-    pb_push(dstX0);
-    pb_push(dstY0);
-    pb_push(dstX1);
-    pb_push(dstY1);
-    pb_push(mask);
-    pb_push(filter);
+    int *cur = glimpl_begin(13);
+    *cur++ = SGL_CMD_BLITNAMEDFRAMEBUFFER;
+    *cur++ = readFramebuffer;
+    *cur++ = drawFramebuffer;
+    *cur++ = srcX0;
+    *cur++ = srcY0;
+    *cur++ = srcX1;
+    *cur++ = srcY1;
+    *cur++ = dstX0;
+    *cur++ = dstY0;
+    *cur++ = dstX1;
+    *cur++ = dstY1;
+    *cur++ = mask;
+    *cur++ = filter;
 }
 
 GLenum glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target)
 {
-    pb_push(SGL_CMD_CHECKNAMEDFRAMEBUFFERSTATUS);
-    pb_push(framebuffer);
-    pb_push(target);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_CHECKNAMEDFRAMEBUFFERSTATUS;
+    *cur++ = framebuffer;
+    *cur++ = target;
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -5870,173 +8256,193 @@ GLenum glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target)
 
 void glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_NAMEDRENDERBUFFERSTORAGE);
-    pb_push(renderbuffer);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_NAMEDRENDERBUFFERSTORAGE;
+    *cur++ = renderbuffer;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
 }
 
 void glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_NAMEDRENDERBUFFERSTORAGEMULTISAMPLE);
-    pb_push(renderbuffer);
-    pb_push(samples);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_NAMEDRENDERBUFFERSTORAGEMULTISAMPLE;
+    *cur++ = renderbuffer;
+    *cur++ = samples;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
 }
 
 void glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer)
 {
-    pb_push(SGL_CMD_TEXTUREBUFFER);
-    pb_push(texture);
-    pb_push(internalformat);
-    pb_push(buffer);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXTUREBUFFER;
+    *cur++ = texture;
+    *cur++ = internalformat;
+    *cur++ = buffer;
 }
 
 void glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
-    pb_push(SGL_CMD_TEXTUREBUFFERRANGE);
-    pb_push(texture);
-    pb_push(internalformat);
-    pb_push(buffer);
-    pb_push(offset);
-    pb_push(size);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_TEXTUREBUFFERRANGE;
+    *cur++ = texture;
+    *cur++ = internalformat;
+    *cur++ = buffer;
+    *cur++ = offset;
+    *cur++ = size;
 }
 
 void glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width)
 {
-    pb_push(SGL_CMD_TEXTURESTORAGE1D);
-    pb_push(texture);
-    pb_push(levels);
-    pb_push(internalformat);
-    pb_push(width);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_TEXTURESTORAGE1D;
+    *cur++ = texture;
+    *cur++ = levels;
+    *cur++ = internalformat;
+    *cur++ = width;
 }
 
 void glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_TEXTURESTORAGE2D);
-    pb_push(texture);
-    pb_push(levels);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_TEXTURESTORAGE2D;
+    *cur++ = texture;
+    *cur++ = levels;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
 }
 
 void glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
 {
-    pb_push(SGL_CMD_TEXTURESTORAGE3D);
-    pb_push(texture);
-    pb_push(levels);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
-    pb_push(depth);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_TEXTURESTORAGE3D;
+    *cur++ = texture;
+    *cur++ = levels;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = depth;
 }
 
 void glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
 {
-    pb_push(SGL_CMD_TEXTURESTORAGE2DMULTISAMPLE);
-    pb_push(texture);
-    pb_push(samples);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
-    pb_push(fixedsamplelocations);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_TEXTURESTORAGE2DMULTISAMPLE;
+    *cur++ = texture;
+    *cur++ = samples;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = fixedsamplelocations;
 }
 
 void glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
 {
-    pb_push(SGL_CMD_TEXTURESTORAGE3DMULTISAMPLE);
-    pb_push(texture);
-    pb_push(samples);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
-    pb_push(depth);
-    pb_push(fixedsamplelocations);
+    int *cur = glimpl_begin(8);
+    *cur++ = SGL_CMD_TEXTURESTORAGE3DMULTISAMPLE;
+    *cur++ = texture;
+    *cur++ = samples;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = depth;
+    *cur++ = fixedsamplelocations;
 }
 
 void glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
 {
-    pb_push(SGL_CMD_COPYTEXTURESUBIMAGE1D);
-    pb_push(texture);
-    pb_push(level);
-    pb_push(xoffset);
-    pb_push(x);
-    pb_push(y);
-    pb_push(width);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_COPYTEXTURESUBIMAGE1D;
+    *cur++ = texture;
+    *cur++ = level;
+    *cur++ = xoffset;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = width;
 }
 
 void glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_COPYTEXTURESUBIMAGE2D);
-    pb_push(texture);
-    pb_push(level);
-    pb_push(xoffset);
-    pb_push(yoffset);
-    pb_push(x);
-    pb_push(y);
-    pb_push(width);
-    pb_push(height);
+    int *cur = glimpl_begin(9);
+    *cur++ = SGL_CMD_COPYTEXTURESUBIMAGE2D;
+    *cur++ = texture;
+    *cur++ = level;
+    *cur++ = xoffset;
+    *cur++ = yoffset;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = width;
+    *cur++ = height;
 }
 
 void glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_COPYTEXTURESUBIMAGE3D);
-    pb_push(texture);
-    pb_push(level);
-    pb_push(xoffset);
-    pb_push(yoffset);
-    pb_push(zoffset);
-    pb_push(x);
-    pb_push(y);
-    pb_push(width);
-    pb_push(height);
+    int *cur = glimpl_begin(10);
+    *cur++ = SGL_CMD_COPYTEXTURESUBIMAGE3D;
+    *cur++ = texture;
+    *cur++ = level;
+    *cur++ = xoffset;
+    *cur++ = yoffset;
+    *cur++ = zoffset;
+    *cur++ = x;
+    *cur++ = y;
+    *cur++ = width;
+    *cur++ = height;
 }
 
 void glTextureParameterf(GLuint texture, GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_TEXTUREPARAMETERF);
-    pb_push(texture);
-    pb_push(pname);
-    pb_pushf(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXTUREPARAMETERF;
+    *cur++ = texture;
+    *cur++ = pname;
+    *(float*)cur++ = param;
 }
 
 void glTextureParameteri(GLuint texture, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_TEXTUREPARAMETERI);
-    pb_push(texture);
-    pb_push(pname);
-    pb_push(param);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_TEXTUREPARAMETERI;
+    *cur++ = texture;
+    *cur++ = pname;
+    *cur++ = param;
 }
 
 void glGenerateTextureMipmap(GLuint texture)
 {
-    pb_push(SGL_CMD_GENERATETEXTUREMIPMAP);
-    pb_push(texture);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GENERATETEXTUREMIPMAP;
+    *cur++ = texture;
 }
 
 void glBindTextureUnit(GLuint unit, GLuint texture)
 {
-    pb_push(SGL_CMD_BINDTEXTUREUNIT);
-    pb_push(unit);
-    pb_push(texture);
+    glimpl_shadow_invalidate_list(glimpl_texture_binding_pnames, GLIMPL_ARRAY_COUNT(glimpl_texture_binding_pnames));
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDTEXTUREUNIT;
+    *cur++ = unit;
+    *cur++ = texture;
 }
 
 void glDisableVertexArrayAttrib(GLuint vaobj, GLuint index)
 {
-    pb_push(SGL_CMD_DISABLEVERTEXARRAYATTRIB);
-    pb_push(vaobj);
-    pb_push(index);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_DISABLEVERTEXARRAYATTRIB;
+    *cur++ = vaobj;
+    *cur++ = index;
 }
 
 void glEnableVertexArrayAttrib(GLuint vaobj, GLuint index)
 {
-    pb_push(SGL_CMD_ENABLEVERTEXARRAYATTRIB);
-    pb_push(vaobj);
-    pb_push(index);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_ENABLEVERTEXARRAYATTRIB;
+    *cur++ = vaobj;
+    *cur++ = index;
 }
 
 void glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer)
@@ -6045,113 +8451,125 @@ void glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer)
     if (state != NULL)
         state->element_array_buffer = buffer;
 
-    pb_push(SGL_CMD_VERTEXARRAYELEMENTBUFFER);
-    pb_push(vaobj);
-    pb_push(buffer);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VERTEXARRAYELEMENTBUFFER;
+    *cur++ = vaobj;
+    *cur++ = buffer;
 }
 
 void glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
 {
-    pb_push(SGL_CMD_VERTEXARRAYVERTEXBUFFER);
-    pb_push(vaobj);
-    pb_push(bindingindex);
-    pb_push(buffer);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VERTEXARRAYVERTEXBUFFER;
+    *cur++ = vaobj;
+    *cur++ = bindingindex;
+    *cur++ = buffer;
     pb_push64(offset);
     pb_push(stride);
 }
 
 void glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex)
 {
-    pb_push(SGL_CMD_VERTEXARRAYATTRIBBINDING);
-    pb_push(vaobj);
-    pb_push(attribindex);
-    pb_push(bindingindex);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VERTEXARRAYATTRIBBINDING;
+    *cur++ = vaobj;
+    *cur++ = attribindex;
+    *cur++ = bindingindex;
 }
 
 void glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
 {
-    pb_push(SGL_CMD_VERTEXARRAYATTRIBFORMAT);
-    pb_push(vaobj);
-    pb_push(attribindex);
-    pb_push(size);
-    pb_push(type);
-    pb_push(normalized);
-    pb_push(relativeoffset);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_VERTEXARRAYATTRIBFORMAT;
+    *cur++ = vaobj;
+    *cur++ = attribindex;
+    *cur++ = size;
+    *cur++ = type;
+    *cur++ = normalized;
+    *cur++ = relativeoffset;
 }
 
 void glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
 {
-    pb_push(SGL_CMD_VERTEXARRAYATTRIBIFORMAT);
-    pb_push(vaobj);
-    pb_push(attribindex);
-    pb_push(size);
-    pb_push(type);
-    pb_push(relativeoffset);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXARRAYATTRIBIFORMAT;
+    *cur++ = vaobj;
+    *cur++ = attribindex;
+    *cur++ = size;
+    *cur++ = type;
+    *cur++ = relativeoffset;
 }
 
 void glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
 {
-    pb_push(SGL_CMD_VERTEXARRAYATTRIBLFORMAT);
-    pb_push(vaobj);
-    pb_push(attribindex);
-    pb_push(size);
-    pb_push(type);
-    pb_push(relativeoffset);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXARRAYATTRIBLFORMAT;
+    *cur++ = vaobj;
+    *cur++ = attribindex;
+    *cur++ = size;
+    *cur++ = type;
+    *cur++ = relativeoffset;
 }
 
 void glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor)
 {
-    pb_push(SGL_CMD_VERTEXARRAYBINDINGDIVISOR);
-    pb_push(vaobj);
-    pb_push(bindingindex);
-    pb_push(divisor);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VERTEXARRAYBINDINGDIVISOR;
+    *cur++ = vaobj;
+    *cur++ = bindingindex;
+    *cur++ = divisor;
 }
 
 void glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
 {
-    pb_push(SGL_CMD_GETQUERYBUFFEROBJECTI64V);
-    pb_push(id);
-    pb_push(buffer);
-    pb_push(pname);
-    pb_push(offset);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_GETQUERYBUFFEROBJECTI64V;
+    *cur++ = id;
+    *cur++ = buffer;
+    *cur++ = pname;
+    *cur++ = offset;
 }
 
 void glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
 {
-    pb_push(SGL_CMD_GETQUERYBUFFEROBJECTIV);
-    pb_push(id);
-    pb_push(buffer);
-    pb_push(pname);
-    pb_push(offset);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_GETQUERYBUFFEROBJECTIV;
+    *cur++ = id;
+    *cur++ = buffer;
+    *cur++ = pname;
+    *cur++ = offset;
 }
 
 void glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
 {
-    pb_push(SGL_CMD_GETQUERYBUFFEROBJECTUI64V);
-    pb_push(id);
-    pb_push(buffer);
-    pb_push(pname);
-    pb_push(offset);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_GETQUERYBUFFEROBJECTUI64V;
+    *cur++ = id;
+    *cur++ = buffer;
+    *cur++ = pname;
+    *cur++ = offset;
 }
 
 void glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
 {
-    pb_push(SGL_CMD_GETQUERYBUFFEROBJECTUIV);
-    pb_push(id);
-    pb_push(buffer);
-    pb_push(pname);
-    pb_push(offset);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_GETQUERYBUFFEROBJECTUIV;
+    *cur++ = id;
+    *cur++ = buffer;
+    *cur++ = pname;
+    *cur++ = offset;
 }
 
 void glMemoryBarrierByRegion(GLbitfield barriers)
 {
-    pb_push(SGL_CMD_MEMORYBARRIERBYREGION);
-    pb_push(barriers);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_MEMORYBARRIERBYREGION;
+    *cur++ = barriers;
 }
 
 GLenum glGetGraphicsResetStatus(void)
 {
-    pb_push(SGL_CMD_GETGRAPHICSRESETSTATUS);
+    glimpl_push_command(SGL_CMD_GETGRAPHICSRESETSTATUS);
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -6159,15 +8577,16 @@ GLenum glGetGraphicsResetStatus(void)
 
 void glTextureBarrier(void)
 {
-    pb_push(SGL_CMD_TEXTUREBARRIER);
+    glimpl_push_command(SGL_CMD_TEXTUREBARRIER);
 }
 
 void glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp)
 {
-    pb_push(SGL_CMD_POLYGONOFFSETCLAMP);
-    pb_pushf(factor);
-    pb_pushf(units);
-    pb_pushf(clamp);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_POLYGONOFFSETCLAMP;
+    *(float*)cur++ = factor;
+    *(float*)cur++ = units;
+    *(float*)cur++ = clamp;
 }
 
 void glColor3bv(const GLbyte* v)
@@ -7093,21 +9512,24 @@ void glPolygonStipple(const GLubyte* mask)
 {
     int *pmask = (int*)mask;
 
-    pb_push(SGL_CMD_POLYGONSTIPPLE);
+    int *cur = glimpl_begin(1 + 32 * 32 / 4);
+    *cur++ = SGL_CMD_POLYGONSTIPPLE;
     for (int i = 0; i < 32 * 32 / 4; i++)
-        pb_push(pmask[i]);
+        *cur++ = pmask[i];
 }
 
 void glTexEnvfv(GLenum target, GLenum pname, const GLfloat* params)
 {
+    int *cur;
     if (pname == GL_TEXTURE_ENV_COLOR) {
-        pb_push(SGL_CMD_TEXENVFV);
-        pb_push(target);
-        pb_push(pname);
-        pb_pushf(params[0]);
-        pb_pushf(params[1]);
-        pb_pushf(params[2]);
-        pb_pushf(params[3]);
+        cur = glimpl_begin(7);
+        *cur++ = SGL_CMD_TEXENVFV;
+        *cur++ = target;
+        *cur++ = pname;
+        *(float*)cur++ = params[0];
+        *(float*)cur++ = params[1];
+        *(float*)cur++ = params[2];
+        *(float*)cur++ = params[3];
         return;
     }
 
@@ -7116,14 +9538,16 @@ void glTexEnvfv(GLenum target, GLenum pname, const GLfloat* params)
 
 void glTexEnviv(GLenum target, GLenum pname, const GLint* params)
 {
+    int *cur;
     if (pname == GL_TEXTURE_ENV_COLOR) {
-        pb_push(SGL_CMD_TEXENVFV);
-        pb_push(target);
-        pb_push(pname);
-        pb_push(params[0]);
-        pb_push(params[1]);
-        pb_push(params[2]);
-        pb_push(params[3]);
+        cur = glimpl_begin(7);
+        *cur++ = SGL_CMD_TEXENVFV;
+        *cur++ = target;
+        *cur++ = pname;
+        *cur++ = params[0];
+        *cur++ = params[1];
+        *cur++ = params[2];
+        *cur++ = params[3];
         return;
     }
 
@@ -7152,9 +9576,10 @@ void glTexGeniv(GLenum coord, GLenum pname, const GLint* params)
 
 void glFeedbackBuffer(GLsizei size, GLenum type, GLfloat* buffer)
 {
-    pb_push(SGL_CMD_FEEDBACKBUFFER);
-    pb_push(size);
-    pb_push(type);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_FEEDBACKBUFFER;
+    *cur++ = size;
+    *cur++ = type;
 
     glimpl_submit();
     memcpy(buffer, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), size * sizeof(float));
@@ -7162,8 +9587,9 @@ void glFeedbackBuffer(GLsizei size, GLenum type, GLfloat* buffer)
 
 void glSelectBuffer(GLsizei size, GLuint* buffer)
 {
-    pb_push(SGL_CMD_SELECTBUFFER);
-    pb_push(size);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_SELECTBUFFER;
+    *cur++ = size;
 
     glimpl_submit();
     memcpy(buffer, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), size * sizeof(float));
@@ -7171,32 +9597,32 @@ void glSelectBuffer(GLsizei size, GLuint* buffer)
 
 void glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble* points)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(order);
+    glimpl_begin_upload(order, 6);
     for (int i = 0; i < order; i++)
         pb_pushf(points[i * stride]);
     
-    pb_push(SGL_CMD_MAP1F); /* not a mistake; cant handle doubles */
-    pb_push(target);
-    pb_pushf(u1);
-    pb_pushf(u2);
-    pb_push(stride);
-    pb_push(order);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_MAP1F; /* not a mistake; cant handle doubles */
+    *cur++ = target;
+    *(float*)cur++ = u1;
+    *(float*)cur++ = u2;
+    *cur++ = stride;
+    *cur++ = order;
 }
 
 void glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat* points)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(order);
+    glimpl_begin_upload(order, 6);
     for (int i = 0; i < order; i++)
         pb_pushf(points[i * stride]);
     
-    pb_push(SGL_CMD_MAP1F);
-    pb_push(target);
-    pb_pushf(u1);
-    pb_pushf(u2);
-    pb_push(stride);
-    pb_push(order);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_MAP1F;
+    *cur++ = target;
+    *(float*)cur++ = u1;
+    *(float*)cur++ = u2;
+    *cur++ = stride;
+    *cur++ = order;
 }
 
 /*
@@ -7219,38 +9645,34 @@ void glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder,
 
 void glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat* values)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(mapsize);
-    for (int i = 0; i < mapsize; i++)
-        pb_pushf(values[i]);
+    glimpl_upload_buffer(values, (size_t)mapsize * sizeof(*values));
 
-    pb_push(SGL_CMD_PIXELMAPFV);
-    pb_push(map);
-    pb_push(mapsize);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_PIXELMAPFV;
+    *cur++ = map;
+    *cur++ = mapsize;
 }
 
 void glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint* values)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(mapsize);
-    for (int i = 0; i < mapsize; i++)
-        pb_push(values[i]);
+    glimpl_upload_buffer(values, (size_t)mapsize * sizeof(*values));
 
-    pb_push(SGL_CMD_PIXELMAPUIV);
-    pb_push(map);
-    pb_push(mapsize);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_PIXELMAPUIV;
+    *cur++ = map;
+    *cur++ = mapsize;
 }
 
 void glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort* values)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(mapsize);
+    glimpl_begin_upload(mapsize, 3);
     for (int i = 0; i < mapsize; i++)
         pb_push(values[i]);
 
-    pb_push(SGL_CMD_PIXELMAPUIV); /* not a mistake; don't passthru short */
-    pb_push(map);
-    pb_push(mapsize);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_PIXELMAPUIV; /* not a mistake; don't passthru short */
+    *cur++ = map;
+    *cur++ = mapsize;
 }
 
 void glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels)
@@ -7260,8 +9682,9 @@ void glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, con
 
 void glGetClipPlane(GLenum plane, GLdouble* equation)
 {
-    pb_push(SGL_CMD_GETCLIPPLANE);
-    pb_push(plane);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GETCLIPPLANE;
+    *cur++ = plane;
     pb_push(0); /* is dst float? */
 
     glimpl_submit();
@@ -7270,8 +9693,9 @@ void glGetClipPlane(GLenum plane, GLdouble* equation)
 
 void glGetClipPlanef(GLenum plane, GLfloat* equation)
 {
-    pb_push(SGL_CMD_GETCLIPPLANE);
-    pb_push(plane);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GETCLIPPLANE;
+    *cur++ = plane;
     pb_push(1); /* is dst float? */
 
     glimpl_submit();
@@ -7293,9 +9717,10 @@ void glGetLightfv(GLenum light, GLenum pname, GLfloat* params)
         break;
     }
 
-    pb_push(SGL_CMD_GETLIGHTFV);
-    pb_push(light);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETLIGHTFV;
+    *cur++ = light;
+    *cur++ = pname;
 
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), size * sizeof(float));
@@ -7316,9 +9741,10 @@ void glGetLightiv(GLenum light, GLenum pname, GLint* params)
         break;
     }
 
-    pb_push(SGL_CMD_GETLIGHTIV);
-    pb_push(light);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETLIGHTIV;
+    *cur++ = light;
+    *cur++ = pname;
 
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), size * sizeof(int));
@@ -7354,9 +9780,10 @@ void glGetMaterialfv(GLenum face, GLenum pname, GLfloat* params)
         break;
     }
 
-    pb_push(SGL_CMD_GETMATERIALFV);
-    pb_push(face);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETMATERIALFV;
+    *cur++ = face;
+    *cur++ = pname;
 
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), size * sizeof(float));
@@ -7377,9 +9804,10 @@ void glGetMaterialiv(GLenum face, GLenum pname, GLint* params)
         break;
     }
 
-    pb_push(SGL_CMD_GETMATERIALIV);
-    pb_push(face);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETMATERIALIV;
+    *cur++ = face;
+    *cur++ = pname;
 
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), size * sizeof(int));
@@ -7407,9 +9835,10 @@ void glGetPolygonStipple(GLubyte* mask)
 
 void glGetTexEnvfv(GLenum target, GLenum pname, GLfloat* params)
 {
-    pb_push(SGL_CMD_GETTEXENVFV);
-    pb_push(target);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETTEXENVFV;
+    *cur++ = target;
+    *cur++ = pname;
     
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), sizeof(float) + ((pname == GL_TEXTURE_ENV_COLOR) * (3 * sizeof(float))));
@@ -7417,9 +9846,10 @@ void glGetTexEnvfv(GLenum target, GLenum pname, GLfloat* params)
 
 void glGetTexEnviv(GLenum target, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETTEXENVIV);
-    pb_push(target);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETTEXENVIV;
+    *cur++ = target;
+    *cur++ = pname;
     
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), sizeof(int) + ((pname == GL_TEXTURE_ENV_COLOR) * (3 * sizeof(int))));
@@ -7427,9 +9857,10 @@ void glGetTexEnviv(GLenum target, GLenum pname, GLint* params)
 
 void glGetTexGendv(GLenum coord, GLenum pname, GLdouble* params)
 {
-    pb_push(SGL_CMD_GETTEXGENDV);
-    pb_push(coord);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETTEXGENDV;
+    *cur++ = coord;
+    *cur++ = pname;
     
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), sizeof(double) + ((pname == GL_OBJECT_PLANE || pname == GL_EYE_PLANE) * (3 * sizeof(double))));
@@ -7437,9 +9868,10 @@ void glGetTexGendv(GLenum coord, GLenum pname, GLdouble* params)
 
 void glGetTexGenfv(GLenum coord, GLenum pname, GLfloat* params)
 {
-    pb_push(SGL_CMD_GETTEXGENFV);
-    pb_push(coord);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETTEXGENFV;
+    *cur++ = coord;
+    *cur++ = pname;
     
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), sizeof(float) + ((pname == GL_OBJECT_PLANE || pname == GL_EYE_PLANE) * (3 * sizeof(float))));
@@ -7447,9 +9879,10 @@ void glGetTexGenfv(GLenum coord, GLenum pname, GLfloat* params)
 
 void glGetTexGeniv(GLenum coord, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETTEXGENIV);
-    pb_push(coord);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETTEXGENIV;
+    *cur++ = coord;
+    *cur++ = pname;
     
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), sizeof(int) + ((pname == GL_OBJECT_PLANE || pname == GL_EYE_PLANE) * (3 * sizeof(int))));
@@ -7457,27 +9890,49 @@ void glGetTexGeniv(GLenum coord, GLenum pname, GLint* params)
 
 void glCallLists(GLsizei n, GLenum type, const void* lists)
 {
-    for (int i = 0; i < n; i++) {
-        switch (type) {
-        case GL_BYTE:
-        case GL_UNSIGNED_BYTE:
-            glCallList(((unsigned char*)lists)[i]);
-            break;
-        case GL_SHORT:
-        case GL_UNSIGNED_SHORT:
-            glCallList(((unsigned short*)lists)[i]);
-            break;
-        case GL_INT:
-        case GL_UNSIGNED_INT:
-            glCallList(((unsigned int*)lists)[i]);
-            break;
-        case GL_FLOAT:
-            glCallList(((float*)lists)[i]);
-            break;
-        /*
-         * GL_2_BYTES GL_3_BYTES GL_4_BYTES
-         */
-        }
+    size_t elem_size;
+
+    switch (type) {
+    case GL_BYTE:
+    case GL_UNSIGNED_BYTE:
+        elem_size = 1;
+        break;
+    case GL_SHORT:
+    case GL_UNSIGNED_SHORT:
+    case GL_2_BYTES:
+        elem_size = 2;
+        break;
+    case GL_3_BYTES:
+        elem_size = 3;
+        break;
+    case GL_INT:
+    case GL_UNSIGNED_INT:
+    case GL_FLOAT:
+    case GL_4_BYTES:
+        elem_size = 4;
+        break;
+    default:
+        return;
+    }
+
+    glimpl_shadow_invalidate_all();
+
+    /*
+     * names go over as they are, the host applies the list base and
+     * decodes the type; too many for one push buffer go in parts
+     */
+    size_t chunk = (pb_capacity() - GLIMPL_UPLOAD_HEADROOM) / elem_size;
+    for (size_t start = 0; (GLsizei)start < n; start += chunk) {
+        size_t count = MIN(chunk, (size_t)n - start);
+        size_t size = count * elem_size;
+
+        glimpl_reserve(size + GLIMPL_UPLOAD_HEADROOM);
+        int *cur = glimpl_begin(4);
+        *cur++ = SGL_CMD_CALLLISTS;
+        *cur++ = count;
+        *cur++ = type;
+        *cur++ = CEIL_DIV(size, sizeof(int));
+        pb_memcpy((const char*)lists + start * elem_size, size);
     }
 }
 
@@ -7544,12 +9999,14 @@ void glGetPointerv(GLenum pname, GLvoid **params)
 
 GLboolean glAreTexturesResident(GLsizei n, const GLuint* textures, GLboolean* residences)
 {
+    int *cur;
     GLboolean res = GL_TRUE;
     GLboolean *p = residences;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_ARETEXTURESRESIDENT);
-        pb_push(textures[i]);
+        cur = glimpl_begin(2);
+        *cur++ = SGL_CMD_ARETEXTURESRESIDENT;
+        *cur++ = textures[i];
 
         glimpl_submit();
         *p = pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -7562,10 +10019,12 @@ GLboolean glAreTexturesResident(GLsizei n, const GLuint* textures, GLboolean* re
 
 void glPrioritizeTextures(GLsizei n, const GLuint* textures, const GLfloat* priorities)
 {
+    int *cur;
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_PRIORITIZETEXTURES);
-        pb_push(textures[i]);
-        pb_pushf(priorities[i]);
+        cur = glimpl_begin(3);
+        *cur++ = SGL_CMD_PRIORITIZETEXTURES;
+        *cur++ = textures[i];
+        *(float*)cur++ = priorities[i];
     }
 }
 
@@ -7573,19 +10032,18 @@ void glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, G
 {
     glimpl_submit();
 
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(imageSize / 4);
-    pb_memcpy((void*)data, imageSize);
+    glimpl_upload_asset(data, imageSize);
 
-    pb_push(SGL_CMD_COMPRESSEDTEXIMAGE3D);
-    pb_push(target);
-    pb_push(level);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
-    pb_push(depth);
-    pb_push(border);
-    pb_push(imageSize);
+    int *cur = glimpl_begin(9);
+    *cur++ = SGL_CMD_COMPRESSEDTEXIMAGE3D;
+    *cur++ = target;
+    *cur++ = level;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = depth;
+    *cur++ = border;
+    *cur++ = imageSize;
 
     glimpl_submit();
 }
@@ -7594,19 +10052,18 @@ void glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, G
 {
     glimpl_submit();
 
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(imageSize / 4);
-    pb_memcpy((void*)data, imageSize);
-
-    pb_push(SGL_CMD_COMPRESSEDTEXIMAGE2D);
-    pb_push(target);
-    pb_push(level);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(height);
-    pb_push(border);
-    pb_push(imageSize);
-
+    glimpl_upload_asset(data, imageSize);
+
+    int *cur = glimpl_begin(8);
+    *cur++ = SGL_CMD_COMPRESSEDTEXIMAGE2D;
+    *cur++ = target;
+    *cur++ = level;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = border;
+    *cur++ = imageSize;
+
     glimpl_submit();
 }
 
@@ -7614,17 +10071,16 @@ void glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, G
 {
     glimpl_submit();
 
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(imageSize / 4);
-    pb_memcpy((void*)data, imageSize);
+    glimpl_upload_asset(data, imageSize);
 
-    pb_push(SGL_CMD_COMPRESSEDTEXIMAGE1D);
-    pb_push(target);
-    pb_push(level);
-    pb_push(internalformat);
-    pb_push(width);
-    pb_push(border);
-    pb_push(imageSize);
+    int *cur = glimpl_begin(7);
+    *cur++ = SGL_CMD_COMPRESSEDTEXIMAGE1D;
+    *cur++ = target;
+    *cur++ = level;
+    *cur++ = internalformat;
+    *cur++ = width;
+    *cur++ = border;
+    *cur++ = imageSize;
 
     glimpl_submit();
 }
@@ -7657,42 +10113,77 @@ void glGetCompressedTexImage(GLenum target, GLint level, void* img)
 
 void glLoadTransposeMatrixf(const GLfloat* m)
 {
-    pb_push(SGL_CMD_LOADTRANSPOSEMATRIXF);
+    int *cur = glimpl_begin(17);
+    *cur++ = SGL_CMD_LOADTRANSPOSEMATRIXF;
     for (int i = 0; i < 16; i++)
-        pb_pushf(m[i]);
+        *(float*)cur++ = m[i];
 }
 
 void glLoadTransposeMatrixd(const GLdouble* m)
 {
-    pb_push(SGL_CMD_LOADTRANSPOSEMATRIXF);
+    int *cur = glimpl_begin(17);
+    *cur++ = SGL_CMD_LOADTRANSPOSEMATRIXF;
     for (int i = 0; i < 16; i++)
-        pb_pushf(m[i]);
+        *(float*)cur++ = m[i];
 }
 
 void glMultTransposeMatrixf(const GLfloat* m)
 {
-    pb_push(SGL_CMD_MULTTRANSPOSEMATRIXF);
+    int *cur = glimpl_begin(17);
+    *cur++ = SGL_CMD_MULTTRANSPOSEMATRIXF;
     for (int i = 0; i < 16; i++)
-        pb_pushf(m[i]);
+        *(float*)cur++ = m[i];
 }
 
 void glMultTransposeMatrixd(const GLdouble* m)
 {
-    pb_push(SGL_CMD_MULTTRANSPOSEMATRIXF);
+    int *cur = glimpl_begin(17);
+    *cur++ = SGL_CMD_MULTTRANSPOSEMATRIXF;
     for (int i = 0; i < 16; i++)
-        pb_pushf(m[i]);
+        *(float*)cur++ = m[i];
 }
 
 void glMultiDrawArrays(GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawcount)
 {
-    for (int i = 0; i < drawcount; i++)
-        glDrawArrays(mode, first[i], count[i]);
+    bool client_managed = glimpl_has_client_managed_draw_state();
+    int *cur;
+
+    for (int start = 0; start < drawcount;) {
+        int n = 0, lo = 0, hi = 0;
+        size_t vertices = 0;
+
+        for (; start + n < drawcount && n < SGL_MULTIDRAW_MAX; n++) {
+            int draw_first = first[start + n], draw_count = count[start + n];
+            if (draw_count <= 0)
+                continue;
+
+            int new_lo = vertices == 0 ? draw_first : MIN(lo, draw_first);
+            int new_hi = vertices == 0 ? draw_first + draw_count : MAX(hi, draw_first + draw_count);
+            if (client_managed && vertices != 0 && !glimpl_multidraw_dense(new_lo, new_hi, vertices + draw_count))
+                break;
+
+            lo = new_lo;
+            hi = new_hi;
+            vertices += draw_count;
+        }
+
+        glimpl_reserve(glimpl_client_managed_draw_state_size(hi - lo) + (3 + 2 * (size_t)n) * sizeof(int));
+        glimpl_push_client_managed_draw_state(lo, hi - lo);
+
+        cur = glimpl_begin(3 + 2 * (size_t)n);
+        *cur++ = SGL_CMD_MULTIDRAWARRAYS;
+        *cur++ = mode;
+        *cur++ = n;
+        memcpy(cur, first + start, n * sizeof(*first));
+        memcpy(cur + n, count + start, n * sizeof(*count));
+
+        start += n;
+    }
 }
 
 void glMultiDrawElements(GLenum mode, const GLsizei* count, GLenum type, const void* const*indices, GLsizei drawcount)
 {
-    for (int i = 0; i < drawcount; i++)
-        glDrawElements(mode, count[i], type, indices[i]);
+    glimpl_multi_draw_elements(SGL_CMD_MULTIDRAWELEMENTS, mode, count, type, indices, drawcount, NULL);
 }
 
 void glPointParameterfv(GLenum pname, const GLfloat* params)
@@ -7717,17 +10208,15 @@ void glFogCoorddv(const GLdouble* coord)
 
 void glDeleteQueries(GLsizei n, const GLuint* ids)
 {
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEQUERIES);
-        pb_push(ids[i]);
-    }
+    glimpl_delete_names(SGL_CMD_DELETEQUERIES, n, ids);
 }
 
 void glGetQueryiv(GLenum target, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETQUERYIV);
-    pb_push(target);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETQUERYIV;
+    *cur++ = target;
+    *cur++ = pname;
 
     glimpl_submit();
     *params = pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -7735,9 +10224,10 @@ void glGetQueryiv(GLenum target, GLenum pname, GLint* params)
 
 void glGetQueryObjectiv(GLuint id, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETQUERYOBJECTIV);
-    pb_push(id);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETQUERYOBJECTIV;
+    *cur++ = id;
+    *cur++ = pname;
 
     glimpl_submit();
     *params = pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -7745,9 +10235,10 @@ void glGetQueryObjectiv(GLuint id, GLenum pname, GLint* params)
 
 void glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint* params)
 {
-    pb_push(SGL_CMD_GETQUERYOBJECTUIV);
-    pb_push(id);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETQUERYOBJECTUIV;
+    *cur++ = id;
+    *cur++ = pname;
 
     glimpl_submit();
     *params = pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -7760,7 +10251,16 @@ void glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void
 
 void glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void* data)
 {
-    STUB();
+    if (size <= 0)
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_GETBUFFERSUBDATA;
+    *cur++ = target;
+    *cur++ = offset;
+    *cur++ = size;
+
+    glimpl_download_buffer(data, size);
 }
 
 void* glMapBuffer(GLenum target, GLenum access)
@@ -7780,25 +10280,28 @@ void glGetBufferPointerv(GLenum target, GLenum pname, void* *params)
 
 void glDrawBuffers(GLsizei n, const GLenum* bufs)
 {
-    pb_push(SGL_CMD_DRAWBUFFERS);
-    pb_push(n);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_DRAWBUFFERS;
+    *cur++ = n;
     for (int i = 0; i < n; i++)
         pb_push(bufs[i]);
 }
 
 void glBindAttribLocation(GLuint program, GLuint index, const GLchar* name)
 {
-    pb_push(SGL_CMD_BINDATTRIBLOCATION);
-    pb_push(program);
-    pb_push(index);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDATTRIBLOCATION;
+    *cur++ = program;
+    *cur++ = index;
     push_string(name);
 }
 
 void glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name)
 {
-    pb_push(SGL_CMD_GETACTIVEATTRIB);
-    pb_push(program);
-    pb_push(index);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETACTIVEATTRIB;
+    *cur++ = program;
+    *cur++ = index;
     pb_push(512); /* bufSize */
     
     glimpl_submit();
@@ -7814,9 +10317,10 @@ void glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei* l
 
 void glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name)
 {
-    pb_push(SGL_CMD_GETACTIVEUNIFORM);
-    pb_push(program);
-    pb_push(index);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETACTIVEUNIFORM;
+    *cur++ = program;
+    *cur++ = index;
     pb_push(512); /* bufSize */
     
     glimpl_submit();
@@ -7832,8 +10336,9 @@ void glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei*
 
 void glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei* count, GLuint* shaders)
 {
-    pb_push(SGL_CMD_GETATTACHEDSHADERS);
-    pb_push(program);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GETATTACHEDSHADERS;
+    *cur++ = program;
     pb_push(128); /* maxCount */
 
     glimpl_submit();
@@ -7847,8 +10352,9 @@ void glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei* count, GLui
 
 void glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
 {
-    pb_push(SGL_CMD_GETPROGRAMINFOLOG);
-    pb_push(program);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GETPROGRAMINFOLOG;
+    *cur++ = program;
     pb_push(512); /* bufSize */
 
     glimpl_submit();
@@ -7862,8 +10368,9 @@ void glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei* length, GLcha
 
 void glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
 {
-    pb_push(SGL_CMD_GETSHADERINFOLOG);
-    pb_push(shader);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GETSHADERINFOLOG;
+    *cur++ = shader;
     pb_push(512); /* bufSize */
 
     glimpl_submit();
@@ -7877,8 +10384,9 @@ void glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar*
 
 void glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* source)
 {
-    pb_push(SGL_CMD_GETSHADERSOURCE);
-    pb_push(shader);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GETSHADERSOURCE;
+    *cur++ = shader;
     pb_push(3072); /* bufSize */
 
     glimpl_submit();
@@ -7892,9 +10400,10 @@ void glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar*
 
 void glGetUniformfv(GLuint program, GLint location, GLfloat* params)
 {
-    pb_push(SGL_CMD_GETUNIFORMFV);
-    pb_push(program);
-    pb_push(location);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETUNIFORMFV;
+    *cur++ = program;
+    *cur++ = location;
 
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL), sizeof(float));
@@ -7902,9 +10411,10 @@ void glGetUniformfv(GLuint program, GLint location, GLfloat* params)
 
 void glGetUniformiv(GLuint program, GLint location, GLint* params)
 {
-    pb_push(SGL_CMD_GETUNIFORMIV);
-    pb_push(program);
-    pb_push(location);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETUNIFORMIV;
+    *cur++ = program;
+    *cur++ = location;
 
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL), sizeof(int));
@@ -7912,9 +10422,10 @@ void glGetUniformiv(GLuint program, GLint location, GLint* params)
 
 void glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble* params)
 {
-    pb_push(SGL_CMD_GETVERTEXATTRIBDV);
-    pb_push(index);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETVERTEXATTRIBDV;
+    *cur++ = index;
+    *cur++ = pname;
 
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), sizeof(GLdouble) + ((pname == GL_CURRENT_VERTEX_ATTRIB) * 3 * sizeof(GLdouble)));
@@ -7922,9 +10433,10 @@ void glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble* params)
 
 void glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat* params)
 {
-    pb_push(SGL_CMD_GETVERTEXATTRIBFV);
-    pb_push(index);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETVERTEXATTRIBFV;
+    *cur++ = index;
+    *cur++ = pname;
 
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), sizeof(float) + ((pname == GL_CURRENT_VERTEX_ATTRIB) * 3 * sizeof(float)));
@@ -7932,9 +10444,10 @@ void glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat* params)
 
 void glGetVertexAttribiv(GLuint index, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETVERTEXATTRIBIV);
-    pb_push(index);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETVERTEXATTRIBIV;
+    *cur++ = index;
+    *cur++ = pname;
 
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), sizeof(int) + ((pname == GL_CURRENT_VERTEX_ATTRIB) * 3 * sizeof(int)));
@@ -7947,213 +10460,208 @@ void glGetVertexAttribPointerv(GLuint index, GLenum pname, void* *pointer)
 
 void glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 2 * 2);
-    for (int i = 0; i < count * 2 * 2; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 2 * 2 * sizeof(*value));
 
-    pb_push(SGL_CMD_UNIFORMMATRIX2FV);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_UNIFORMMATRIX2FV;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 3 * 3);
-    for (int i = 0; i < count * 3 * 3; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 3 * 3 * sizeof(*value));
 
-    pb_push(SGL_CMD_UNIFORMMATRIX3FV);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_UNIFORMMATRIX3FV;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glVertexAttrib4Nbv(GLuint index, const GLbyte* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4NBV);
-    pb_push(index);
-    pb_push(v[0]);
-    pb_push(v[1]);
-    pb_push(v[2]);
-    pb_push(v[3]);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIB4NBV;
+    *cur++ = index;
+    *cur++ = v[0];
+    *cur++ = v[1];
+    *cur++ = v[2];
+    *cur++ = v[3];
 }
 
 void glVertexAttrib4Niv(GLuint index, const GLint* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4NIV);
-    pb_push(index);
-    pb_push(v[0]);
-    pb_push(v[1]);
-    pb_push(v[2]);
-    pb_push(v[3]);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIB4NIV;
+    *cur++ = index;
+    *cur++ = v[0];
+    *cur++ = v[1];
+    *cur++ = v[2];
+    *cur++ = v[3];
 }
 
 void glVertexAttrib4Nsv(GLuint index, const GLshort* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4NSV);
-    pb_push(index);
-    pb_push(v[0]);
-    pb_push(v[1]);
-    pb_push(v[2]);
-    pb_push(v[3]);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIB4NSV;
+    *cur++ = index;
+    *cur++ = v[0];
+    *cur++ = v[1];
+    *cur++ = v[2];
+    *cur++ = v[3];
 }
 
 void glVertexAttrib4Nuiv(GLuint index, const GLuint* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4NUIV);
-    pb_push(index);
-    pb_push(v[0]);
-    pb_push(v[1]);
-    pb_push(v[2]);
-    pb_push(v[3]);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIB4NUIV;
+    *cur++ = index;
+    *cur++ = v[0];
+    *cur++ = v[1];
+    *cur++ = v[2];
+    *cur++ = v[3];
 }
 
 void glVertexAttrib4Nusv(GLuint index, const GLushort* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4NUSV);
-    pb_push(index);
-    pb_push(v[0]);
-    pb_push(v[1]);
-    pb_push(v[2]);
-    pb_push(v[3]);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIB4NUSV;
+    *cur++ = index;
+    *cur++ = v[0];
+    *cur++ = v[1];
+    *cur++ = v[2];
+    *cur++ = v[3];
 }
 
 void glVertexAttrib4bv(GLuint index, const GLbyte* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4BV);
-    pb_push(index);
-    pb_push(v[0]);
-    pb_push(v[1]);
-    pb_push(v[2]);
-    pb_push(v[3]);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIB4BV;
+    *cur++ = index;
+    *cur++ = v[0];
+    *cur++ = v[1];
+    *cur++ = v[2];
+    *cur++ = v[3];
 }
 
 void glVertexAttrib4iv(GLuint index, const GLint* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4IV);
-    pb_push(index);
-    pb_push(v[0]);
-    pb_push(v[1]);
-    pb_push(v[2]);
-    pb_push(v[3]);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIB4IV;
+    *cur++ = index;
+    *cur++ = v[0];
+    *cur++ = v[1];
+    *cur++ = v[2];
+    *cur++ = v[3];
 }
 
 void glVertexAttrib4ubv(GLuint index, const GLubyte* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4UBV);
-    pb_push(index);
-    pb_push(v[0]);
-    pb_push(v[1]);
-    pb_push(v[2]);
-    pb_push(v[3]);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIB4UBV;
+    *cur++ = index;
+    *cur++ = v[0];
+    *cur++ = v[1];
+    *cur++ = v[2];
+    *cur++ = v[3];
 }
 
 void glVertexAttrib4uiv(GLuint index, const GLuint* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4UIV);
-    pb_push(index);
-    pb_push(v[0]);
-    pb_push(v[1]);
-    pb_push(v[2]);
-    pb_push(v[3]);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIB4UIV;
+    *cur++ = index;
+    *cur++ = v[0];
+    *cur++ = v[1];
+    *cur++ = v[2];
+    *cur++ = v[3];
 }
 
 void glVertexAttrib4usv(GLuint index, const GLushort* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4USV);
-    pb_push(index);
-    pb_push(v[0]);
-    pb_push(v[1]);
-    pb_push(v[2]);
-    pb_push(v[3]);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_VERTEXATTRIB4USV;
+    *cur++ = index;
+    *cur++ = v[0];
+    *cur++ = v[1];
+    *cur++ = v[2];
+    *cur++ = v[3];
 }
 
 void glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 2 * 3);
-    for (int i = 0; i < count * 2 * 3; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 2 * 3 * sizeof(*value));
 
-    pb_push(SGL_CMD_UNIFORMMATRIX2X3FV);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_UNIFORMMATRIX2X3FV;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 3 * 2);
-    for (int i = 0; i < count * 3 * 2; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 3 * 2 * sizeof(*value));
 
-    pb_push(SGL_CMD_UNIFORMMATRIX3X2FV);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_UNIFORMMATRIX3X2FV;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 2 * 4);
-    for (int i = 0; i < count * 2 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 2 * 4 * sizeof(*value));
 
-    pb_push(SGL_CMD_UNIFORMMATRIX2X4FV);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_UNIFORMMATRIX2X4FV;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 2 * 4);
-    for (int i = 0; i < count * 2 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 2 * 4 * sizeof(*value));
 
-    pb_push(SGL_CMD_UNIFORMMATRIX4X2FV);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_UNIFORMMATRIX4X2FV;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 3 * 4);
-    for (int i = 0; i < count * 3 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 3 * 4 * sizeof(*value));
 
-    pb_push(SGL_CMD_UNIFORMMATRIX3X4FV);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_UNIFORMMATRIX3X4FV;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 3 * 4);
-    for (int i = 0; i < count * 3 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 3 * 4 * sizeof(*value));
 
-    pb_push(SGL_CMD_UNIFORMMATRIX4X3FV);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_UNIFORMMATRIX4X3FV;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint* value)
 {
-    pb_push(SGL_CMD_CLEARBUFFERIV);
-    pb_push(buffer);
-    pb_push(drawbuffer);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_CLEARBUFFERIV;
+    *cur++ = buffer;
+    *cur++ = drawbuffer;
     
     pb_push(value[0]);
     pb_push(buffer == GL_COLOR ? value[1] : 0);
@@ -8173,43 +10681,44 @@ void glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat* value)
 
 void glGetBooleani_v(GLenum target, GLuint index, GLboolean* data)
 {
-    pb_push(SGL_CMD_GETBOOLEANI_V);
-    pb_push(target);
-    pb_push(index);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETBOOLEANI_V;
+    *cur++ = target;
+    *cur++ = index;
     glimpl_submit();
     GL_GET_MEMCPY_RETVAL_EX(target, data, GLboolean);
 }
 
 void glGetIntegeri_v(GLenum target, GLuint index, GLint* data)
 {
-    pb_push(SGL_CMD_GETINTEGERI_V);
-    pb_push(target);
-    pb_push(index);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETINTEGERI_V;
+    *cur++ = target;
+    *cur++ = index;
     glimpl_submit();
     GL_GET_MEMCPY_RETVAL_EX(target, data, GLint);
 }
 
 void glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar* const*varyings, GLenum bufferMode)
 {
-    glimpl_submit();
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_TRANSFORMFEEDBACKVARYINGS;
+    *cur++ = program;
+    *cur++ = count;
 
-    for (int i = 0; i < count; i++) {
-        pb_push(SGL_CMD_TRANSFORMFEEDBACKVARYINGS);
-        pb_push(program);
-        // pb_push(1);
+    for (int i = 0; i < count; i++)
         push_string(varyings[i]);
-        pb_push(bufferMode);
-    }
 
-    glimpl_submit();
+    pb_push(bufferMode);
 }
 
 void glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLsizei* size, GLenum* type, GLchar* name)
 {
-    pb_push(SGL_CMD_GETTRANSFORMFEEDBACKVARYING);
-    pb_push(program);
-    pb_push(index);
-    pb_push(bufSize);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_GETTRANSFORMFEEDBACKVARYING;
+    *cur++ = program;
+    *cur++ = index;
+    *cur++ = bufSize;
     glimpl_submit();
 
     // hope that data fits in SGL_OFFSET_REGISTER_RETVAL_V
@@ -8266,12 +10775,7 @@ void glGetUniformuiv(GLuint program, GLint location, GLuint* params)
 
 GLint glGetFragDataLocation(GLuint program, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETFRAGDATALOCATION);
-    pb_push(program);
-    push_string(name);
-
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    return glimpl_get_location(SGL_CMD_GETFRAGDATALOCATION, program, name);
 }
 
 void glTexParameterIiv(GLenum target, GLenum pname, const GLint* params)
@@ -8296,25 +10800,15 @@ void glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint* params)
 
 void glDeleteRenderbuffers(GLsizei n, const GLuint* renderbuffers)
 {
-    // to-do: should glDelete* end w/ submit?
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETERENDERBUFFERS);
-        // pb_push(1);
-        pb_push(renderbuffers[i]);
-    }
+    for (int i = 0; i < n; i++)
+        glimpl_shadow_unbind((const GLenum[]){ GL_RENDERBUFFER_BINDING }, 1, renderbuffers[i]);
+
+    glimpl_delete_names(SGL_CMD_DELETERENDERBUFFERS, n, renderbuffers);
 }
 
 void glGenRenderbuffers(GLsizei n, GLuint* renderbuffers)
 {
-    GLuint *p = renderbuffers;
-    
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENRENDERBUFFERS);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
-    }
+    glimpl_gen_names(SGL_CMD_GENRENDERBUFFERS, n, renderbuffers);
 }
 
 void glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint* params)
@@ -8324,11 +10818,10 @@ void glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint* params)
 
 void glDeleteFramebuffers(GLsizei n, const GLuint* framebuffers)
 {
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEFRAMEBUFFERS);
-        // pb_push(1);
-        pb_push(framebuffers[i]);
-    }
+    for (int i = 0; i < n; i++)
+        glimpl_shadow_unbind(glimpl_framebuffer_binding_pnames, GLIMPL_ARRAY_COUNT(glimpl_framebuffer_binding_pnames), framebuffers[i]);
+
+    glimpl_delete_names(SGL_CMD_DELETEFRAMEBUFFERS, n, framebuffers);
 }
 
 void glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint* params)
@@ -8346,13 +10839,14 @@ void glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void
     bool use_upload;
     uint64_t index_pointer;
 
-    if (!glimpl_prepare_draw_elements(count, type, indices, -1, &use_upload, &index_pointer))
+    if (!glimpl_prepare_draw_elements(count, type, indices, 0, -1, 0, &use_upload, &index_pointer))
         return;
 
-    pb_push(SGL_CMD_DRAWELEMENTSINSTANCED);
-    pb_push(mode);
-    pb_push(count);
-    pb_push(type);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_DRAWELEMENTSINSTANCED;
+    *cur++ = mode;
+    *cur++ = count;
+    *cur++ = type;
     pb_push64(index_pointer);
     pb_push(use_upload);
     pb_push(instancecount);
@@ -8360,11 +10854,13 @@ void glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void
 
 void glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar* const*uniformNames, GLuint* uniformIndices)
 {
+    int *cur;
     GLuint *p = uniformIndices;
     
     for (int i = 0; i < uniformCount; i++) {
-        pb_push(SGL_CMD_GETUNIFORMINDICES);
-        pb_push(program);
+        cur = glimpl_begin(2);
+        *cur++ = SGL_CMD_GETUNIFORMINDICES;
+        *cur++ = program;
         // pb_push(1);
         push_string(uniformNames[i]);
 
@@ -8375,11 +10871,13 @@ void glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar* con
 
 void glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint* uniformIndices, GLenum pname, GLint* params)
 {
+    int *cur;
     GLint *p = params;
     
     for (int i = 0; i < uniformCount; i++) {
-        pb_push(SGL_CMD_GETACTIVEUNIFORMSIV);
-        pb_push(program);
+        cur = glimpl_begin(2);
+        *cur++ = SGL_CMD_GETACTIVEUNIFORMSIV;
+        *cur++ = program;
         // pb_push(1);
         pb_push(uniformIndices[i]);
         pb_push(pname);
@@ -8391,10 +10889,11 @@ void glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint* u
 
 void glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformName)
 {
-    pb_push(SGL_CMD_GETACTIVEUNIFORMNAME);
-    pb_push(program);
-    pb_push(uniformIndex);
-    pb_push(bufSize);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_GETACTIVEUNIFORMNAME;
+    *cur++ = program;
+    *cur++ = uniformIndex;
+    *cur++ = bufSize;
 
     glimpl_submit();
 
@@ -8410,20 +10909,16 @@ void glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize
 
 GLuint glGetUniformBlockIndex(GLuint program, const GLchar* uniformBlockName)
 {
-    pb_push(SGL_CMD_GETUNIFORMBLOCKINDEX);
-    pb_push(program);
-    push_string(uniformBlockName);
-
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    return glimpl_get_location(SGL_CMD_GETUNIFORMBLOCKINDEX, program, uniformBlockName);
 }
 
 void glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETACTIVEUNIFORMBLOCKIV);
-    pb_push(program);
-    pb_push(uniformBlockIndex);
-    pb_push(pname);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_GETACTIVEUNIFORMBLOCKIV;
+    *cur++ = program;
+    *cur++ = uniformBlockIndex;
+    *cur++ = pname;
 
     glimpl_submit();
     *params = pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -8431,10 +10926,11 @@ void glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum
 
 void glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformBlockName)
 {
-    pb_push(SGL_CMD_GETACTIVEUNIFORMBLOCKNAME);
-    pb_push(program);
-    pb_push(uniformBlockIndex);
-    pb_push(bufSize);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_GETACTIVEUNIFORMBLOCKNAME;
+    *cur++ = program;
+    *cur++ = uniformBlockIndex;
+    *cur++ = bufSize;
 
     glimpl_submit();
 
@@ -8453,13 +10949,14 @@ void glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const voi
     bool use_upload;
     uint64_t index_pointer;
 
-    if (!glimpl_prepare_draw_elements(count, type, indices, -1, &use_upload, &index_pointer))
+    if (!glimpl_prepare_draw_elements(count, type, indices, 0, -1, basevertex, &use_upload, &index_pointer))
         return;
 
-    pb_push(SGL_CMD_DRAWELEMENTSBASEVERTEX);
-    pb_push(mode);
-    pb_push(count);
-    pb_push(type);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_DRAWELEMENTSBASEVERTEX;
+    *cur++ = mode;
+    *cur++ = count;
+    *cur++ = type;
     pb_push64(index_pointer);
     pb_push(use_upload);
     pb_push(basevertex);
@@ -8469,17 +10966,17 @@ void glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsize
 {
     bool use_upload;
     uint64_t index_pointer;
-    int upload_hint = (int)end + MAX(basevertex, 0) + 1;
 
-    if (!glimpl_prepare_draw_elements(count, type, indices, upload_hint, &use_upload, &index_pointer))
+    if (!glimpl_prepare_draw_elements(count, type, indices, (int)start, (int)end, basevertex, &use_upload, &index_pointer))
         return;
 
-    pb_push(SGL_CMD_DRAWRANGEELEMENTSBASEVERTEX);
-    pb_push(mode);
-    pb_push(start);
-    pb_push(end);
-    pb_push(count);
-    pb_push(type);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_DRAWRANGEELEMENTSBASEVERTEX;
+    *cur++ = mode;
+    *cur++ = start;
+    *cur++ = end;
+    *cur++ = count;
+    *cur++ = type;
     pb_push64(index_pointer);
     pb_push(use_upload);
     pb_push(basevertex);
@@ -8490,13 +10987,14 @@ void glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type,
     bool use_upload;
     uint64_t index_pointer;
 
-    if (!glimpl_prepare_draw_elements(count, type, indices, -1, &use_upload, &index_pointer))
+    if (!glimpl_prepare_draw_elements(count, type, indices, 0, -1, basevertex, &use_upload, &index_pointer))
         return;
 
-    pb_push(SGL_CMD_DRAWELEMENTSINSTANCEDBASEVERTEX);
-    pb_push(mode);
-    pb_push(count);
-    pb_push(type);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_DRAWELEMENTSINSTANCEDBASEVERTEX;
+    *cur++ = mode;
+    *cur++ = count;
+    *cur++ = type;
     pb_push64(index_pointer);
     pb_push(use_upload);
     pb_push(instancecount);
@@ -8505,8 +11003,7 @@ void glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type,
 
 void glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei* count, GLenum type, const void* const*indices, GLsizei drawcount, const GLint* basevertex)
 {
-    for (int i = 0; i < drawcount; i++)
-        glDrawElementsBaseVertex(mode, count[i], type, indices[i], basevertex[i]);
+    glimpl_multi_draw_elements(SGL_CMD_MULTIDRAWELEMENTSBASEVERTEX, mode, count, type, indices, drawcount, basevertex);
 }
 
 GLsync glFenceSync(GLenum condition, GLbitfield flags)
@@ -8597,9 +11094,10 @@ void glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64* params)
 
 void glGetMultisamplefv(GLenum pname, GLuint index, GLfloat* val)
 {
-    pb_push(SGL_CMD_GETMULTISAMPLEFV);
-    pb_push(pname);
-    pb_push(index);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETMULTISAMPLEFV;
+    *cur++ = pname;
+    *cur++ = index;
 
     glimpl_submit();
 
@@ -8608,17 +11106,19 @@ void glGetMultisamplefv(GLenum pname, GLuint index, GLfloat* val)
 
 void glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar* name)
 {
-    pb_push(SGL_CMD_BINDFRAGDATALOCATIONINDEXED);
-    pb_push(program);
-    pb_push(colorNumber);
-    pb_push(index);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_BINDFRAGDATALOCATIONINDEXED;
+    *cur++ = program;
+    *cur++ = colorNumber;
+    *cur++ = index;
     push_string(name);
 }
 
 GLint glGetFragDataIndex(GLuint program, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETFRAGDATAINDEX);
-    pb_push(program);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_GETFRAGDATAINDEX;
+    *cur++ = program;
     push_string(name);
 
     glimpl_submit();
@@ -8628,25 +11128,12 @@ GLint glGetFragDataIndex(GLuint program, const GLchar* name)
 
 void glGenSamplers(GLsizei count, GLuint* samplers)
 {
-    GLuint *p = samplers;
-
-    for (int i = 0; i < count; i++) {
-        pb_push(SGL_CMD_GENSAMPLERS);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
-    }
+    glimpl_gen_names(SGL_CMD_GENSAMPLERS, count, samplers);
 }
 
 void glDeleteSamplers(GLsizei count, const GLuint* samplers)
 {
-    for (int i = 0; i < count; i++) {
-        pb_push(SGL_CMD_DELETESAMPLERS);
-        // pb_push(1);
-
-        pb_push(samplers[i]);
-    }
+    glimpl_delete_names(SGL_CMD_DELETESAMPLERS, count, samplers);
 }
 
 void glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint* param)
@@ -8776,6 +11263,7 @@ void glSecondaryColorP3uiv(GLenum type, const GLuint* color)
 
 void glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer)
 {
+    int *cur;
     bool client_managed = glimpl_array_buffer_binding == 0;
 
     glimpl_vaps[index] = (struct gl_vertex_attrib_pointer){ 
@@ -8791,11 +11279,12 @@ void glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei strid
     };
 
     if (!client_managed) {
-        pb_push(SGL_CMD_VERTEXATTRIBIPOINTER);
-        pb_push(index);
-        pb_push(size);
-        pb_push(type);
-        pb_push(stride);
+        cur = glimpl_begin(5);
+        *cur++ = SGL_CMD_VERTEXATTRIBIPOINTER;
+        *cur++ = index;
+        *cur++ = size;
+        *cur++ = type;
+        *cur++ = stride;
         pb_push64((int64_t)(uintptr_t)pointer);
         pb_push(false);
     }
@@ -8808,8 +11297,9 @@ void glDrawArraysIndirect(GLenum mode, const void* indirect)
         return;
     }
     
-    pb_push(SGL_CMD_DRAWARRAYSINDIRECT);
-    pb_push(mode);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_DRAWARRAYSINDIRECT;
+    *cur++ = mode;
     pb_push64((int64_t)(uintptr_t)indirect);
 }
 
@@ -8820,9 +11310,10 @@ void glDrawElementsIndirect(GLenum mode, GLenum type, const void* indirect)
         return;
     }
     
-    pb_push(SGL_CMD_DRAWELEMENTSINDIRECT);
-    pb_push(mode);
-    pb_push(type);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_DRAWELEMENTSINDIRECT;
+    *cur++ = mode;
+    *cur++ = type;
     pb_push64((int64_t)(uintptr_t)indirect);
 }
 
@@ -8904,9 +11395,10 @@ void glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, co
 
 void glGetUniformdv(GLuint program, GLint location, GLdouble* params)
 {
-    pb_push(SGL_CMD_GETUNIFORMDV);
-    pb_push(program);
-    pb_push(location);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETUNIFORMDV;
+    *cur++ = program;
+    *cur++ = location;
 
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), sizeof(double));
@@ -8914,9 +11406,10 @@ void glGetUniformdv(GLuint program, GLint location, GLdouble* params)
 
 GLint glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETSUBROUTINEUNIFORMLOCATION);
-    pb_push(program);
-    pb_push(shadertype);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETSUBROUTINEUNIFORMLOCATION;
+    *cur++ = program;
+    *cur++ = shadertype;
     push_string(name);
 
     glimpl_submit();
@@ -8925,9 +11418,10 @@ GLint glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GL
 
 GLuint glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETSUBROUTINEINDEX);
-    pb_push(program);
-    pb_push(shadertype);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETSUBROUTINEINDEX;
+    *cur++ = program;
+    *cur++ = shadertype;
     push_string(name);
 
     glimpl_submit();
@@ -8936,11 +11430,12 @@ GLuint glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar* nam
 
 void glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint* values)
 {
-    pb_push(SGL_CMD_GETACTIVESUBROUTINEUNIFORMIV);
-    pb_push(program);
-    pb_push(shadertype);
-    pb_push(index);
-    pb_push(pname);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_GETACTIVESUBROUTINEUNIFORMIV;
+    *cur++ = program;
+    *cur++ = shadertype;
+    *cur++ = index;
+    *cur++ = pname;
 
     glimpl_submit();
     switch (pname) {
@@ -8959,11 +11454,12 @@ void glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint in
 
 void glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei* length, GLchar* name)
 {
-    pb_push(SGL_CMD_GETACTIVESUBROUTINEUNIFORMNAME);
-    pb_push(program);
-    pb_push(shadertype);
-    pb_push(index);
-    pb_push(bufsize);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_GETACTIVESUBROUTINEUNIFORMNAME;
+    *cur++ = program;
+    *cur++ = shadertype;
+    *cur++ = index;
+    *cur++ = bufsize;
 
     glimpl_submit();
 
@@ -8979,11 +11475,12 @@ void glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint
 
 void glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei* length, GLchar* name)
 {
-    pb_push(SGL_CMD_GETACTIVESUBROUTINENAME);
-    pb_push(program);
-    pb_push(shadertype);
-    pb_push(index);
-    pb_push(bufsize);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_GETACTIVESUBROUTINENAME;
+    *cur++ = program;
+    *cur++ = shadertype;
+    *cur++ = index;
+    *cur++ = bufsize;
 
     glimpl_submit();
 
@@ -8999,9 +11496,10 @@ void glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index,
 
 void glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint* indices)
 {
-    pb_push(SGL_CMD_UNIFORMSUBROUTINESUIV);
-    pb_push(shadertype);
-    pb_push(count);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_UNIFORMSUBROUTINESUIV;
+    *cur++ = shadertype;
+    *cur++ = count;
 
     for (int i = 0; i < count; i++)
         pb_push(indices[i]);
@@ -9009,9 +11507,10 @@ void glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint* ind
 
 void glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint* params)
 {
-    pb_push(SGL_CMD_GETUNIFORMSUBROUTINEUIV);
-    pb_push(shadertype);
-    pb_push(location);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETUNIFORMSUBROUTINEUIV;
+    *cur++ = shadertype;
+    *cur++ = location;
 
     glimpl_submit();
     *params = pb_read(SGL_OFFSET_REGISTER_RETVAL_V);
@@ -9019,10 +11518,11 @@ void glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint* params
 
 void glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint* values)
 {
-    pb_push(SGL_CMD_GETPROGRAMSTAGEIV);
-    pb_push(program);
-    pb_push(shadertype);
-    pb_push(pname);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_GETPROGRAMSTAGEIV;
+    *cur++ = program;
+    *cur++ = shadertype;
+    *cur++ = pname;
 
     glimpl_submit();
     *values = pb_read(SGL_OFFSET_REGISTER_RETVAL_V);
@@ -9032,9 +11532,10 @@ void glPatchParameterfv(GLenum pname, const GLfloat* values)
 {
     int count = pname == GL_PATCH_DEFAULT_OUTER_LEVEL ? 4 : 2;
 
-    pb_push(SGL_CMD_PATCHPARAMETERFV);
-    pb_push(pname);
-    pb_push(count);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_PATCHPARAMETERFV;
+    *cur++ = pname;
+    *cur++ = count;
 
     for (int i = 0; i < count; i++)
         pb_pushf(values[i]);
@@ -9042,33 +11543,21 @@ void glPatchParameterfv(GLenum pname, const GLfloat* values)
 
 void glDeleteTransformFeedbacks(GLsizei n, const GLuint* ids)
 {
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETETRANSFORMFEEDBACKS);
-        // pb_push(1);
-
-        pb_push(ids[i]);
-    }
+    glimpl_delete_names(SGL_CMD_DELETETRANSFORMFEEDBACKS, n, ids);
 }
 
 void glGenTransformFeedbacks(GLsizei n, GLuint* ids)
 {
-    GLuint *p = ids;
-
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENTRANSFORMFEEDBACKS);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
-    }
+    glimpl_gen_names(SGL_CMD_GENTRANSFORMFEEDBACKS, n, ids);
 }
 
 void glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETQUERYINDEXEDIV);
-    pb_push(target);
-    pb_push(index);
-    pb_push(pname);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_GETQUERYINDEXEDIV;
+    *cur++ = target;
+    *cur++ = index;
+    *cur++ = pname;
 
     glimpl_submit();
     *params = pb_read(SGL_OFFSET_REGISTER_RETVAL_V);
@@ -9076,10 +11565,11 @@ void glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint* param
 
 void glShaderBinary(GLsizei count, const GLuint* shaders, GLenum binaryformat, const void* binary, GLsizei length)
 {
-    pb_push(SGL_CMD_SHADERBINARY);
-    pb_push(count);
-    pb_push(binaryformat);
-    pb_push(length);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SHADERBINARY;
+    *cur++ = count;
+    *cur++ = binaryformat;
+    *cur++ = length;
     for (int i = 0; i < count; i++)
         pb_push(shaders[i]);
     pb_memcpy((void*)binary, length);
@@ -9087,11 +11577,12 @@ void glShaderBinary(GLsizei count, const GLuint* shaders, GLenum binaryformat, c
 
 void glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint* range, GLint* precision)
 {
-    pb_push(SGL_CMD_GETSHADERPRECISIONFORMAT);
-    pb_push(shadertype);
-    pb_push(precisiontype);
-    pb_push(range[0]);
-    pb_push(range[1]);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_GETSHADERPRECISIONFORMAT;
+    *cur++ = shadertype;
+    *cur++ = precisiontype;
+    *cur++ = range[0];
+    *cur++ = range[1];
 
     glimpl_submit();
     *precision = pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -9108,55 +11599,49 @@ void glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei* length, GLenum
 
 void glProgramBinary(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length)
 {
-    pb_push(SGL_CMD_SHADERBINARY);
-    pb_push(program);
-    pb_push(binaryFormat);
-    pb_push(length);
+    glimpl_forget_locations(program);
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_SHADERBINARY;
+    *cur++ = program;
+    *cur++ = binaryFormat;
+    *cur++ = length;
     pb_memcpy((void*)binary, length);
 }
 
 GLuint glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar* const*strings)
 {
-    pb_push(SGL_CMD_CREATESHADERPROGRAMV);
-    pb_push(type);
-    pb_push(count);
+    GLuint name = glimpl_name_alloc(&glimpl_shader_names);
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_CREATESHADERPROGRAMV;
+    *cur++ = type;
+    *cur++ = name;
+    *cur++ = count;
 
     for (int i = 0; i < count; i++)
         push_counted_string(strings[i], strlen(strings[i]));
 
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    return name;
 }
 
 
 void glDeleteProgramPipelines(GLsizei n, const GLuint* pipelines)
 {
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEPROGRAMPIPELINES);
-        // pb_push(1);
-
-        pb_push(pipelines[i]);
-    }
+    glimpl_delete_names(SGL_CMD_DELETEPROGRAMPIPELINES, n, pipelines);
 }
 
 void glGenProgramPipelines(GLsizei n, GLuint* pipelines)
 {
-    GLuint *p = pipelines;
-
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENPROGRAMPIPELINES);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
-    }
+    glimpl_gen_names(SGL_CMD_GENPROGRAMPIPELINES, n, pipelines);
 }
 
 void glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETPROGRAMPIPELINEIV);
-    pb_push(pipeline);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETPROGRAMPIPELINEIV;
+    *cur++ = pipeline;
+    *cur++ = pname;
 
     glimpl_submit();
     *params = pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -9164,44 +11649,38 @@ void glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint* params)
 
 void glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 2 * 2);
-    for (int i = 0; i < count * 2 * 2; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 2 * 2 * sizeof(*value));
 
-    pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX2FV);
-    pb_push(program);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_PROGRAMUNIFORMMATRIX2FV;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 3 * 3);
-    for (int i = 0; i < count * 3 * 3; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 3 * 3 * sizeof(*value));
 
-    pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX3FV);
-    pb_push(program);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_PROGRAMUNIFORMMATRIX3FV;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 4 * 4);
-    for (int i = 0; i < count * 4 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 4 * 4 * sizeof(*value));
 
-    pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX4FV);
-    pb_push(program);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_PROGRAMUNIFORMMATRIX4FV;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
@@ -9230,86 +11709,74 @@ void glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GL
 
 void glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 2 * 3);
-    for (int i = 0; i < count * 2 * 3; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 2 * 3 * sizeof(*value));
 
-    pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX2X3FV);
-    pb_push(program);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_PROGRAMUNIFORMMATRIX2X3FV;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 3 * 2);
-    for (int i = 0; i < count * 3 * 2; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 3 * 2 * sizeof(*value));
 
-    pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX3X2FV);
-    pb_push(program);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_PROGRAMUNIFORMMATRIX3X2FV;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 2 * 4);
-    for (int i = 0; i < count * 2 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 2 * 4 * sizeof(*value));
 
-    pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX2X4FV);
-    pb_push(program);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_PROGRAMUNIFORMMATRIX2X4FV;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 4 * 2);
-    for (int i = 0; i < count * 4 * 2; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 4 * 2 * sizeof(*value));
 
-    pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX4X2FV);
-    pb_push(program);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_PROGRAMUNIFORMMATRIX4X2FV;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 3 * 4);
-    for (int i = 0; i < count * 3 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 3 * 4 * sizeof(*value));
 
-    pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX3X4FV);
-    pb_push(program);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_PROGRAMUNIFORMMATRIX3X4FV;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 4 * 3);
-    for (int i = 0; i < count * 4 * 3; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, (size_t)count * 4 * 3 * sizeof(*value));
 
-    pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX4X3FV);
-    pb_push(program);
-    pb_push(location);
-    pb_push(count);
-    pb_push(transpose);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_PROGRAMUNIFORMMATRIX4X3FV;
+    *cur++ = program;
+    *cur++ = location;
+    *cur++ = count;
+    *cur++ = transpose;
 }
 
 void glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
@@ -9362,9 +11829,10 @@ void glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count,
 
 void glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
 {
-    pb_push(SGL_CMD_GETPROGRAMPIPELINEINFOLOG);
-    pb_push(pipeline);
-    pb_push(bufSize);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETPROGRAMPIPELINEINFOLOG;
+    *cur++ = pipeline;
+    *cur++ = bufSize;
     
     glimpl_submit();
 
@@ -9380,6 +11848,7 @@ void glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei* leng
 
 void glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer)
 {
+    int *cur;
     bool client_managed = glimpl_array_buffer_binding == 0;
 
     glimpl_vaps[index] = (struct gl_vertex_attrib_pointer){ 
@@ -9395,11 +11864,12 @@ void glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei strid
     };
 
     if (!client_managed) {
-        pb_push(SGL_CMD_VERTEXATTRIBLPOINTER);
-        pb_push(index);
-        pb_push(size);
-        pb_push(type);
-        pb_push(stride);
+        cur = glimpl_begin(5);
+        *cur++ = SGL_CMD_VERTEXATTRIBLPOINTER;
+        *cur++ = index;
+        *cur++ = size;
+        *cur++ = type;
+        *cur++ = stride;
         pb_push64((int64_t)(uintptr_t)pointer);
         pb_push(false);
     }
@@ -9413,14 +11883,14 @@ void glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble* params)
 
 void glViewportArrayv(GLuint first, GLsizei count, const GLfloat* v)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 4);
-    for (int i = 0; i < count * 4; i++)
-        pb_pushf(v[i]);
+    glimpl_shadow_invalidate(GL_VIEWPORT);
+
+    glimpl_upload_buffer(v, (size_t)count * 4 * sizeof(*v));
 
-    pb_push(SGL_CMD_VIEWPORTARRAYV);
-    pb_push(first);
-    pb_push(count);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_VIEWPORTARRAYV;
+    *cur++ = first;
+    *cur++ = count;
 }
 
 void glViewportIndexedfv(GLuint index, const GLfloat* v)
@@ -9430,44 +11900,53 @@ void glViewportIndexedfv(GLuint index, const GLfloat* v)
 
 void glScissorArrayv(GLuint first, GLsizei count, const GLint* v)
 {
+    glimpl_shadow_invalidate(GL_SCISSOR_BOX);
+
     glimpl_upload_buffer(v, (size_t)count * 4 * sizeof(*v));
 
-    pb_push(SGL_CMD_SCISSORARRAYV);
-    pb_push(first);
-    pb_push(count);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_SCISSORARRAYV;
+    *cur++ = first;
+    *cur++ = count;
 }
 
 void glScissorIndexedv(GLuint index, const GLint* v)
 {
+    glimpl_shadow_invalidate(GL_SCISSOR_BOX);
+
     glimpl_upload_buffer(v, 4 * sizeof(*v));
 
-    pb_push(SGL_CMD_SCISSORINDEXEDV);
-    pb_push(index);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_SCISSORINDEXEDV;
+    *cur++ = index;
 }
 
 void glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble* v)
 {
     glimpl_upload_buffer(v, (size_t)count * 2 * sizeof(*v));
 
-    pb_push(SGL_CMD_DEPTHRANGEARRAYV);
-    pb_push(first);
-    pb_push(count);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_DEPTHRANGEARRAYV;
+    *cur++ = first;
+    *cur++ = count;
 }
 
 void glGetFloati_v(GLenum target, GLuint index, GLfloat* data)
 {
-    pb_push(SGL_CMD_GETINTEGERI_V);
-    pb_push(target);
-    pb_push(index);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETINTEGERI_V;
+    *cur++ = target;
+    *cur++ = index;
     glimpl_submit();
     GL_GET_MEMCPY_RETVAL_EX(target, data, GLfloat);
 }
 
 void glGetDoublei_v(GLenum target, GLuint index, GLdouble* data)
 {
-    pb_push(SGL_CMD_GETDOUBLEI_V);
-    pb_push(target);
-    pb_push(index);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETDOUBLEI_V;
+    *cur++ = target;
+    *cur++ = index;
     glimpl_submit();
     GL_GET_MEMCPY_RETVAL_EX(target, data, GLfloat);
 }
@@ -9479,13 +11958,14 @@ void glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type
     bool use_upload;
     uint64_t index_pointer;
 
-    if (!glimpl_prepare_draw_elements(count, type, indices, -1, &use_upload, &index_pointer))
+    if (!glimpl_prepare_draw_elements(count, type, indices, 0, -1, 0, &use_upload, &index_pointer))
         return;
 
-    pb_push(SGL_CMD_DRAWELEMENTSINSTANCEDBASEINSTANCE);
-    pb_push(mode);
-    pb_push(count);
-    pb_push(type);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_DRAWELEMENTSINSTANCEDBASEINSTANCE;
+    *cur++ = mode;
+    *cur++ = count;
+    *cur++ = type;
     pb_push64(index_pointer);
     pb_push(use_upload);
     pb_push(instancecount);
@@ -9497,13 +11977,14 @@ void glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, G
     bool use_upload;
     uint64_t index_pointer;
 
-    if (!glimpl_prepare_draw_elements(count, type, indices, -1, &use_upload, &index_pointer))
+    if (!glimpl_prepare_draw_elements(count, type, indices, 0, -1, basevertex, &use_upload, &index_pointer))
         return;
 
-    pb_push(SGL_CMD_DRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCE);
-    pb_push(mode);
-    pb_push(count);
-    pb_push(type);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_DRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCE;
+    *cur++ = mode;
+    *cur++ = count;
+    *cur++ = type;
     pb_push64(index_pointer);
     pb_push(use_upload);
     pb_push(instancecount);
@@ -9513,11 +11994,12 @@ void glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, G
 
 void glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint* params)
 {
-    pb_push(SGL_CMD_GETINTERNALFORMATIV);
-    pb_push(target);
-    pb_push(internalformat);
-    pb_push(pname);
-    pb_push(bufSize);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_GETINTERNALFORMATIV;
+    *cur++ = target;
+    *cur++ = internalformat;
+    *cur++ = pname;
+    *cur++ = bufSize;
     
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), bufSize * sizeof(int));
@@ -9525,10 +12007,11 @@ void glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, G
 
 void glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETACTIVEATOMICCOUNTERBUFFERIV);
-    pb_push(program);
-    pb_push(bufferIndex);
-    pb_push(pname);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_GETACTIVEATOMICCOUNTERBUFFERIV;
+    *cur++ = program;
+    *cur++ = bufferIndex;
+    *cur++ = pname;
 
     glimpl_submit();
     switch (pname) {
@@ -9564,11 +12047,12 @@ void glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint* params)
 
 void glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64* params)
 {
-    pb_push(SGL_CMD_GETINTERNALFORMATI64V);
-    pb_push(target);
-    pb_push(internalformat);
-    pb_push(pname);
-    pb_push(bufSize);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_GETINTERNALFORMATI64V;
+    *cur++ = target;
+    *cur++ = internalformat;
+    *cur++ = pname;
+    *cur++ = bufSize;
     
     glimpl_submit();
     memcpy(params, pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V), bufSize * sizeof(GLint64));
@@ -9602,10 +12086,11 @@ void glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void* indirect,
 
 void glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETPROGRAMINTERFACEIV);
-    pb_push(program);
-    pb_push(programInterface);
-    pb_push(pname);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_GETPROGRAMINTERFACEIV;
+    *cur++ = program;
+    *cur++ = programInterface;
+    *cur++ = pname;
 
     glimpl_submit();
     *params = pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -9613,9 +12098,10 @@ void glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pna
 
 GLuint glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETPROGRAMRESOURCEINDEX);
-    pb_push(program);
-    pb_push(programInterface);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETPROGRAMRESOURCEINDEX;
+    *cur++ = program;
+    *cur++ = programInterface;
     push_string(name);
 
     glimpl_submit();
@@ -9624,11 +12110,12 @@ GLuint glGetProgramResourceIndex(GLuint program, GLenum programInterface, const
 
 void glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei* length, GLchar* name)
 {
-    pb_push(SGL_CMD_GETPROGRAMRESOURCENAME);
-    pb_push(program);
-    pb_push(programInterface);
-    pb_push(index);
-    pb_push(bufSize);
+    int *cur = glimpl_begin(5);
+    *cur++ = SGL_CMD_GETPROGRAMRESOURCENAME;
+    *cur++ = program;
+    *cur++ = programInterface;
+    *cur++ = index;
+    *cur++ = bufSize;
     
     glimpl_submit();
 
@@ -9644,17 +12131,15 @@ void glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint in
 
 void glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum* props, GLsizei bufSize, GLsizei* length, GLint* params)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(propCount);
-    for (int i = 0; i < propCount; i++)
-        pb_push(props[i]);
+    glimpl_upload_buffer(props, (size_t)propCount * sizeof(*props));
 
-    pb_push(SGL_CMD_GETPROGRAMRESOURCEIV);
-    pb_push(program);
-    pb_push(programInterface);
-    pb_push(index);
-    pb_push(propCount);
-    pb_push(bufSize);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_GETPROGRAMRESOURCEIV;
+    *cur++ = program;
+    *cur++ = programInterface;
+    *cur++ = index;
+    *cur++ = propCount;
+    *cur++ = bufSize;
 
     glimpl_submit();
 
@@ -9670,9 +12155,10 @@ void glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint inde
 
 GLint glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETPROGRAMRESOURCELOCATION);
-    pb_push(program);
-    pb_push(programInterface);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETPROGRAMRESOURCELOCATION;
+    *cur++ = program;
+    *cur++ = programInterface;
     push_string(name);
 
     glimpl_submit();
@@ -9681,9 +12167,10 @@ GLint glGetProgramResourceLocation(GLuint program, GLenum programInterface, cons
 
 GLint glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETPROGRAMRESOURCELOCATIONINDEX);
-    pb_push(program);
-    pb_push(programInterface);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETPROGRAMRESOURCELOCATIONINDEX;
+    *cur++ = program;
+    *cur++ = programInterface;
     push_string(name);
 
     glimpl_submit();
@@ -9744,36 +12231,41 @@ void glBufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfiel
 
 void glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void* data)
 {
-    pb_push(SGL_CMD_CLEARTEXIMAGE);
-    pb_push(texture);
-    pb_push(level);
-    pb_push(format);
-    pb_push(type);
-    pb_push(*(unsigned int*)data);
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_CLEARTEXIMAGE;
+    *cur++ = texture;
+    *cur++ = level;
+    *cur++ = format;
+    *cur++ = type;
+    *cur++ = *(unsigned int*)data;
 }
 
 void glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* data)
 {
-    pb_push(SGL_CMD_CLEARTEXSUBIMAGE);
-    pb_push(texture);
-    pb_push(level);
-    pb_push(xoffset);
-    pb_push(yoffset);
-    pb_push(zoffset);
-    pb_push(width);
-    pb_push(height);
-    pb_push(depth);
-    pb_push(format);
-    pb_push(type);
-    pb_push(*(unsigned int*)data);
+    int *cur = glimpl_begin(12);
+    *cur++ = SGL_CMD_CLEARTEXSUBIMAGE;
+    *cur++ = texture;
+    *cur++ = level;
+    *cur++ = xoffset;
+    *cur++ = yoffset;
+    *cur++ = zoffset;
+    *cur++ = width;
+    *cur++ = height;
+    *cur++ = depth;
+    *cur++ = format;
+    *cur++ = type;
+    *cur++ = *(unsigned int*)data;
 }
 
 void glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizeiptr* sizes)
 {
-    pb_push(SGL_CMD_BINDBUFFERSRANGE);
-    pb_push(target);
-    pb_push(first);
-    pb_push(count);
+    glimpl_shadow_invalidate(glimpl_buffer_binding_pname(target));
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_BINDBUFFERSRANGE;
+    *cur++ = target;
+    *cur++ = first;
+    *cur++ = count;
     for (int i = 0; i < count; i++) {
         pb_push(buffers[i]);
         pb_push(offsets[i]);
@@ -9783,51 +12275,48 @@ void glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint
 
 void glBindTextures(GLuint first, GLsizei count, const GLuint* textures)
 {
+    glimpl_shadow_invalidate_list(glimpl_texture_binding_pnames, GLIMPL_ARRAY_COUNT(glimpl_texture_binding_pnames));
+
     // to-do: have compatability option?
     // for (GLuint i = 0; i < count; i++) {
     //     glActiveTexture(GL_TEXTURE0 + first + i);
     //     glBindTexture(GL_TEXTURE_2D, textures[i]);
     // }
 
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count);
-    for (int i = 0; i < count; i++)
-        pb_push(textures[i]);
+    glimpl_upload_buffer(textures, (size_t)count * sizeof(*textures));
 
-    pb_push(SGL_CMD_BINDTEXTURES);
-    pb_push(first);
-    pb_push(count);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDTEXTURES;
+    *cur++ = first;
+    *cur++ = count;
 }
 
 void glBindSamplers(GLuint first, GLsizei count, const GLuint* samplers)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count);
-    for (int i = 0; i < count; i++)
-        pb_push(samplers[i]);
+    glimpl_upload_buffer(samplers, (size_t)count * sizeof(*samplers));
 
-    pb_push(SGL_CMD_BINDSAMPLERS);
-    pb_push(first);
-    pb_push(count);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDSAMPLERS;
+    *cur++ = first;
+    *cur++ = count;
 }
 
 void glBindImageTextures(GLuint first, GLsizei count, const GLuint* textures)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count);
-    for (int i = 0; i < count; i++)
-        pb_push(textures[i]);
+    glimpl_upload_buffer(textures, (size_t)count * sizeof(*textures));
 
-    pb_push(SGL_CMD_BINDIMAGETEXTURES);
-    pb_push(first);
-    pb_push(count);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDIMAGETEXTURES;
+    *cur++ = first;
+    *cur++ = count;
 }
 
 void glBindVertexBuffers(GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides)
 {
-    pb_push(SGL_CMD_BINDVERTEXBUFFERS);
-    pb_push(first);
-    pb_push(count);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDVERTEXBUFFERS;
+    *cur++ = first;
+    *cur++ = count;
     for (int i = 0; i < count; i++) {
         pb_push(buffers[i]);
         pb_push64(offsets[i]);
@@ -9842,7 +12331,7 @@ void glCreateTransformFeedbacks(GLsizei n, GLuint* ids)
     GLuint *p = ids;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATETRANSFORMFEEDBACKS);
+        glimpl_push_command(SGL_CMD_CREATETRANSFORMFEEDBACKS);
         // pb_push(1);
 
         glimpl_submit();
@@ -9852,9 +12341,10 @@ void glCreateTransformFeedbacks(GLsizei n, GLuint* ids)
 
 void glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint* param)
 {
-    pb_push(SGL_CMD_GETTRANSFORMFEEDBACKIV);
-    pb_push(xfb);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETTRANSFORMFEEDBACKIV;
+    *cur++ = xfb;
+    *cur++ = pname;
     
     glimpl_submit();
     *param = pb_read(SGL_OFFSET_REGISTER_RETVAL_V);
@@ -9862,10 +12352,11 @@ void glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint* param)
 
 void glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint* param)
 {
-    pb_push(SGL_CMD_GETTRANSFORMFEEDBACKI_V);
-    pb_push(xfb);
-    pb_push(pname);
-    pb_push(index);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_GETTRANSFORMFEEDBACKI_V;
+    *cur++ = xfb;
+    *cur++ = pname;
+    *cur++ = index;
     
     glimpl_submit();
     *param = pb_read(SGL_OFFSET_REGISTER_RETVAL_V);
@@ -9873,10 +12364,11 @@ void glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint* pa
 
 void glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64* param)
 {
-    pb_push(SGL_CMD_GETTRANSFORMFEEDBACKI64_V);
-    pb_push(xfb);
-    pb_push(pname);
-    pb_push(index);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_GETTRANSFORMFEEDBACKI64_V;
+    *cur++ = xfb;
+    *cur++ = pname;
+    *cur++ = index;
     
     glimpl_submit();
     *param = pb_read64(SGL_OFFSET_REGISTER_RETVAL_V);
@@ -9884,14 +12376,13 @@ void glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64
 
 void glCreateBuffers(GLsizei n, GLuint* buffers)
 {
-    GLuint *p = buffers;
+    int *cur;
+    glimpl_alloc_names(&glimpl_buffer_names, n, buffers);
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATEBUFFERS);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        cur = glimpl_begin(2);
+        *cur++ = SGL_CMD_CREATEBUFFERS;
+        *cur++ = buffers[i];
     }
 }
 
@@ -9951,11 +12442,16 @@ void glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void* *params)
 
 void glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void* data)
 {
-    /*
-     * stub, refer to glGetBufferSubData
-     */
-    STUB();
-    return;
+    if (size <= 0)
+        return;
+
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_GETNAMEDBUFFERSUBDATA;
+    *cur++ = buffer;
+    *cur++ = offset;
+    *cur++ = size;
+
+    glimpl_download_buffer(data, size);
 }
 
 void glCreateFramebuffers(GLsizei n, GLuint* framebuffers)
@@ -9963,7 +12459,7 @@ void glCreateFramebuffers(GLsizei n, GLuint* framebuffers)
     GLuint *p = framebuffers;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATEFRAMEBUFFERS);
+        glimpl_push_command(SGL_CMD_CREATEFRAMEBUFFERS);
         // pb_push(1);
 
         glimpl_submit();
@@ -9973,9 +12469,10 @@ void glCreateFramebuffers(GLsizei n, GLuint* framebuffers)
 
 void glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum* bufs)
 {
-    pb_push(SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFERS);
-    pb_push(framebuffer);
-    pb_push(n);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFERS;
+    *cur++ = framebuffer;
+    *cur++ = n;
     for (int i = 0; i < n; i++)
         pb_push(bufs[i]);
 }
@@ -10022,7 +12519,7 @@ void glCreateRenderbuffers(GLsizei n, GLuint* renderbuffers)
     GLuint *p = renderbuffers;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATERENDERBUFFERS);
+        glimpl_push_command(SGL_CMD_CREATERENDERBUFFERS);
         // pb_push(1);
 
         glimpl_submit();
@@ -10037,15 +12534,14 @@ void glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint*
 
 void glCreateTextures(GLenum target, GLsizei n, GLuint* textures)
 {
-    GLuint *p = textures;
+    int *cur;
+    glimpl_alloc_names(&glimpl_texture_names, n, textures);
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATETEXTURES);
-        pb_push(target);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        cur = glimpl_begin(3);
+        *cur++ = SGL_CMD_CREATETEXTURES;
+        *cur++ = target;
+        *cur++ = textures[i];
     }
 }
 
@@ -10156,7 +12652,7 @@ void glCreateVertexArrays(GLsizei n, GLuint* arrays)
     GLuint *p = arrays;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATEVERTEXARRAYS);
+        glimpl_push_command(SGL_CMD_CREATEVERTEXARRAYS);
         // pb_push(1);
 
         glimpl_submit();
@@ -10166,10 +12662,11 @@ void glCreateVertexArrays(GLsizei n, GLuint* arrays)
 
 void glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides)
 {
-    pb_push(SGL_CMD_VERTEXARRAYVERTEXBUFFERS);
-    pb_push(vaobj);
-    pb_push(first);
-    pb_push(count);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_VERTEXARRAYVERTEXBUFFERS;
+    *cur++ = vaobj;
+    *cur++ = first;
+    *cur++ = count;
     for (int i = 0; i < count; i++) {
         pb_push(buffers[i]);
         pb_push64(offsets[i]);
@@ -10179,9 +12676,10 @@ void glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const
 
 void glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint* param)
 {
-    pb_push(SGL_CMD_GETVERTEXARRAYIV);
-    pb_push(vaobj);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETVERTEXARRAYIV;
+    *cur++ = vaobj;
+    *cur++ = pname;
     
     glimpl_submit();
     *param = pb_read(SGL_OFFSET_REGISTER_RETVAL_V);
@@ -10189,10 +12687,11 @@ void glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint* param)
 
 void glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint* param)
 {
-    pb_push(SGL_CMD_GETVERTEXARRAYINDEXEDIV);
-    pb_push(vaobj);
-    pb_push(index);
-    pb_push(pname);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_GETVERTEXARRAYINDEXEDIV;
+    *cur++ = vaobj;
+    *cur++ = index;
+    *cur++ = pname;
     
     glimpl_submit();
     *param = pb_read(SGL_OFFSET_REGISTER_RETVAL_V);
@@ -10200,10 +12699,11 @@ void glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint*
 
 void glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64* param)
 {
-    pb_push(SGL_CMD_GETVERTEXARRAYINDEXED64IV);
-    pb_push(vaobj);
-    pb_push(index);
-    pb_push(pname);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_GETVERTEXARRAYINDEXED64IV;
+    *cur++ = vaobj;
+    *cur++ = index;
+    *cur++ = pname;
     
     glimpl_submit();
     *param = pb_read64(SGL_OFFSET_REGISTER_RETVAL_V);
@@ -10214,7 +12714,7 @@ void glCreateSamplers(GLsizei n, GLuint* samplers)
     GLuint *p = samplers;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATESAMPLERS);
+        glimpl_push_command(SGL_CMD_CREATESAMPLERS);
         // pb_push(1);
 
         glimpl_submit();
@@ -10227,7 +12727,7 @@ void glCreateProgramPipelines(GLsizei n, GLuint* pipelines)
     GLuint *p = pipelines;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATEPROGRAMPIPELINES);
+        glimpl_push_command(SGL_CMD_CREATEPROGRAMPIPELINES);
         // pb_push(1);
 
         glimpl_submit();
@@ -10237,11 +12737,13 @@ void glCreateProgramPipelines(GLsizei n, GLuint* pipelines)
 
 void glCreateQueries(GLenum target, GLsizei n, GLuint* ids)
 {
+    int *cur;
     GLuint *p = ids;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATEQUERIES);
-        pb_push(target);
+        cur = glimpl_begin(2);
+        *cur++ = SGL_CMD_CREATEQUERIES;
+        *cur++ = target;
         // pb_push(1);
 
         glimpl_submit();
@@ -10757,16 +13259,18 @@ GLIMPL_ALIAS_MULTITEXCOORD4_ARB(s, GLshort)
 
 void glAttachObjectARB(GLhandleARB containerObj, GLhandleARB obj)
 {
-    pb_push(SGL_CMD_ATTACHOBJECTARB);
-    pb_push(containerObj);
-    pb_push(obj);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_ATTACHOBJECTARB;
+    *cur++ = containerObj;
+    *cur++ = obj;
 }
 
 void glBindAttribLocationARB(GLhandleARB programObj, GLuint index, const GLcharARB* name)
 {
-    pb_push(SGL_CMD_BINDATTRIBLOCATIONARB);
-    pb_push(programObj);
-    pb_push(index);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDATTRIBLOCATIONARB;
+    *cur++ = programObj;
+    *cur++ = index;
     push_string(name);
 }
 
@@ -10777,9 +13281,10 @@ void glBindBufferARB(GLenum target, GLuint buffer)
 
 void glBindProgramARB(GLenum target, GLuint program)
 {
-    pb_push(SGL_CMD_BINDPROGRAMARB);
-    pb_push(target);
-    pb_push(program);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_BINDPROGRAMARB;
+    *cur++ = target;
+    *cur++ = program;
 }
 
 void glBindFramebufferEXT(GLenum target, GLuint framebuffer)
@@ -10894,62 +13399,69 @@ void glBufferSubDataARB(GLenum target, GLintptr offset, GLsizeiptr size, const v
 
 void glCompileShaderARB(GLhandleARB shaderObj)
 {
-    pb_push(SGL_CMD_COMPILESHADERARB);
-    pb_push(shaderObj);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_COMPILESHADERARB;
+    *cur++ = shaderObj;
 }
 
 GLhandleARB glCreateProgramObjectARB(void)
 {
-    pb_push(SGL_CMD_CREATEPROGRAMOBJECTARB);
+    GLuint name = glimpl_name_alloc(&glimpl_shader_names);
 
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_CREATEPROGRAMOBJECTARB;
+    *cur++ = name;
+    return name;
 }
 
 GLhandleARB glCreateShaderObjectARB(GLenum shaderType)
 {
-    pb_push(SGL_CMD_CREATESHADEROBJECTARB);
-    pb_push(shaderType);
+    GLuint name = glimpl_name_alloc(&glimpl_shader_names);
 
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_CREATESHADEROBJECTARB;
+    *cur++ = shaderType;
+    *cur++ = name;
+    return name;
 }
 
 void glDeleteBuffersARB(GLsizei n, const GLuint* buffers)
 {
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEBUFFERSARB);
-        pb_push(buffers[i]);
+        if (glimpl_pixel_pack_buffer_binding == buffers[i])
+            glimpl_pixel_pack_buffer_binding = 0;
+        glimpl_shadow_unbind(glimpl_buffer_binding_pnames, GLIMPL_ARRAY_COUNT(glimpl_buffer_binding_pnames), buffers[i]);
+        glimpl_name_release(&glimpl_buffer_names, buffers[i]);
     }
+
+    glimpl_delete_names(SGL_CMD_DELETEBUFFERSARB, n, buffers);
 }
 
 void glDeleteObjectARB(GLhandleARB obj)
 {
-    pb_push(SGL_CMD_DELETEOBJECTARB);
-    pb_push(obj);
+    glimpl_forget_locations(obj);
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_DELETEOBJECTARB;
+    *cur++ = obj;
 }
 
 void glDeleteProgramsARB(GLsizei n, const GLuint* programs)
 {
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEPROGRAMSARB);
-        pb_push(programs[i]);
-    }
+    glimpl_delete_names(SGL_CMD_DELETEPROGRAMSARB, n, programs);
 }
 
 void glDeleteQueriesARB(GLsizei n, const GLuint* ids)
 {
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEQUERIESARB);
-        pb_push(ids[i]);
-    }
+    glimpl_delete_names(SGL_CMD_DELETEQUERIESARB, n, ids);
 }
 
 void glDetachObjectARB(GLhandleARB containerObj, GLhandleARB attachedObj)
 {
-    pb_push(SGL_CMD_DETACHOBJECTARB);
-    pb_push(containerObj);
-    pb_push(attachedObj);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_DETACHOBJECTARB;
+    *cur++ = containerObj;
+    *cur++ = attachedObj;
 }
 
 // void glGenBuffersARB(GLsizei n, GLuint* buffers)
@@ -10959,48 +13471,25 @@ void glDetachObjectARB(GLhandleARB containerObj, GLhandleARB attachedObj)
 
 void glGenBuffersARB(GLsizei n, GLuint* buffers)
 {
-    GLuint *p = buffers;
-
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENBUFFERSARB);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
-    }
+    glimpl_alloc_names(&glimpl_buffer_names, n, buffers);
 }
 
 void glGenProgramsARB(GLsizei n, GLuint* programs)
 {
-    GLuint *p = programs;
-
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENPROGRAMSARB);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
-    }
+    glimpl_gen_names(SGL_CMD_GENPROGRAMSARB, n, programs);
 }
 
 void glGenQueriesARB(GLsizei n, GLuint* ids)
 {
-    GLuint *p = ids;
-
-    for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENQUERIESARB);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
-    }
+    glimpl_gen_names(SGL_CMD_GENQUERIESARB, n, ids);
 }
 
 void glGetInfoLogARB(GLhandleARB obj, GLsizei maxLength, GLsizei* length, GLcharARB* infoLog)
 {
-    pb_push(SGL_CMD_GETINFOLOGARB);
-    pb_push(obj);
-    pb_push(maxLength);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETINFOLOGARB;
+    *cur++ = obj;
+    *cur++ = maxLength;
     
     glimpl_submit();
 
@@ -11016,9 +13505,10 @@ void glGetInfoLogARB(GLhandleARB obj, GLsizei maxLength, GLsizei* length, GLchar
 
 void glGetProgramivARB(GLenum target, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETPROGRAMIVARB);
-    pb_push(target);
-    pb_push(pname);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETPROGRAMIVARB;
+    *cur++ = target;
+    *cur++ = pname;
 
     glimpl_submit();
     *params = pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -11026,18 +13516,16 @@ void glGetProgramivARB(GLenum target, GLenum pname, GLint* params)
 
 GLint glGetUniformLocationARB(GLhandleARB programObj, const GLcharARB* name)
 {
-    pb_push(SGL_CMD_GETUNIFORMLOCATIONARB);
-    pb_push(programObj);
-    push_string(name);
-
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    return glimpl_get_location(SGL_CMD_GETUNIFORMLOCATIONARB, programObj, name);
 }
 
 void glLinkProgramARB(GLhandleARB programObj)
 {
-    pb_push(SGL_CMD_LINKPROGRAMARB);
-    pb_push(programObj);
+    glimpl_forget_locations(programObj);
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_LINKPROGRAMARB;
+    *cur++ = programObj;
 }
 
 void* glMapBufferARB(GLenum target, GLenum access)
@@ -11047,18 +13535,19 @@ void* glMapBufferARB(GLenum target, GLenum access)
 
 void glProgramStringARB(GLenum target, GLenum format, GLsizei len, const void* string) 
 {
-    pb_push(SGL_CMD_PROGRAMSTRINGARB);
-    pb_push(target);
-    pb_push(format);
-    pb_push(len);
-    push_string(string);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_PROGRAMSTRINGARB;
+    *cur++ = target;
+    *cur++ = format;
+    push_counted_string(string, len);
 }
 
 void glShaderSourceARB(GLhandleARB shaderObj, GLsizei count, const GLcharARB* *string, const GLint* length)
 {
-    pb_push(SGL_CMD_SHADERSOURCEARB);
-    pb_push(shaderObj);
-    pb_push(count);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_SHADERSOURCEARB;
+    *cur++ = shaderObj;
+    *cur++ = count;
 
     for (int i = 0; i < count; i++) {
         int len = length && length[i] >= 0 ? length[i] : strlen(string[i]);
@@ -11070,49 +13559,61 @@ void glShaderSourceARB(GLhandleARB shaderObj, GLsizei count, const GLcharARB* *s
 
 void glUniform1iARB(GLint location, GLint v0)
 {
-    pb_push(SGL_CMD_UNIFORM1IARB);
-    pb_push(location);
-    pb_push(v0);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_UNIFORM1IARB;
+    *cur++ = location;
+    *cur++ = v0;
 }
 
 void glProgramEnvParameters4fvEXT(GLenum target, GLuint index, GLsizei count, const GLfloat* params)
 {
-    pb_push(SGL_CMD_PROGRAMENVPARAMETERS4FVEXT);
-    pb_push(target);
-    pb_push(index);
-    pb_push(count);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_PROGRAMENVPARAMETERS4FVEXT;
+    *cur++ = target;
+    *cur++ = index;
+    *cur++ = count;
     pb_memcpy(params, count * 4 * sizeof(float));
 }
 
 void glColorMaskIndexedEXT(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
 {
-    pb_push(SGL_CMD_COLORMASKINDEXEDEXT);
-    pb_push(index);
-    pb_push(r);
-    pb_push(g);
-    pb_push(b);
-    pb_push(a);
+    glimpl_shadow_invalidate(GL_COLOR_WRITEMASK);
+
+    int *cur = glimpl_begin(6);
+    *cur++ = SGL_CMD_COLORMASKINDEXEDEXT;
+    *cur++ = index;
+    *cur++ = r;
+    *cur++ = g;
+    *cur++ = b;
+    *cur++ = a;
 }
 
 void glEnableIndexedEXT(GLenum target, GLuint index)
 {
-    pb_push(SGL_CMD_ENABLEINDEXEDEXT);
-    pb_push(target);
-    pb_push(index);
+    glimpl_shadow_invalidate(target);
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_ENABLEINDEXEDEXT;
+    *cur++ = target;
+    *cur++ = index;
 }
 
 void glDisableIndexedEXT(GLenum target, GLuint index)
 {
-    pb_push(SGL_CMD_DISABLEINDEXEDEXT);
-    pb_push(target);
-    pb_push(index);
+    glimpl_shadow_invalidate(target);
+
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_DISABLEINDEXEDEXT;
+    *cur++ = target;
+    *cur++ = index;
 }
 
 void glGetBooleanIndexedvEXT(GLenum target, GLuint index, GLboolean* data)
 {
-    pb_push(SGL_CMD_GETBOOLEANINDEXEDVEXT);
-    pb_push(target);
-    pb_push(index);
+    int *cur = glimpl_begin(3);
+    *cur++ = SGL_CMD_GETBOOLEANINDEXEDVEXT;
+    *cur++ = target;
+    *cur++ = index;
 
     glimpl_submit();
     *data = *(GLboolean*)pb_ptr(SGL_OFFSET_REGISTER_RETVAL);
@@ -11130,16 +13631,21 @@ GLboolean glIsEnabledIndexedEXT(GLenum target, GLuint index)
 
 void glActiveTextureARB(GLenum texture)
 {
-    pb_push(SGL_CMD_ACTIVETEXTUREARB);
-    pb_push(texture);
+    glimpl_shadow_set1(GL_ACTIVE_TEXTURE, texture);
+    glimpl_shadow_invalidate_list(glimpl_texture_binding_pnames, GLIMPL_ARRAY_COUNT(glimpl_texture_binding_pnames));
+
+    int *cur = glimpl_begin(2);
+    *cur++ = SGL_CMD_ACTIVETEXTUREARB;
+    *cur++ = texture;
 }
 
 void glMultiTexCoord2fARB(GLenum target, GLfloat s, GLfloat t)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD2FARB);
-    pb_push(target);
-    pb_pushf(s);
-    pb_pushf(t);
+    int *cur = glimpl_begin(4);
+    *cur++ = SGL_CMD_MULTITEXCOORD2FARB;
+    *cur++ = target;
+    *(float*)cur++ = s;
+    *(float*)cur++ = t;
 }
 
 #ifdef _WIN32
@@ -2,6 +2,7 @@
 #include <client/pb.h>
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #ifndef _WIN32
@@ -55,7 +56,14 @@ static size_t client_slot_offset;
 static bool has_client_slot = false;
 static bool write_overflowed = false;
 
+/*
+ * header of the command being recorded, NULL between commands
+ */
+static int *command;
+
 static bool using_direct_access = false;
+static int direct_half = 0;
+static int submit_seq = 0;
 
 static struct pb_net_hooks net_hooks = { NULL };
 
@@ -71,10 +79,13 @@ static inline bool pb_is_global_offset(size_t offs)
     case SGL_OFFSET_REGISTER_SWAP_BUFFERS_SYNC:
     case SGL_OFFSET_REGISTER_GLMAJ:
     case SGL_OFFSET_REGISTER_GLMIN:
-    case SGL_OFFSET_REGISTER_STAGE_CLIENT_ID:
-    case SGL_OFFSET_REGISTER_STAGE_SIZE:
+    case SGL_OFFSET_REGISTER_READY_MASK:
+    case SGL_OFFSET_REGISTER_SERVER_WAITING:
     case SGL_OFFSET_REGISTER_FIFO_SIZE:
     case SGL_OFFSET_REGISTER_MAX_CLIENTS:
+    case SGL_OFFSET_REGISTER_PROTOCOL:
+    case SGL_OFFSET_REGISTER_UPLOAD_CACHE:
+    case SGL_OFFSET_REGISTER_BLOB_STORE:
         return true;
     default:
         return false;
@@ -88,6 +99,11 @@ static inline size_t pb_resolve_offset(size_t offs)
     return offs;
 }
 
+static inline bool pb_is_retval_offset(size_t offs)
+{
+    return has_client_slot && offs >= SGL_OFFSET_REGISTER_RETVAL && offs < SGL_OFFSET_SLOT_CONTROL && !pb_is_global_offset(offs);
+}
+
 static inline bool pb_can_write(size_t length)
 {
     size_t used = (size_t)((char*)in_cur - (char*)in_base);
@@ -102,6 +118,27 @@ static void pb_note_overflow(size_t length)
     write_overflowed = true;
 }
 
+/*
+ * with direct access, the ring is split in two halves: one is being
+ * recorded into while the server decodes the other one in place
+ */
+static inline size_t pb_ring_capacity(size_t fifo_size, bool direct_access)
+{
+    if (!direct_access)
+        return fifo_size;
+    return (fifo_size / 2) & ~(size_t)(sizeof(int) - 1);
+}
+
+static inline bool pb_seq_reached(int done, int target)
+{
+    return (int)((unsigned int)done - (unsigned int)target) >= 0;
+}
+
+static inline int pb_done_seq()
+{
+    return *(volatile int*)((char*)ptr + client_slot_offset + SGL_OFFSET_REGISTER_RING_DONE_SEQ);
+}
+
 #ifndef _WIN32
 void pb_set(int fd, bool direct_access)
 {
@@ -116,8 +153,9 @@ void pb_set(int fd, bool direct_access)
     ptr = mmap(NULL, alloc_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
 
     base = (char*)ptr + SGL_STAGE_OFFSET;
-    in_capacity = (size_t)fifo_size;
+    in_capacity = pb_ring_capacity((size_t)fifo_size, direct_access);
     using_direct_access = direct_access;
+    direct_half = 0;
     has_client_slot = false;
     write_overflowed = false;
 
@@ -178,8 +216,9 @@ void pb_set(bool direct_access)
     ptr = map.pointer;
     base = (PVOID)((DWORD64)map.pointer + (DWORD64)SGL_STAGE_OFFSET);
     fifo_size = *(int*)((char*)ptr + SGL_OFFSET_REGISTER_FIFO_SIZE);
-    in_capacity = (size_t)fifo_size;
+    in_capacity = pb_ring_capacity((size_t)fifo_size, direct_access);
     using_direct_access = direct_access;
+    direct_half = 0;
     has_client_slot = false;
     write_overflowed = false;
 
@@ -222,6 +261,83 @@ void pb_reset()
     cur = base;
     in_cur = in_base;
     write_overflowed = false;
+    command = NULL;
+}
+
+/*
+ * where the words of a command too large for the buffer are written,
+ * so they never land past its end
+ */
+static int *overflow_sink;
+static size_t overflow_sink_count;
+
+int *pb_reserve(size_t count)
+{
+    size_t length = (count + 1) * sizeof(*in_cur);
+    int *cursor = in_cur;
+
+    if (!pb_can_write(length)) {
+        if (in_cur != in_base)
+            return NULL;
+
+        /*
+         * won't fit even in an empty buffer; the buffer is dropped on
+         * the next submit, so the words only need somewhere to go
+         */
+        pb_note_overflow(length);
+        if (count > overflow_sink_count) {
+            int *grown = realloc(overflow_sink, count * sizeof(*overflow_sink));
+            if (grown == NULL)
+                return NULL;
+            overflow_sink = grown;
+            overflow_sink_count = count;
+        }
+        return overflow_sink;
+    }
+
+    in_cur += count;
+    return cursor;
+}
+
+int *pb_begin_command(size_t count)
+{
+    pb_end_command();
+
+    int *cursor = pb_reserve(count);
+    if (cursor != NULL && cursor != overflow_sink)
+        command = cursor;
+    return cursor;
+}
+
+void pb_end_command(void)
+{
+    if (command == NULL)
+        return;
+
+    size_t length = (size_t)(in_cur - command) - 1;
+    if (length < SGL_CMD_LENGTH_LONG) {
+        *command = SGL_CMD_HEADER(*command, length);
+        command = NULL;
+        return;
+    }
+
+    /*
+     * only known to be too long for the header now that it's written,
+     * so the words after the header move over for the length; uploads
+     * are streamed in parts that fit, this is for the odd huge string
+     * or multi-draw
+     */
+    if (!pb_can_write(sizeof(*in_cur))) {
+        pb_note_overflow(sizeof(*in_cur));
+    }
+    else {
+        memmove(command + 2, command + 1, length * sizeof(*in_cur));
+        command[1] = (int)length;
+        in_cur++;
+    }
+
+    *command = SGL_CMD_HEADER(*command, SGL_CMD_LENGTH_LONG);
+    command = NULL;
 }
 
 void pb_push(int c)
@@ -257,6 +373,8 @@ int pb_read(int s)
 {
     if (net_hooks._pb_read)
         return net_hooks._pb_read(s);
+    if (pb_is_retval_offset((size_t)s))
+        pb_sync();
     return *(int*)((char*)ptr + pb_resolve_offset((size_t)s));
 }
 
@@ -264,6 +382,8 @@ int64_t pb_read64(int s)
 {
     if (net_hooks._pb_read64)
         return net_hooks._pb_read64(s);
+    if (pb_is_retval_offset((size_t)s))
+        pb_sync();
     return *(int64_t*)((char*)ptr + pb_resolve_offset((size_t)s));
 }
 
@@ -273,6 +393,8 @@ void pb_write(int s, int c)
         net_hooks._pb_write(s, c);
         return;
     }
+    if (pb_is_retval_offset((size_t)s))
+        pb_sync();
     *(int*)((char*)ptr + pb_resolve_offset((size_t)s)) = c;
 }
 
@@ -338,6 +460,8 @@ void *pb_ptr(size_t offs)
 {
     if (net_hooks._pb_ptr)
         return net_hooks._pb_ptr(offs);
+    if (pb_is_retval_offset(offs))
+        pb_sync();
     return (void*)((char*)ptr + pb_resolve_offset(offs));
 }
 
@@ -356,6 +480,18 @@ void pb_set_client(int client_id)
 
     client_slot_offset = SGL_CLIENT_SLOT_OFFSET(client_id);
     has_client_slot = true;
+
+    /*
+     * each slot stages its commands in its own ring, so
+     * the ring follows the slot
+     */
+    base = (char*)ptr + SGL_CLIENT_RING_OFFSET(client_id, pb_global_read(SGL_OFFSET_REGISTER_FIFO_SIZE));
+    if (using_direct_access) {
+        direct_half = 0;
+        in_base = base;
+        in_cur = base;
+        command = NULL;
+    }
 }
 
 void *pb_iptr(size_t offs)
@@ -380,6 +516,56 @@ bool pb_overflowed()
 
 void pb_copy_to_shared()
 {
-    if (!using_direct_access && !write_overflowed)
-        memcpy(base, in_base, (size_t)in_cur - (size_t)in_base);
+    if (using_direct_access || write_overflowed)
+        return;
+
+    /*
+     * the server decodes straight out of the ring, so it has
+     * to be done with the previous submit before we overwrite it
+     */
+    pb_sync();
+    memcpy(base, in_base, (size_t)in_cur - (size_t)in_base);
+}
+
+size_t pb_ring_offset()
+{
+    if (!using_direct_access)
+        return 0;
+    return (size_t)in_base - (size_t)base;
+}
+
+void *pb_ring_ptr(size_t offs)
+{
+    pb_sync();
+    return (void*)((char*)base + offs);
+}
+
+void pb_flip()
+{
+    if (!using_direct_access || !has_client_slot)
+        return;
+
+    /*
+     * switch to the other half, which is free once the submit
+     * before the one just made has finished
+     */
+    direct_half ^= 1;
+    in_base = (char*)base + direct_half * in_capacity;
+    in_cur = in_base;
+    command = NULL;
+    while (!pb_seq_reached(pb_done_seq(), submit_seq - 1));
+}
+
+
+int pb_next_submit_seq()
+{
+    return ++submit_seq;
 }
+
+void pb_sync()
+{
+    if (!has_client_slot)
+        return;
+
+    while (pb_done_seq() != submit_seq);
+}
\ No newline at end of file
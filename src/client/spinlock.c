@@ -8,6 +8,10 @@
 
 #ifdef _WIN32
 #include <windows.h>
+#else
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
 #endif
 
 void spin_lock(int *lock)
@@ -27,4 +31,27 @@ void spin_unlock(int volatile *lock)
     asm volatile ("":::"memory");
 #endif
     *lock = 0;
+}
+
+void spin_atomic_or(int *word, int bits)
+{
+#ifndef _WIN32
+    __sync_fetch_and_or(word, bits);
+#else
+    InterlockedOr((volatile LONG*)word, bits);
+#endif
+}
+
+/*
+ * wakes a server sleeping on `word`; only meaningful when the
+ * shared memory is a host mapping, guests have no way to reach
+ * the host's futex so the server falls back to a timed sleep
+ */
+void spin_wake(int *word)
+{
+#ifndef _WIN32
+    syscall(SYS_futex, word, FUTEX_WAKE, 1, NULL, NULL, 0);
+#else
+    (void)word;
+#endif
 }
\ No newline at end of file
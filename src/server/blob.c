@@ -0,0 +1,221 @@
+#include <sharedgl.h>
+#include <server/blob.h>
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <inttypes.h>
+
+#define SGL_BLOB_BUCKETS 4096
+
+struct sgl_blob {
+    struct sgl_blob_key key;
+    void *data;
+    struct sgl_blob *prev, *next;   /* lru order, most recently used first */
+    struct sgl_blob *chain;         /* next blob in the same bucket */
+};
+
+static struct {
+    struct sgl_blob *buckets[SGL_BLOB_BUCKETS];
+    struct sgl_blob *head, *tail;
+    size_t used, budget;
+    const char *directory;
+} store;
+
+void sgl_blob_store_init(size_t budget, const char *directory)
+{
+    store.budget = budget;
+    store.directory = NULL;
+
+    if (budget == 0 || directory == NULL)
+        return;
+
+    if (mkdir(directory, 0755) != 0 && errno != EEXIST) {
+        PRINT_LOG("failed to create blob directory '%s', blobs are kept in memory only\n", directory);
+        return;
+    }
+
+    store.directory = directory;
+    PRINT_LOG("keeping blobs in '%s'\n", directory);
+}
+
+bool sgl_blob_store_enabled(void)
+{
+    return store.budget != 0;
+}
+
+static inline bool sgl_blob_key_equal(const struct sgl_blob_key *a, const struct sgl_blob_key *b)
+{
+    return memcmp(a->hash, b->hash, sizeof(a->hash)) == 0 && a->size == b->size;
+}
+
+static inline struct sgl_blob **sgl_blob_bucket(const struct sgl_blob_key *key)
+{
+    return &store.buckets[key->hash[0] % SGL_BLOB_BUCKETS];
+}
+
+static void sgl_blob_unlink(struct sgl_blob *blob)
+{
+    if (blob->prev)
+        blob->prev->next = blob->next;
+    else
+        store.head = blob->next;
+
+    if (blob->next)
+        blob->next->prev = blob->prev;
+    else
+        store.tail = blob->prev;
+}
+
+static void sgl_blob_push_front(struct sgl_blob *blob)
+{
+    blob->prev = NULL;
+    blob->next = store.head;
+    if (store.head)
+        store.head->prev = blob;
+    else
+        store.tail = blob;
+    store.head = blob;
+}
+
+static void sgl_blob_evict(struct sgl_blob *blob)
+{
+    struct sgl_blob **link = sgl_blob_bucket(&blob->key);
+
+    while (*link != blob)
+        link = &(*link)->chain;
+    *link = blob->chain;
+
+    sgl_blob_unlink(blob);
+    store.used -= blob->key.size;
+    free(blob->data);
+    free(blob);
+}
+
+static bool sgl_blob_verify(const struct sgl_blob_key *key, const void *data)
+{
+    struct sgl_blob_key actual = sgl_blob_key_of(data, key->size);
+    return sgl_blob_key_equal(key, &actual);
+}
+
+/*
+ * takes ownership of data
+ */
+static struct sgl_blob *sgl_blob_add(const struct sgl_blob_key *key, void *data)
+{
+    struct sgl_blob *blob = malloc(sizeof(*blob));
+    if (blob == NULL) {
+        free(data);
+        return NULL;
+    }
+
+    while (store.tail && store.used + key->size > store.budget)
+        sgl_blob_evict(store.tail);
+
+    struct sgl_blob **bucket = sgl_blob_bucket(key);
+    blob->key = *key;
+    blob->data = data;
+    blob->chain = *bucket;
+    *bucket = blob;
+
+    sgl_blob_push_front(blob);
+    store.used += key->size;
+    return blob;
+}
+
+static void sgl_blob_path(char *path, size_t length, const struct sgl_blob_key *key)
+{
+    char digest[2 * SGL_SHA256_SIZE + 1];
+    sgl_digest_string(digest, key->hash);
+    snprintf(path, length, "%s/%s-%" PRIu64, store.directory, digest, key->size);
+}
+
+static void *sgl_blob_read_file(const struct sgl_blob_key *key)
+{
+    char path[4096];
+    sgl_blob_path(path, sizeof(path), key);
+
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+        return NULL;
+
+    void *data = malloc(key->size);
+    if (data != NULL && (fread(data, 1, key->size, file) != key->size || fgetc(file) != EOF || !sgl_blob_verify(key, data))) {
+        PRINT_LOG("ignoring damaged blob '%s'\n", path);
+        free(data);
+        data = NULL;
+    }
+
+    fclose(file);
+    return data;
+}
+
+/*
+ * written under a temporary name and renamed into place, so other
+ * servers sharing the directory never see half a blob
+ */
+static void sgl_blob_write_file(const struct sgl_blob_key *key, const void *data)
+{
+    char path[4096], temp[4096 + 32];
+    sgl_blob_path(path, sizeof(path), key);
+    snprintf(temp, sizeof(temp), "%s.%d", path, (int)getpid());
+
+    FILE *file = fopen(temp, "wb");
+    if (file == NULL)
+        return;
+
+    bool written = fwrite(data, 1, key->size, file) == key->size;
+    if (fclose(file) != 0 || !written || rename(temp, path) != 0) {
+        PRINT_LOG("failed to write blob '%s'\n", path);
+        remove(temp);
+    }
+}
+
+const void *sgl_blob_find(const struct sgl_blob_key *key)
+{
+    if (!sgl_blob_store_enabled() || key->size > store.budget)
+        return NULL;
+
+    for (struct sgl_blob *blob = *sgl_blob_bucket(key); blob; blob = blob->chain) {
+        if (sgl_blob_key_equal(&blob->key, key)) {
+            sgl_blob_unlink(blob);
+            sgl_blob_push_front(blob);
+            return blob->data;
+        }
+    }
+
+    if (store.directory == NULL)
+        return NULL;
+
+    void *data = sgl_blob_read_file(key);
+    if (data == NULL)
+        return NULL;
+
+    struct sgl_blob *blob = sgl_blob_add(key, data);
+    return blob ? blob->data : NULL;
+}
+
+void sgl_blob_insert(const struct sgl_blob_key *key, const void *data)
+{
+    if (!sgl_blob_store_enabled() || key->size == 0 || key->size > store.budget)
+        return;
+
+    if (sgl_blob_find(key) != NULL)
+        return;
+
+    if (!sgl_blob_verify(key, data)) {
+        PRINT_LOG("refusing blob whose contents don't match its hash\n");
+        return;
+    }
+
+    void *copy = malloc(key->size);
+    if (copy == NULL)
+        return;
+    memcpy(copy, data, key->size);
+
+    if (store.directory != NULL)
+        sgl_blob_write_file(key, copy);
+
+    sgl_blob_add(key, copy);
+}
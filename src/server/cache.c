@@ -0,0 +1,123 @@
+#include <sharedgl.h>
+#include <server/cache.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+static size_t budget;
+
+static inline bool sgl_upload_cache_valid_slot(int slot)
+{
+    return slot >= 0 && slot < SGL_UPLOAD_CACHE_SLOTS;
+}
+
+void sgl_upload_cache_init(size_t size)
+{
+    budget = size;
+}
+
+struct sgl_upload_cache_entry *sgl_upload_cache_store(struct sgl_upload_cache *cache, int slot, const void *data, size_t size, bool keep_copy)
+{
+    GLint copy_write_buffer;
+
+    if (!sgl_upload_cache_valid_slot(slot) || data == NULL || size == 0)
+        return NULL;
+
+    if (cache->slots == NULL) {
+        cache->slots = calloc(SGL_UPLOAD_CACHE_SLOTS, sizeof(*cache->slots));
+        if (cache->slots == NULL)
+            return NULL;
+    }
+
+    /*
+     * the client keeps to the same budget, so only a misbehaving one
+     * gets here; whatever the slot held is gone either way
+     */
+    struct sgl_upload_cache_entry *entry = &cache->slots[slot];
+    if (cache->used - entry->size + size > budget) {
+        PRINT_LOG("refusing to cache %zu byte upload, %zu of %zu bytes in use\n", size, cache->used, budget);
+        sgl_upload_cache_drop(cache, slot);
+        return NULL;
+    }
+
+    if (keep_copy) {
+        void *copy = entry->data != NULL && entry->size == size ? entry->data : realloc(entry->data, size);
+        if (copy == NULL) {
+            PRINT_LOG("failed to cache %zu byte upload\n", size);
+            sgl_upload_cache_drop(cache, slot);
+            return NULL;
+        }
+        entry->data = copy;
+        memcpy(entry->data, data, size);
+    }
+    else {
+        free(entry->data);
+        entry->data = NULL;
+    }
+
+    cache->used = cache->used - entry->size + size;
+    entry->size = size;
+
+    /*
+     * same borrowed binding as the stream ring
+     */
+    glGetIntegerv(GL_COPY_WRITE_BUFFER_BINDING, &copy_write_buffer);
+
+    if (entry->buffer == 0)
+        glGenBuffers(1, &entry->buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, entry->buffer);
+    glBufferData(GL_COPY_WRITE_BUFFER, size, data, GL_STATIC_DRAW);
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, copy_write_buffer);
+    return entry;
+}
+
+struct sgl_upload_cache_entry *sgl_upload_cache_get(struct sgl_upload_cache *cache, int slot)
+{
+    if (!sgl_upload_cache_valid_slot(slot) || cache->slots == NULL || cache->slots[slot].size == 0)
+        return NULL;
+    return &cache->slots[slot];
+}
+
+void *sgl_upload_cache_data(struct sgl_upload_cache_entry *entry)
+{
+    GLint copy_read_buffer;
+
+    if (entry->data != NULL)
+        return entry->data;
+
+    entry->data = malloc(entry->size);
+    if (entry->data == NULL)
+        return NULL;
+
+    glGetIntegerv(GL_COPY_READ_BUFFER_BINDING, &copy_read_buffer);
+    glBindBuffer(GL_COPY_READ_BUFFER, entry->buffer);
+    glGetBufferSubData(GL_COPY_READ_BUFFER, 0, entry->size, entry->data);
+    glBindBuffer(GL_COPY_READ_BUFFER, copy_read_buffer);
+    return entry->data;
+}
+
+void sgl_upload_cache_drop(struct sgl_upload_cache *cache, int slot)
+{
+    if (!sgl_upload_cache_valid_slot(slot) || cache->slots == NULL)
+        return;
+
+    struct sgl_upload_cache_entry *entry = &cache->slots[slot];
+    cache->used -= entry->size;
+    free(entry->data);
+    if (entry->buffer != 0)
+        glDeleteBuffers(1, &entry->buffer);
+    *entry = (struct sgl_upload_cache_entry){ 0 };
+}
+
+void sgl_upload_cache_free(struct sgl_upload_cache *cache)
+{
+    if (cache->slots == NULL)
+        return;
+
+    for (int i = 0; i < SGL_UPLOAD_CACHE_SLOTS; i++)
+        free(cache->slots[i].data);
+    free(cache->slots);
+    cache->slots = NULL;
+    cache->used = 0;
+}
@@ -7,6 +7,7 @@ static bool is_vid_init = false;
 static int mw = 1920;
 static int mh = 1080;
 static bool is_overlay_string_init = false;
+static enum sgl_error_mode error_mode = SGL_ERROR_MODE_DEFERRED;
 
 void sgl_set_max_resolution(int width, int height)
 {
@@ -20,9 +21,24 @@ void sgl_get_max_resolution(int *width, int *height)
     *height = mh;
 }
 
+void sgl_set_error_mode(enum sgl_error_mode mode)
+{
+    error_mode = mode;
+}
+
+enum sgl_error_mode sgl_get_error_mode(void)
+{
+    return error_mode;
+}
+
+static void GLAPIENTRY sgl_debug_message(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *message, const void *user)
+{
+    PRINT_LOG("gl debug (source 0x%04x, type 0x%04x, severity 0x%04x): %s\n", source, type, severity, message);
+}
+
 struct sgl_host_context *sgl_context_create()
 {
-    struct sgl_host_context *context = (struct sgl_host_context *)malloc(sizeof(struct sgl_host_context));
+    struct sgl_host_context *context = (struct sgl_host_context *)calloc(1, sizeof(struct sgl_host_context));
 
     if (!is_vid_init) {
         SDL_Init(SDL_INIT_VIDEO);
@@ -41,6 +57,8 @@ struct sgl_host_context *sgl_context_create()
     // SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
     // SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 2);
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_COMPATIBILITY);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, error_mode == SGL_ERROR_MODE_VALIDATE ? SDL_GL_CONTEXT_DEBUG_FLAG : 0);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_NO_ERROR, error_mode == SGL_ERROR_MODE_NO_ERROR);
 
     context->window = SDL_CreateWindow(
         "SDL Offscreen Window",
@@ -64,6 +82,18 @@ struct sgl_host_context *sgl_context_create()
 
     sgl_set_current(context);
 
+    if (error_mode == SGL_ERROR_MODE_VALIDATE) {
+        if (epoxy_gl_version() >= 43 || epoxy_has_gl_extension("GL_KHR_debug")) {
+            glEnable(GL_DEBUG_OUTPUT);
+            glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+            glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, NULL, GL_FALSE);
+            glDebugMessageCallback(sgl_debug_message, NULL);
+        }
+        else {
+            PRINT_LOG("KHR_debug unavailable, validation limited to glGetError\n");
+        }
+    }
+
     if (!is_overlay_string_init) {
         overlay_set_renderer_string((char*)glGetString(GL_RENDERER));
         is_overlay_string_init = true;
@@ -77,6 +107,11 @@ void sgl_context_destroy(struct sgl_host_context *ctx)
     sgl_set_current(NULL);
     SDL_DestroyWindow(ctx->window);
     SDL_GL_DeleteContext(ctx->gl_context);
+    free(ctx->upload_parts);
+    sgl_upload_cache_free(&ctx->upload_cache);
+    sgl_shader_records_free(&ctx->shaders);
+    for (int i = 0; i < SGL_NAMESPACE_COUNT; i++)
+        sgl_name_table_free(&ctx->names[i]);
     free(ctx);
 }
 
@@ -6,6 +6,9 @@
 #include <server/processor.h>
 #include <server/overlay.h>
 #include <server/context.h>
+#include <server/blob.h>
+#include <server/program.h>
+#include <server/stats.h>
 
 #include <unistd.h>
 #include <dirent.h>
@@ -24,17 +27,27 @@ static size_t shm_size;
 static int *internal_cmd_ptr;
 
 static const char *usage =
-    "usage: sglrenderer [-h] [-v] [-o] [-n] [-x] [-g MAJOR.MINOR] [-r WIDTHxHEIGHT] [-m SIZE] [-p PORT]\n"
+    "usage: sglrenderer [-h] [-v] [-o] [-n] [-s] [-x] [-d] [-e] [-t SECONDS] [-g MAJOR.MINOR] [-r WIDTHxHEIGHT] [-m SIZE] [-C COUNT] [-c SIZE] [-b SIZE] [-B DIR] [-P DIR] [-p PORT]\n"
     "\n"
     "options:\n"
     "    -h                 display help information\n"
     "    -v                 display virtual machine arguments\n"
     "    -o                 enables fps overlay on clients\n"
     "    -n                 enable network server instead of using shared memory\n"
+    "    -s                 always spin while idle instead of sleeping (lowest latency, uses a full core);\n"
+    "                       without it, a guest's first command after idling waits up to 1 ms\n"
     "    -x                 remove shared memory file\n"
+    "    -d                 validate every command and log gl errors and KHR_debug messages (slow)\n"
+    "    -e                 create KHR_no_error contexts (invalid calls are undefined behavior)\n"
+    "    -t [SECONDS]       log server statistics every so many seconds\n"
     "    -g [MAJOR.MINOR]   report specific opengl version (default: %d.%d)\n"
     "    -r [WIDTHxHEIGHT]  set max resolution (default: 1920x1080)\n"
     "    -m [SIZE]          max amount of megabytes program may allocate (default: 32mib)\n"
+    "    -C [COUNT]         shared-memory clients at once, each gets an equal share of memory (default: %d, max: %d)\n"
+    "    -c [SIZE]          megabytes of client arrays each client may keep cached, 0 disables (default: %dmib)\n"
+    "    -b [SIZE]          megabytes of textures and buffers kept for all clients by content, 0 disables (default: %dmib)\n"
+    "    -B [DIR]           also keep them in a directory, so they outlive the server\n"
+    "    -P [DIR]           keep linked shader programs in a directory, so later runs skip compiling\n"
     "    -p [PORT]          if networking is enabled, specify which port to use (default: 3000)\n";
 
 static void generate_virtual_machine_arguments(size_t m)
@@ -86,7 +99,13 @@ int main(int argc, char **argv)
     bool print_virtual_machine_arguments = false;
 
     bool network_over_shared = false;
+    bool idle_sleep = true;
+    int max_clients = SGL_DEFAULT_CLIENTS;
     int port = 3000;
+    int upload_cache_size = SGL_DEFAULT_UPLOAD_CACHE;
+    int blob_store_size = SGL_DEFAULT_BLOB_STORE;
+    const char *blob_store_directory = NULL;
+    const char *program_cache_directory = NULL;
 
     int major = SGL_DEFAULT_MAJOR;
     int minor = SGL_DEFAULT_MINOR;
@@ -98,7 +117,7 @@ int main(int argc, char **argv)
     for (int i = 1; i < argc; i++) {
         switch (argv[i][1]) {
         case 'h':
-            fprintf(stderr, usage, SGL_DEFAULT_MAJOR, SGL_DEFAULT_MINOR);
+            fprintf(stderr, usage, SGL_DEFAULT_MAJOR, SGL_DEFAULT_MINOR, SGL_DEFAULT_CLIENTS, SGL_MAX_CLIENTS, SGL_DEFAULT_UPLOAD_CACHE, SGL_DEFAULT_BLOB_STORE);
             return 0;
         case 'v':
             print_virtual_machine_arguments = true;
@@ -106,13 +125,26 @@ int main(int argc, char **argv)
         case 'n':
             network_over_shared = true;
             break;
+        case 's':
+            idle_sleep = false;
+            break;
         case 'o':
             overlay_enable();
             break;
+        case 'd':
+            sgl_set_error_mode(SGL_ERROR_MODE_VALIDATE);
+            break;
+        case 'e':
+            sgl_set_error_mode(SGL_ERROR_MODE_NO_ERROR);
+            break;
         case 'x':
             shm_unlink(SGL_SHARED_MEMORY_NAME);
             PRINT_LOG("unlinked shared memory '%s'\n", SGL_SHARED_MEMORY_NAME);
             return 0;
+        case 't':
+            sgl_stats_set_interval(atoi(argv[i + 1]));
+            i++;
+            break;
         case 'g':
             major = argv[i + 1][0] - '0';
             minor = argv[i + 1][2] - '0';
@@ -134,6 +166,26 @@ int main(int argc, char **argv)
             shm_size = atoi(argv[i + 1]);
             i++;
             break;
+        case 'C':
+            max_clients = MIN(MAX(atoi(argv[i + 1]), 1), SGL_MAX_CLIENTS);
+            i++;
+            break;
+        case 'c':
+            upload_cache_size = MAX(atoi(argv[i + 1]), 0);
+            i++;
+            break;
+        case 'b':
+            blob_store_size = MAX(atoi(argv[i + 1]), 0);
+            i++;
+            break;
+        case 'B':
+            blob_store_directory = argv[i + 1];
+            i++;
+            break;
+        case 'P':
+            program_cache_directory = argv[i + 1];
+            i++;
+            break;
         case 'p':
             port = atoi(argv[i + 1]);
             i++;
@@ -187,6 +239,11 @@ int main(int argc, char **argv)
         .network_over_shared = network_over_shared,
         .port = port,
 
+        .idle_sleep = idle_sleep,
+        .max_clients = max_clients,
+
+        .upload_cache_size = upload_cache_size,
+
         .gl_major = major,
         .gl_minor = minor,
 
@@ -198,5 +255,9 @@ int main(int argc, char **argv)
     PRINT_LOG("maximum resolution set to %dx%d\n", mw, mh);
     PRINT_LOG("reporting gl version %d.%d\n", major, minor);
 
+    sgl_blob_store_init((size_t)blob_store_size * 1024 * 1024, blob_store_directory);
+    sgl_upload_cache_init((size_t)upload_cache_size * 1024 * 1024);
+    sgl_program_cache_init(program_cache_directory);
+
     sgl_cmd_processor_start(args);
 }
\ No newline at end of file
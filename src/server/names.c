@@ -0,0 +1,73 @@
+#include <sharedgl.h>
+#include <server/names.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+static bool sgl_name_grow(unsigned int **array, size_t *count, size_t index)
+{
+    if (index < *count)
+        return true;
+    if (index >= SGL_MAX_OBJECT_NAME)
+        return false;
+
+    size_t count_new = *count ? *count : 256;
+    while (count_new <= index)
+        count_new *= 2;
+
+    unsigned int *grown = realloc(*array, count_new * sizeof(unsigned int));
+    if (grown == NULL)
+        return false;
+
+    memset(grown + *count, 0, (count_new - *count) * sizeof(unsigned int));
+    *array = grown;
+    *count = count_new;
+    return true;
+}
+
+unsigned int sgl_name_lookup(struct sgl_name_table *table, unsigned int name)
+{
+    if (name >= table->host_count)
+        return 0;
+    return table->host[name];
+}
+
+unsigned int sgl_name_reverse(struct sgl_name_table *table, unsigned int host)
+{
+    if (host >= table->client_count)
+        return 0;
+    return table->client[host];
+}
+
+bool sgl_name_bind(struct sgl_name_table *table, unsigned int name, unsigned int host)
+{
+    if (name == 0 || host == 0)
+        return false;
+    if (!sgl_name_grow(&table->host, &table->host_count, name))
+        return false;
+    if (!sgl_name_grow(&table->client, &table->client_count, host))
+        return false;
+
+    table->host[name] = host;
+    table->client[host] = name;
+    return true;
+}
+
+unsigned int sgl_name_forget(struct sgl_name_table *table, unsigned int name)
+{
+    unsigned int host = sgl_name_lookup(table, name);
+    if (host == 0)
+        return 0;
+
+    table->host[name] = 0;
+    if (host < table->client_count)
+        table->client[host] = 0;
+    return host;
+}
+
+void sgl_name_table_free(struct sgl_name_table *table)
+{
+    free(table->host);
+    free(table->client);
+    memset(table, 0, sizeof(*table));
+}
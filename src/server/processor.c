@@ -4,6 +4,9 @@
 #include <server/context.h>
 #include <server/dynarr.h>
 #include <server/processor.h>
+#include <server/blob.h>
+#include <server/program.h>
+#include <server/stats.h>
 #include <sgldebug.h>
 
 #define ENET_IMPLEMENTATION
@@ -11,9 +14,13 @@
 #include <network/packet.h>
 
 #include <stdbool.h>
+#include <inttypes.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <time.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
 
 #include <client/scratch.h>
 
@@ -33,28 +40,63 @@ static inline void sgl_spin_unlock(int volatile *lock)
     *lock = 0;
 }
 
-#define ADVANCE_PAST_STRING() \
-    while (!(((*pb) & 0xFF) == 0 || ((*pb >> 8) & 0xFF) == 0 || ((*pb >> 16) & 0xFF) == 0 || ((*pb >> 24) & 0xFF) == 0)) \
-        pb++; \
-    if ((((*pb) & 0xFF) == 0 || ((*pb >> 8) & 0xFF) == 0 || ((*pb >> 16) & 0xFF) == 0 || ((*pb >> 24) & 0xFF) == 0)) \
-        pb++;
+/*
+ * strings are sent as their length in bytes followed by the string
+ * and its terminator, padded to a whole word; NULL if that runs past
+ * end, the end of the command
+ */
+static char *read_string(int **pb, const int *end)
+{
+    if (*pb == end)
+        return NULL;
+
+    int length = *(*pb)++;
+    char *string = (char*)*pb;
+    if (length < 0 || (size_t)length >= (size_t)(end - *pb) * sizeof(int) || string[length] != '\0') {
+        PRINT_LOG("dropping command, its string runs past its length\n");
+        return NULL;
+    }
 
-static void read_counted_strings(int **pb, int count, const char **strings, int *lengths)
+    *pb += CEIL_DIV(length + 1, 4);
+    return string;
+}
+
+/*
+ * counted strings have no terminator; false if one runs past end
+ */
+static bool read_counted_strings(int **pb, const int *end, int count, const char **strings, int *lengths)
 {
     for (int i = 0; i < count; i++) {
+        if (*pb == end)
+            return false;
+
         lengths[i] = *(*pb)++;
         strings[i] = (const char*)*pb;
+        if (lengths[i] < 0 || (size_t)lengths[i] > (size_t)(end - *pb) * sizeof(int)) {
+            PRINT_LOG("dropping command, its strings run past its length\n");
+            return false;
+        }
+
         *pb += CEIL_DIV(lengths[i], 4);
     }
+    return true;
 }
 
-static void read_counted_c_strings(int **pb, int count, const char **strings)
+static bool read_counted_c_strings(int **pb, const int *end, int count, const char **strings)
 {
     int *scan = *pb;
     size_t total_size = 0;
 
     for (int i = 0; i < count; i++) {
+        if (scan == end)
+            return false;
+
         int len = *scan++;
+        if (len < 0 || (size_t)len > (size_t)(end - scan) * sizeof(int)) {
+            PRINT_LOG("dropping command, its strings run past its length\n");
+            return false;
+        }
+
         total_size += (size_t)len + 1;
         scan += CEIL_DIV(len, 4);
     }
@@ -71,6 +113,7 @@ static void read_counted_c_strings(int **pb, int count, const char **strings)
         cursor += len + 1;
         *pb += CEIL_DIV(len, 4);
     }
+    return true;
 }
 
 struct sgl_connection {
@@ -107,13 +150,729 @@ static void connection_add(int id, int fd)
     con->fd = fd;
 }
 
-static void connection_current(int id)
+static struct sgl_host_context *connection_current(int id)
 {
     for (struct sgl_connection *con = connections; con; con = con->next)
         if (con->id == id) {
             sgl_set_current(con->ctx);
-            return;
+            return con->ctx;
+        }
+
+    return NULL;
+}
+
+/*
+ * the context's upload buffer, grown to at least `size` bytes
+ */
+static void *upload_buffer(struct sgl_host_context *ctx, size_t size)
+{
+    if (ctx->upload_parts_size < size) {
+        void *parts = realloc(ctx->upload_parts, size);
+        if (parts == NULL)
+            return NULL;
+        ctx->upload_parts = parts;
+        ctx->upload_parts_size = size;
+    }
+
+    return ctx->upload_parts;
+}
+
+static void *upload_part(struct sgl_host_context *ctx, int total, int offset, int count, const int *data)
+{
+    size_t size = (size_t)(unsigned int)total * sizeof(int);
+
+    if (ctx == NULL || offset < 0 || count < 0 || (size_t)offset + (size_t)count > (size_t)(unsigned int)total)
+        return NULL;
+
+    if (upload_buffer(ctx, size) == NULL)
+        return NULL;
+
+    memcpy((int*)ctx->upload_parts + offset, data, (size_t)count * sizeof(int));
+    return ctx->upload_parts;
+}
+
+/*
+ * glBindBuffer, keeping track of what's bound to GL_ARRAY_BUFFER so
+ * sgl_draw_immediate can put it back without asking the driver
+ */
+static void sgl_bind_buffer(struct sgl_host_context *ctx, GLenum target, GLuint buffer)
+{
+    if (ctx != NULL && target == GL_ARRAY_BUFFER)
+        ctx->array_buffer = buffer;
+    glBindBuffer(target, buffer);
+}
+
+/*
+ * deleting a bound buffer or vertex array binds zero in its place
+ */
+static void sgl_unbind_deleted(GLuint *bound, const GLuint *names, int count)
+{
+    if (bound == NULL)
+        return;
+
+    for (int i = 0; i < count; i++)
+        if (names[i] != 0 && names[i] == *bound)
+            *bound = 0;
+}
+
+/*
+ * where an array or index pointer sourced from the current upload
+ * should point: into the buffer of the cache entry it came from (or a
+ * copy in the stream ring without one), with it bound to `target`, or
+ * at the upload itself when that can't be done. the ring copy is made
+ * once per upload, however many arrays share it
+ */
+static const void *sgl_upload_pointer(struct sgl_host_context *ctx, void *uploaded, size_t uploaded_size,
+        struct sgl_upload_cache_entry *entry, intptr_t *uploaded_stream, int64_t offset, GLenum target)
+{
+    if (entry == NULL && *uploaded_stream < 0 && ctx != NULL && uploaded != NULL)
+        *uploaded_stream = sgl_stream_write(&ctx->stream, uploaded, uploaded_size);
+
+    if (*uploaded_stream >= 0 && *uploaded_stream + offset >= 0) {
+        sgl_bind_buffer(ctx, target, entry != NULL ? entry->buffer : ctx->stream.buffer);
+        return (const void*)(uintptr_t)(*uploaded_stream + offset);
+    }
+
+    /*
+     * before the start of an entry only kept in its buffer: copy it to
+     * the ring with room ahead of it, or failing that, read it back
+     */
+    if (entry != NULL && uploaded == NULL) {
+        intptr_t copy = sgl_stream_copy(&ctx->stream, entry->buffer, (size_t)-offset, entry->size);
+        if (copy >= 0) {
+            sgl_bind_buffer(ctx, target, ctx->stream.buffer);
+            return (const void*)(uintptr_t)(copy + offset);
         }
+        uploaded = sgl_upload_cache_data(entry);
+        if (uploaded == NULL)
+            return NULL;
+    }
+
+    return (char*)uploaded + offset;
+}
+
+/*
+ * the client only sends client-memory arrays and indices while the
+ * matching buffer binding is zero, so that's what is restored after
+ */
+#define UPLOAD_POINTER(offset, target) \
+    sgl_upload_pointer(ctx, uploaded, uploaded_size, uploaded_entry, &uploaded_stream, (offset), (target))
+
+/*
+ * with validation on, every draw stays its own call so errors are
+ * still pinned on the command that raised them
+ */
+#define COALESCE_DRAWS \
+    (!validate && (ctx == NULL || !ctx->reads_draw_id))
+
+/*
+ * counts come from the client, so whatever a handler reads or hands
+ * the driver by count has to fit in what's left of the command before
+ * next. a negative count never reaches the driver, the error it would
+ * have raised is recorded instead
+ */
+static bool sgl_operands_fit(struct sgl_host_context *ctx, int cmd, const int *pb, const int *next, int64_t count, size_t size)
+{
+    if (count < 0) {
+        if (ctx != NULL && ctx->error == GL_NO_ERROR)
+            ctx->error = GL_INVALID_VALUE;
+        return false;
+    }
+
+    if ((uint64_t)count * size <= (uint64_t)(next - pb) * sizeof(int))
+        return true;
+
+    PRINT_LOG("dropping %s, %" PRId64 " operands of %zu bytes run past its length\n", sgl_cmd2str(cmd), count, size);
+    return false;
+}
+
+#define OPERANDS_FIT(count, size) \
+    sgl_operands_fit(ctx, cmd, pb, next, (count), (size))
+
+/*
+ * bytes per list name for glCallLists, 0 for types it refuses
+ * without reading anything
+ */
+static size_t sgl_call_lists_type_size(GLenum type)
+{
+    switch (type) {
+    case GL_BYTE:
+    case GL_UNSIGNED_BYTE:
+        return 1;
+    case GL_SHORT:
+    case GL_UNSIGNED_SHORT:
+    case GL_2_BYTES:
+        return 2;
+    case GL_3_BYTES:
+        return 3;
+    case GL_INT:
+    case GL_UNSIGNED_INT:
+    case GL_FLOAT:
+    case GL_4_BYTES:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+static const unsigned short sgl_cmd_lengths[SGL_CMD_MAX] = {
+#define SGL_COMMAND(name, length) length,
+#include <sglcommands.h>
+#undef SGL_COMMAND
+};
+
+/*
+ * where the command at pb ends, NULL if its opcode is unknown, its
+ * length isn't the one its operands always take, or it runs past the
+ * terminator at end
+ */
+static int *sgl_next_command(int *pb, int *end)
+{
+    int opcode = SGL_CMD_OPCODE(*pb);
+    size_t length = SGL_CMD_LENGTH(*pb);
+    int *operands = pb + 1;
+
+    if (opcode >= SGL_CMD_MAX)
+        return NULL;
+
+    if (length == SGL_CMD_LENGTH_LONG) {
+        if (operands == end)
+            return NULL;
+        length = (size_t)(unsigned int)*operands++;
+    }
+
+    if (sgl_cmd_lengths[opcode] != SGL_CMD_VARIABLE_LENGTH && length != sgl_cmd_lengths[opcode])
+        return NULL;
+    if (length > (size_t)(end - operands))
+        return NULL;
+    return operands + length;
+}
+
+/*
+ * runs of draws with nothing in between but more draws of the same
+ * kind are handed to the driver as one multi-draw, which behaves the
+ * same apart from gl_DrawID. the next header is always readable, the
+ * stream ends with a terminator at end
+ */
+static bool sgl_next_draw_arrays(int **pb, int *end, int mode, GLint *first, GLsizei *count)
+{
+    int *next = *pb;
+    if (next[0] != SGL_CMD_HEADER(SGL_CMD_DRAWARRAYS, 3) || end - next < 4 || next[1] != mode || next[3] < 0)
+        return false;
+
+    *first = next[2];
+    *count = next[3];
+    *pb = next + 4;
+    return true;
+}
+
+/*
+ * only draws from element array buffer offsets join a run; indices
+ * from client memory come with an upload in front of every draw
+ */
+static bool sgl_next_draw_elements(int **pb, int *end, int mode, int type, GLsizei *count, const void **indices, GLint *basevertex)
+{
+    int *next = *pb;
+    bool has_basevertex = next[0] == SGL_CMD_HEADER(SGL_CMD_DRAWELEMENTSBASEVERTEX, 7);
+    int64_t offset;
+
+    if ((next[0] != SGL_CMD_HEADER(SGL_CMD_DRAWELEMENTS, 6) && !has_basevertex) || end - next < (has_basevertex ? 8 : 7))
+        return false;
+    if (next[1] != mode || next[2] < 0 || next[3] != type || next[6] != 0)
+        return false;
+
+    memcpy(&offset, next + 4, sizeof(offset));
+    *count = next[2];
+    *indices = (const void*)(uintptr_t)offset;
+    *basevertex = has_basevertex ? next[7] : 0;
+    *pb = next + (has_basevertex ? 8 : 7);
+    return true;
+}
+
+static void sgl_draw_arrays_run(int **pb, int *end, bool coalesce, int mode, GLint first, GLsizei count)
+{
+    GLint firsts[SGL_MULTIDRAW_MAX] = { first };
+    GLsizei counts[SGL_MULTIDRAW_MAX] = { count };
+    int n = 1;
+
+    while (coalesce && count >= 0 && n < SGL_MULTIDRAW_MAX && sgl_next_draw_arrays(pb, end, mode, &firsts[n], &counts[n]))
+        n++;
+
+    sgl_stats.draws += n;
+    if (n == 1) {
+        glDrawArrays(mode, first, count);
+        return;
+    }
+
+    glMultiDrawArrays(mode, firsts, counts, n);
+    sgl_stats.coalesced_draws += n;
+    sgl_stats.coalesced_calls++;
+}
+
+static void sgl_draw_elements_run(int **pb, int *end, bool coalesce, int mode, int type, GLsizei count, const void *indices, GLint basevertex)
+{
+    GLsizei counts[SGL_MULTIDRAW_MAX] = { count };
+    const void *offsets[SGL_MULTIDRAW_MAX] = { indices };
+    GLint basevertices[SGL_MULTIDRAW_MAX] = { basevertex };
+    bool has_basevertex = basevertex != 0;
+    int n = 1;
+
+    while (coalesce && count >= 0 && n < SGL_MULTIDRAW_MAX && sgl_next_draw_elements(pb, end, mode, type, &counts[n], &offsets[n], &basevertices[n]))
+        has_basevertex |= basevertices[n++] != 0;
+
+    sgl_stats.draws += n;
+    if (n == 1) {
+        if (has_basevertex)
+            glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+        else
+            glDrawElements(mode, count, type, indices);
+        return;
+    }
+
+    if (has_basevertex)
+        glMultiDrawElementsBaseVertex(mode, counts, type, offsets, n, basevertices);
+    else
+        glMultiDrawElements(mode, counts, type, offsets, n);
+    sgl_stats.coalesced_draws += n;
+    sgl_stats.coalesced_calls++;
+}
+
+static void sgl_note_draw_id(struct sgl_host_context *ctx, const char **strings, const int *lengths, int count)
+{
+    static const char name[] = "gl_DrawID";
+    const int name_length = sizeof(name) - 1;
+
+    for (int i = 0; ctx != NULL && i < count; i++)
+        for (int j = 0; strings[i] != NULL && j + name_length <= lengths[i]; j++)
+            if (strings[i][j] == 'g' && memcmp(strings[i] + j, name, name_length) == 0)
+                ctx->reads_draw_id = true;
+}
+
+/*
+ * draws a glBegin/glEnd pair the client batched into interleaved
+ * floats; it goes through a vertex array of its own, sourced from the
+ * stream ring, so the application's array state is left as it was
+ */
+static void sgl_draw_immediate(struct sgl_host_context *ctx, int mode, int count, int layout, const void *vertices)
+{
+    int position = SGL_IMMEDIATE_POSITION_SIZE(layout),
+        color = SGL_IMMEDIATE_COLOR_SIZE(layout),
+        normal = SGL_IMMEDIATE_NORMAL_SIZE(layout),
+        texcoord = SGL_IMMEDIATE_TEXCOORD_SIZE(layout);
+    int stride = (position + color + normal + texcoord) * sizeof(float);
+    intptr_t offset;
+
+    if (ctx == NULL || vertices == NULL || count <= 0 || position < 2 || position > 4 ||
+            color > 4 || (normal != 0 && normal != 3) || texcoord > 4)
+        return;
+
+    if (ctx->immediate_vao == 0)
+        glGenVertexArrays(1, &ctx->immediate_vao);
+
+    if (!ctx->bindings_known) {
+        GLint vertex_array, array_buffer, client_texture;
+        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &vertex_array);
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &array_buffer);
+        glGetIntegerv(GL_CLIENT_ACTIVE_TEXTURE, &client_texture);
+
+        ctx->vertex_array = vertex_array;
+        ctx->array_buffer = array_buffer;
+        ctx->client_active_texture = client_texture;
+        ctx->bindings_known = true;
+    }
+
+    glBindVertexArray(ctx->immediate_vao);
+
+    offset = sgl_stream_write(&ctx->stream, vertices, (size_t)count * stride);
+    if (offset >= 0) {
+        glBindBuffer(GL_ARRAY_BUFFER, ctx->stream.buffer);
+    }
+    else {
+        if (ctx->immediate_vbo == 0)
+            glGenBuffers(1, &ctx->immediate_vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, ctx->immediate_vbo);
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)count * stride, vertices, GL_STREAM_DRAW);
+        offset = 0;
+    }
+
+    glVertexPointer(position, GL_FLOAT, stride, (const void*)offset);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    offset += position * sizeof(float);
+
+    if (color) {
+        glColorPointer(color, GL_FLOAT, stride, (const void*)offset);
+        glEnableClientState(GL_COLOR_ARRAY);
+        offset += color * sizeof(float);
+    }
+    else {
+        glDisableClientState(GL_COLOR_ARRAY);
+    }
+
+    if (normal) {
+        glNormalPointer(GL_FLOAT, stride, (const void*)offset);
+        glEnableClientState(GL_NORMAL_ARRAY);
+        offset += normal * sizeof(float);
+    }
+    else {
+        glDisableClientState(GL_NORMAL_ARRAY);
+    }
+
+    glClientActiveTexture(GL_TEXTURE0);
+    if (texcoord) {
+        glTexCoordPointer(texcoord, GL_FLOAT, stride, (const void*)offset);
+        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    }
+    else {
+        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    }
+
+    glDrawArrays(mode, 0, count);
+
+    glClientActiveTexture(ctx->client_active_texture);
+    glBindBuffer(GL_ARRAY_BUFFER, ctx->array_buffer);
+    glBindVertexArray(ctx->vertex_array);
+}
+
+/*
+ * buffers and textures come into existence on the host the first
+ * time their client name is used, much like glGen* names on bind
+ */
+static GLuint sgl_host_name(struct sgl_host_context *ctx, enum sgl_namespace ns, GLuint name)
+{
+    if (ctx == NULL || name == 0)
+        return 0;
+
+    struct sgl_name_table *table = &ctx->names[ns];
+    GLuint host = sgl_name_lookup(table, name);
+    if (host != 0 || ns == SGL_NAMESPACE_SHADER)
+        return host;
+
+    if (ns == SGL_NAMESPACE_BUFFER)
+        glGenBuffers(1, &host);
+    else
+        glGenTextures(1, &host);
+
+    if (!sgl_name_bind(table, name, host)) {
+        PRINT_LOG("failed to map client name %u (namespace %d)\n", name, ns);
+        if (ns == SGL_NAMESPACE_BUFFER)
+            glDeleteBuffers(1, &host);
+        else
+            glDeleteTextures(1, &host);
+        return 0;
+    }
+
+    return host;
+}
+
+static inline GLuint sgl_buffer_name(struct sgl_host_context *ctx, GLuint name)
+{
+    return sgl_host_name(ctx, SGL_NAMESPACE_BUFFER, name);
+}
+
+static inline GLuint sgl_texture_name(struct sgl_host_context *ctx, GLuint name)
+{
+    return sgl_host_name(ctx, SGL_NAMESPACE_TEXTURE, name);
+}
+
+/*
+ * shaders and programs are only ever made by their create commands
+ */
+static inline GLuint sgl_shader_name(struct sgl_host_context *ctx, GLuint name)
+{
+    return sgl_host_name(ctx, SGL_NAMESPACE_SHADER, name);
+}
+
+/*
+ * objects made by a create command are mapped as soon as they exist
+ */
+static void sgl_bind_name(struct sgl_host_context *ctx, enum sgl_namespace ns, GLuint name, GLuint host)
+{
+    if (ctx == NULL || !sgl_name_bind(&ctx->names[ns], name, host))
+        PRINT_LOG("failed to map client name %u (namespace %d)\n", name, ns);
+}
+
+/*
+ * for glIs*, which must not create anything
+ */
+static inline GLuint sgl_existing_name(struct sgl_host_context *ctx, enum sgl_namespace ns, GLuint name)
+{
+    return ctx == NULL ? 0 : sgl_name_lookup(&ctx->names[ns], name);
+}
+
+static inline GLuint sgl_client_name(struct sgl_host_context *ctx, enum sgl_namespace ns, GLuint host)
+{
+    return ctx == NULL ? 0 : sgl_name_reverse(&ctx->names[ns], host);
+}
+
+/*
+ * translates an inline array of names in place
+ */
+static void sgl_host_names(struct sgl_host_context *ctx, enum sgl_namespace ns, GLuint *names, int count)
+{
+    for (int i = 0; i < count; i++)
+        names[i] = sgl_host_name(ctx, ns, names[i]);
+}
+
+/*
+ * deleted names may be handed out again by the client right away,
+ * so drop their mappings and leave the host names to delete
+ */
+static void sgl_forget_names(struct sgl_host_context *ctx, enum sgl_namespace ns, GLuint *names, int count)
+{
+    for (int i = 0; i < count; i++)
+        names[i] = ctx == NULL ? 0 : sgl_name_forget(&ctx->names[ns], names[i]);
+}
+
+/*
+ * with the program cache in use, compiles are put off until something
+ * depends on their outcome, since a program found in the cache doesn't
+ * need its shaders compiled at all
+ */
+static void sgl_compile_shader(struct sgl_host_context *ctx, int shader)
+{
+    GLuint host = sgl_shader_name(ctx, shader);
+    struct sgl_shader_record *record = ctx ? sgl_shader_record_find(&ctx->shaders, shader) : NULL;
+
+    if (record != NULL)
+        record->compile_pending = false;
+
+    glCompileShader(host);
+
+    if (record != NULL && record->has_source && sgl_program_cache_ready()) {
+        GLint status = GL_FALSE;
+        glGetShaderiv(host, GL_COMPILE_STATUS, &status);
+        if (status == GL_TRUE)
+            sgl_program_cache_note_compiled(&record->key);
+    }
+}
+
+static void sgl_finish_compile(struct sgl_host_context *ctx, int shader)
+{
+    struct sgl_shader_record *record = ctx ? sgl_shader_record_find(&ctx->shaders, shader) : NULL;
+    if (record != NULL && record->compile_pending)
+        sgl_compile_shader(ctx, shader);
+}
+
+static void sgl_defer_compile(struct sgl_host_context *ctx, int shader)
+{
+    struct sgl_shader_record *record = ctx ? sgl_shader_record_find(&ctx->shaders, shader) : NULL;
+    if (record != NULL && record->has_source && sgl_program_cache_ready())
+        record->compile_pending = true;
+    else
+        sgl_compile_shader(ctx, shader);
+}
+
+static void sgl_set_shader_source(struct sgl_host_context *ctx, int shader, const struct sgl_blob_key *key, const char *source)
+{
+    GLint length = (GLint)key->size;
+
+    /*
+     * a compile still owed is of the source being replaced
+     */
+    sgl_finish_compile(ctx, shader);
+
+    struct sgl_shader_record *record = ctx ? sgl_shader_record(&ctx->shaders, shader) : NULL;
+    if (record != NULL) {
+        record->key = *key;
+        record->has_source = true;
+    }
+
+    sgl_note_draw_id(ctx, &source, &length, 1);
+    glShaderSource(sgl_shader_name(ctx, shader), 1, &source, &length);
+}
+
+/*
+ * for sources set some other way, which the program cache can't key
+ */
+static void sgl_forget_shader_source(struct sgl_host_context *ctx, int shader)
+{
+    sgl_finish_compile(ctx, shader);
+
+    struct sgl_shader_record *record = ctx ? sgl_shader_record_find(&ctx->shaders, shader) : NULL;
+    if (record != NULL)
+        record->has_source = false;
+}
+
+/*
+ * joined into one string, so a source hashes the same however it was
+ * split up; returns whether the blob store kept it, after which the
+ * client may send just its key
+ */
+static bool sgl_shader_source(struct sgl_host_context *ctx, int shader, int count, const char **strings, const int *lengths)
+{
+    if (ctx == NULL || (!sgl_program_cache_ready() && !sgl_blob_store_enabled())) {
+        sgl_note_draw_id(ctx, strings, lengths, count);
+        glShaderSource(sgl_shader_name(ctx, shader), count, strings, lengths);
+        return false;
+    }
+
+    size_t size = 0;
+    for (int i = 0; i < count; i++)
+        size += lengths[i];
+
+    char *source = scratch_buffer_get(size ? size : 1), *cursor = source;
+    for (int i = 0; i < count; i++) {
+        memcpy(cursor, strings[i], lengths[i]);
+        cursor += lengths[i];
+    }
+
+    struct sgl_blob_key key = sgl_blob_key_of(source, size);
+    sgl_set_shader_source(ctx, shader, &key, source);
+
+    sgl_blob_insert(&key, source);
+    return sgl_blob_find(&key) != NULL;
+}
+
+/*
+ * client names of the shaders attached to a program, given its host
+ * name; shaders can't be looked up any more once they're deleted
+ */
+static GLsizei sgl_attached_shaders(struct sgl_host_context *ctx, GLuint program, GLsizei max_count, GLuint *shaders)
+{
+    GLsizei count = 0;
+    glGetAttachedShaders(program, max_count, &count, shaders);
+    for (GLsizei i = 0; i < count; i++)
+        shaders[i] = sgl_client_name(ctx, SGL_NAMESPACE_SHADER, shaders[i]);
+    return count;
+}
+
+static void sgl_finish_attached_compiles(struct sgl_host_context *ctx, GLuint program)
+{
+    GLint max_count = 0;
+    if (ctx == NULL)
+        return;
+
+    glGetProgramiv(program, GL_ATTACHED_SHADERS, &max_count);
+    if (max_count <= 0)
+        return;
+
+    GLuint shaders[max_count];
+    GLsizei count = sgl_attached_shaders(ctx, program, max_count, shaders);
+    for (GLsizei i = 0; i < count; i++)
+        sgl_finish_compile(ctx, shaders[i]);
+}
+
+/*
+ * state given to a program before linking that changes what it links
+ * to; the program's own name is left out, it can differ between runs
+ */
+static void sgl_note_link_state(struct sgl_host_context *ctx, int program, const int *begin, const int *end)
+{
+    struct sgl_shader_record *record = ctx ? sgl_shader_record(&ctx->shaders, program) : NULL;
+    if (record != NULL)
+        sgl_shader_record_mix(record, begin, (end - begin) * sizeof(int));
+}
+
+static int sgl_digest_compare(const void *a, const void *b)
+{
+    return memcmp(a, b, SGL_SHA256_SIZE);
+}
+
+/*
+ * a program is known by its link state and the sources and stages of
+ * its shaders, in no particular order, so stages are sorted by digest
+ * before they're combined; a program with a shader whose source the
+ * server never saw isn't cached
+ */
+static bool sgl_program_key(struct sgl_host_context *ctx, int program, GLuint host, uint64_t key[4])
+{
+    struct sgl_shader_record *record = sgl_shader_record(&ctx->shaders, program);
+    GLint max_count = 0;
+
+    glGetProgramiv(host, GL_ATTACHED_SHADERS, &max_count);
+    if (record == NULL || max_count <= 0)
+        return false;
+
+    GLuint shaders[max_count];
+    GLsizei count = sgl_attached_shaders(ctx, host, max_count, shaders);
+    uint64_t stages[max_count][4];
+    struct sgl_sha256 sha;
+
+    for (GLsizei i = 0; i < count; i++) {
+        struct sgl_shader_record *shader = sgl_shader_record_find(&ctx->shaders, shaders[i]);
+        if (shader == NULL || !shader->has_source)
+            return false;
+
+        GLint type = 0;
+        glGetShaderiv(sgl_shader_name(ctx, shaders[i]), GL_SHADER_TYPE, &type);
+
+        uint64_t stage_type = (uint64_t)type;
+        sgl_sha256_init(&sha);
+        sgl_sha256_update(&sha, &shader->key, sizeof(shader->key));
+        sgl_sha256_update(&sha, &stage_type, sizeof(stage_type));
+        sgl_sha256_final(&sha, stages[i]);
+    }
+
+    qsort(stages, count, sizeof(*stages), sgl_digest_compare);
+
+    sgl_sha256_init(&sha);
+    sgl_sha256_update(&sha, record->key.hash, sizeof(record->key.hash));
+    sgl_sha256_update(&sha, stages, (size_t)count * sizeof(*stages));
+    sgl_sha256_final(&sha, key);
+    return true;
+}
+
+static void sgl_link_program(struct sgl_host_context *ctx, int program)
+{
+    GLuint host = sgl_shader_name(ctx, program);
+    uint64_t key[4];
+
+    if (ctx == NULL || !sgl_program_cache_ready()) {
+        glLinkProgram(host);
+        return;
+    }
+
+    bool cacheable = sgl_program_key(ctx, program, host, key);
+    if (cacheable && sgl_program_cache_load(host, key))
+        return;
+
+    sgl_finish_attached_compiles(ctx, host);
+    glProgramParameteri(host, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(host);
+
+    if (cacheable)
+        sgl_program_cache_save(host, key);
+}
+
+/*
+ * binding queries answer with host names, hand back the client's
+ */
+static void sgl_client_binding(struct sgl_host_context *ctx, GLenum pname, int *v)
+{
+    switch (pname) {
+    case GL_ARRAY_BUFFER_BINDING:
+    case GL_ELEMENT_ARRAY_BUFFER_BINDING:
+    case GL_PIXEL_PACK_BUFFER_BINDING:
+    case GL_PIXEL_UNPACK_BUFFER_BINDING:
+    case GL_COPY_READ_BUFFER_BINDING:
+    case GL_COPY_WRITE_BUFFER_BINDING:
+    case GL_DRAW_INDIRECT_BUFFER_BINDING:
+    case GL_DISPATCH_INDIRECT_BUFFER_BINDING:
+    case GL_UNIFORM_BUFFER_BINDING:
+    case GL_SHADER_STORAGE_BUFFER_BINDING:
+    case GL_ATOMIC_COUNTER_BUFFER_BINDING:
+    case GL_TRANSFORM_FEEDBACK_BUFFER_BINDING:
+    case GL_TEXTURE_BUFFER_BINDING:
+    case GL_QUERY_BUFFER_BINDING:
+        v[0] = sgl_client_name(ctx, SGL_NAMESPACE_BUFFER, v[0]);
+        break;
+    case GL_TEXTURE_BINDING_1D:
+    case GL_TEXTURE_BINDING_2D:
+    case GL_TEXTURE_BINDING_3D:
+    case GL_TEXTURE_BINDING_1D_ARRAY:
+    case GL_TEXTURE_BINDING_2D_ARRAY:
+    case GL_TEXTURE_BINDING_RECTANGLE:
+    case GL_TEXTURE_BINDING_BUFFER:
+    case GL_TEXTURE_BINDING_CUBE_MAP:
+    case GL_TEXTURE_BINDING_CUBE_MAP_ARRAY:
+    case GL_TEXTURE_BINDING_2D_MULTISAMPLE:
+    case GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY:
+        v[0] = sgl_client_name(ctx, SGL_NAMESPACE_TEXTURE, v[0]);
+        break;
+    case GL_CURRENT_PROGRAM:
+        v[0] = sgl_client_name(ctx, SGL_NAMESPACE_SHADER, v[0]);
+        break;
+    }
 }
 
 static void connection_rem(int id, ENetHost *server)
@@ -128,9 +887,14 @@ static inline char *sgl_client_slot(void *shared, int client_id)
     return (char*)shared + SGL_CLIENT_SLOT_OFFSET(client_id);
 }
 
+/*
+ * slots the stage was split between, see sgl_cmd_processor_args
+ */
+static int max_clients = SGL_DEFAULT_CLIENTS;
+
 static inline bool sgl_valid_client_id(int client_id)
 {
-    return client_id > 0 && client_id <= SGL_MAX_CLIENTS;
+    return client_id > 0 && client_id <= max_clients;
 }
 
 static void sgl_release_client_slot(void *shared, int client_id)
@@ -147,17 +911,13 @@ static void sgl_release_client_slot(void *shared, int client_id)
 
     sgl_spin_lock(lock);
     memset(client_slot, 0, SGL_CLIENT_SLOT_SIZE);
+    __sync_fetch_and_and((int*)((char*)shared + SGL_OFFSET_REGISTER_READY_MASK), ~(int)SGL_SHM_SLOT_BIT(client_id));
     slot_mask = (uint32_t)*(int*)((char*)shared + SGL_OFFSET_REGISTER_SHM_SLOT_MASK);
     slot_mask &= ~SGL_SHM_SLOT_BIT(client_id);
     *(int*)((char*)shared + SGL_OFFSET_REGISTER_SHM_SLOT_MASK) = (int)slot_mask;
     sgl_spin_unlock(lock);
 }
 
-static bool wait_for_submit(void *p) 
-{
-    return *(int*)((char*)p + SGL_OFFSET_REGISTER_SUBMIT) == 1;
-}
-
 static FORCEINLINE inline int64_t pb_next_i64(int **pb)
 {
     int64_t value;
@@ -166,16 +926,87 @@ static FORCEINLINE inline int64_t pb_next_i64(int **pb)
     return value;
 }
 
-static FORCEINLINE inline void wait_shm(void *p, int *client_id, size_t *submit_size)
+static inline bool sgl_valid_submit(const char *cmd_base, size_t offset, size_t size, size_t fifo_size)
+{
+    if (size < sizeof(int) || size % sizeof(int) != 0)
+        return false;
+    if (offset > fifo_size || size > fifo_size - offset)
+        return false;
+    return *(const int*)(cmd_base + size - sizeof(int)) == SGL_CMD_INVALID;
+}
+
+/*
+ * bulk readbacks land in the client's own ring, so they must stay
+ * inside it and clear of the submit still being decoded
+ */
+static inline bool sgl_valid_readback(size_t offset, size_t length, size_t submit_offset, size_t submit_size, size_t fifo_size)
+{
+    if (offset > fifo_size || length > fifo_size - offset)
+        return false;
+    return offset >= submit_offset + submit_size || offset + length <= submit_offset;
+}
+
+static FORCEINLINE inline int take_ready_client(int *ready_mask, int last_client_id)
+{
+    uint32_t mask = (uint32_t)*(volatile int*)ready_mask;
+
+    /*
+     * round-robin starting after the last client served, so
+     * a chatty client can't starve the others
+     */
+    for (int i = 1; i <= max_clients; i++) {
+        int id = ((last_client_id + i - 1) % max_clients) + 1;
+        if (mask & SGL_SHM_SLOT_BIT(id)) {
+            __sync_fetch_and_and(ready_mask, ~(int)SGL_SHM_SLOT_BIT(id));
+            return id;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * how long wait_shm spins before going to sleep, and how long a
+ * single sleep lasts; guests can't wake a futex on the host, so the
+ * timeout is their wake-up latency. it starts short and doubles while
+ * the server stays idle, a guest that just went quiet is picked up
+ * quickly and a long idle costs a wake-up a millisecond
+ */
+#define SGL_IDLE_SPIN_ITERATIONS    (1 << 16)
+#define SGL_IDLE_SLEEP_MIN_NS       50000
+#define SGL_IDLE_SLEEP_NS           1000000
+
+static void sleep_until_ready(void *p, int *ready_mask, long sleep_ns)
+{
+    int *waiting = (int*)((char*)p + SGL_OFFSET_REGISTER_SERVER_WAITING);
+    struct timespec timeout = { 0, sleep_ns };
+
+    /*
+     * clients read WAITING after setting their ready bit, so
+     * either they see it and wake us, or the futex sees their bit
+     */
+    *(volatile int*)waiting = 1;
+    __sync_synchronize();
+    if (*(volatile int*)((char*)p + SGL_OFFSET_REGISTER_CONNECT) == 0)
+        syscall(SYS_futex, ready_mask, FUTEX_WAIT, 0, &timeout, NULL, 0);
+    *(volatile int*)waiting = 0;
+}
+
+static FORCEINLINE inline void wait_shm(void *p, int *client_id, size_t *submit_size, bool idle_sleep)
 {
+    static int last_client_id = 0;
+    int *ready_mask = (int*)((char*)p + SGL_OFFSET_REGISTER_READY_MASK);
+    int spins = 0;
+    long sleep_ns = SGL_IDLE_SLEEP_MIN_NS;
+
     /*
-     * not only wait for a submit from a specific client,
-     * but also ensure that the client we are waiting for
-     * still exists, in case it didn't notify the server
-     * of its exit
+     * wait for any client to flag its ring as ready; clients
+     * announce themselves through CONNECT before their first
+     * submit, so always look at CONNECT after seeing the mask
      */
     while (1) {
-        int creg = *(int*)((char*)p + SGL_OFFSET_REGISTER_CONNECT);
+        bool any_ready = *(volatile int*)ready_mask != 0;
+        int creg = *(volatile int*)((char*)p + SGL_OFFSET_REGISTER_CONNECT);
 
         /*
          * a client has notified the server of its attempt
@@ -197,8 +1028,23 @@ static FORCEINLINE inline void wait_shm(void *p, int *client_id, size_t *submit_
             continue;
         }
 
-        if (wait_for_submit(p))
-            break;
+        if (any_ready) {
+            *client_id = take_ready_client(ready_mask, last_client_id);
+            if (*client_id != 0)
+                break;
+        }
+
+        /*
+         * once the spin window is over, only sleeps until something
+         * is served; spinning again after every timeout would keep
+         * an idle server busy
+         */
+        if (idle_sleep && spins >= SGL_IDLE_SPIN_ITERATIONS) {
+            sleep_until_ready(p, ready_mask, sleep_ns);
+            sleep_ns = MIN(sleep_ns * 2, SGL_IDLE_SLEEP_NS);
+            continue;
+        }
+        spins++;
 
         /*
          * some sort of "sync"
@@ -206,8 +1052,8 @@ static FORCEINLINE inline void wait_shm(void *p, int *client_id, size_t *submit_
         _mm_pause();
     }
 
-    *client_id = *(int*)((char*)p + SGL_OFFSET_REGISTER_STAGE_CLIENT_ID);
-    *submit_size = (size_t)*(int*)((char*)p + SGL_OFFSET_REGISTER_STAGE_SIZE);
+    last_client_id = *client_id;
+    *submit_size = (size_t)*(int*)((char*)p + SGL_CLIENT_SLOT_OFFSET(*client_id) + SGL_OFFSET_REGISTER_RING_SUBMIT_SIZE);
 }
 
 static void sgl_net_accept_connection(void *p, ENetHost *server, ENetPeer *peer, struct sgl_cmd_processor_args args, 
@@ -222,7 +1068,10 @@ static void sgl_net_accept_connection(void *p, ENetHost *server, ENetPeer *peer,
         /* gl_major = */           args.gl_major,
         /* gl_minor = */           args.gl_minor,
         /* max_width= */           width,
-        /* max_height= */          height
+        /* max_height= */          height,
+        /* protocol = */           SGL_PROTOCOL_VERSION,
+        /* upload_cache = */       args.upload_cache_size,
+        /* blob_store = */         sgl_blob_store_enabled()
     };
 
     ENetPacket *epacket = __enet_packet_create(&packet, sizeof(packet), ENET_PACKET_FLAG_RELIABLE);
@@ -246,12 +1095,26 @@ static void sgl_net_send_framebuffer(void *p, ENetHost *server, ENetPeer *peer,
     __enet_peer_send(peer, 0, epacket);
 }
 
-static void sgl_net_get_fifo_upload(void *p, ENetHost *server, ENetEvent *event)
+/*
+ * the packet has to fit ahead of the framebuffer and end with a
+ * terminator, otherwise it's replaced by an empty submit
+ */
+static size_t sgl_net_get_fifo_upload(void *p, ENetHost *server, ENetEvent *event, size_t fifo_size)
 {
-    memcpy((char*)p + SGL_OFFSET_COMMAND_START, event->packet->data, event->packet->dataLength);
+    size_t size = event->packet->dataLength;
+    size_t capacity = SGL_STAGE_OFFSET + fifo_size - SGL_OFFSET_COMMAND_START;
+
+    if (!sgl_valid_submit((const char*)event->packet->data, 0, size, capacity)) {
+        PRINT_LOG("invalid network submit: size=%zu capacity=%zu\n", size, capacity);
+        *(int*)((char*)p + SGL_OFFSET_COMMAND_START) = SGL_CMD_INVALID;
+        return sizeof(int);
+    }
+
+    memcpy((char*)p + SGL_OFFSET_COMMAND_START, event->packet->data, size);
+    return size;
 }
 
-static FORCEINLINE inline void wait_net(void *p, int *client_id, struct sgl_host_context **out_ctx, ENetPeer **out_peer, ENetHost *server, struct sgl_cmd_processor_args args, 
+static FORCEINLINE inline void wait_net(void *p, int *client_id, size_t *submit_size, struct sgl_host_context **out_ctx, ENetPeer **out_peer, ENetHost *server, struct sgl_cmd_processor_args args, 
         size_t framebuffer_size, size_t fifo_size, int width, int height)
 {
     bool ready_to_render = false;
@@ -272,7 +1135,7 @@ static FORCEINLINE inline void wait_net(void *p, int *client_id, struct sgl_host
                 // to-do
                 break;
             case ENET_EVENT_TYPE_RECEIVE:
-                sgl_net_get_fifo_upload(p, server, &event);
+                *submit_size = sgl_net_get_fifo_upload(p, server, &event, fifo_size);
                 ready_to_render = true;
                 *out_ctx = event.peer->data;
                 *out_peer = event.peer;
@@ -307,28 +1170,47 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
     bool network_expecting_retval = true;
     bool network_did_swap_buffers = false;
     bool begun = false;
-    void *uploaded = NULL;
     void *map_buffer;
     void *download_target = NULL;
     size_t download_offset = 0;
+    char *net_readback = NULL;
+    size_t net_readback_size = 0;
+    size_t net_readback_capacity = 0;
     ENetAddress address = {0};
     ENetHost *server;
     char *shared_exec = NULL;
+    bool validate = sgl_get_error_mode() == SGL_ERROR_MODE_VALIDATE;
     
     sgl_get_max_resolution(&width, &height);
     size_t framebuffer_size = width * height * 4;
-    size_t fifo_size = args.memory_size - SGL_STAGE_OFFSET - framebuffer_size;
+    size_t stage_size = args.memory_size - SGL_STAGE_OFFSET - framebuffer_size;
 
-    if ((intptr_t)fifo_size < 0) {
+    if ((intptr_t)stage_size < 0) {
         PRINT_LOG("framebuffer too big, try increasing memory!\n");
         return;
     }
 
+    /*
+     * shared memory splits the stage into one ring per client slot,
+     * networking has a single stream and keeps the whole stage
+     */
+    size_t fifo_size = stage_size;
+    if (!args.network_over_shared) {
+        max_clients = MIN(MAX(args.max_clients, 1), SGL_MAX_CLIENTS);
+        fifo_size = (stage_size / max_clients) & ~(size_t)0xFFF;
+        stage_size = fifo_size * max_clients;
+        if (fifo_size == 0) {
+            PRINT_LOG("not enough memory for client rings, try increasing memory!\n");
+            return;
+        }
+        PRINT_LOG("%d shared-memory client slots with %zu KiB command rings\n", max_clients, fifo_size / 1024);
+    }
+
     void *shared = args.base_address;
     memset((char*)shared + SGL_MAILBOXES_OFFSET, 0, SGL_MAILBOXES_SIZE);
-    memset((char*)shared + SGL_STAGE_OFFSET, 0, fifo_size);
+    memset((char*)shared + SGL_STAGE_OFFSET, 0, stage_size);
 
-    *(uint64_t*)((char*)shared + SGL_OFFSET_REGISTER_FBSTART) = SGL_STAGE_OFFSET + fifo_size;
+    *(uint64_t*)((char*)shared + SGL_OFFSET_REGISTER_FBSTART) = SGL_STAGE_OFFSET + stage_size;
     *(uint64_t*)((char*)shared + SGL_OFFSET_REGISTER_MEMSIZE) = args.memory_size;
     *(int*)((char*)shared + SGL_OFFSET_REGISTER_GLMAJ) = args.gl_major;
     *(int*)((char*)shared + SGL_OFFSET_REGISTER_GLMIN) = args.gl_minor;
@@ -337,17 +1219,20 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
     *(int*)((char*)shared + SGL_OFFSET_REGISTER_READY_HINT) = 0;
     *(int*)((char*)shared + SGL_OFFSET_REGISTER_LOCK) = 0;
     *(int*)((char*)shared + SGL_OFFSET_REGISTER_SWAP_BUFFERS_SYNC) = 0;
-    *(int*)((char*)shared + SGL_OFFSET_REGISTER_STAGE_CLIENT_ID) = 0;
-    *(int*)((char*)shared + SGL_OFFSET_REGISTER_STAGE_SIZE) = 0;
+    *(int*)((char*)shared + SGL_OFFSET_REGISTER_READY_MASK) = 0;
+    *(int*)((char*)shared + SGL_OFFSET_REGISTER_SERVER_WAITING) = 0;
     *(int*)((char*)shared + SGL_OFFSET_REGISTER_SUBMIT) = 0;
     *(int*)((char*)shared + SGL_OFFSET_REGISTER_FIFO_SIZE) = (int)fifo_size;
-    *(int*)((char*)shared + SGL_OFFSET_REGISTER_MAX_CLIENTS) = SGL_MAX_CLIENTS;
+    *(int*)((char*)shared + SGL_OFFSET_REGISTER_MAX_CLIENTS) = max_clients;
+    *(int*)((char*)shared + SGL_OFFSET_REGISTER_PROTOCOL) = SGL_PROTOCOL_VERSION;
+    *(int*)((char*)shared + SGL_OFFSET_REGISTER_UPLOAD_CACHE) = args.upload_cache_size;
+    *(int*)((char*)shared + SGL_OFFSET_REGISTER_BLOB_STORE) = sgl_blob_store_enabled();
 
     if (args.internal_cmd_ptr)
         *args.internal_cmd_ptr = &cmd;
 
     if (!args.network_over_shared) {
-        shared_exec = calloc(1, SGL_OFFSET_COMMAND_START + fifo_size);
+        shared_exec = calloc(1, SGL_OFFSET_COMMAND_START);
         if (shared_exec == NULL) {
             PRINT_LOG("failed to allocate shared-memory execution buffer\n");
             return;
@@ -380,53 +1265,101 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
         struct sgl_host_context *net_ctx = NULL;
         ENetPeer *peer;
         char *client_slot = NULL;
+        char *cmd_base = NULL;
+        char *ring_base = NULL;
+        int submit_seq = 0;
+        size_t submit_offset = 0;
         void *p = shared;
         
         if (!args.network_over_shared)
-            wait_shm(shared, &client_id, &submit_size);
+            wait_shm(shared, &client_id, &submit_size, args.idle_sleep);
         else
-            wait_net(shared, &client_id, &net_ctx, &peer, server, args, framebuffer_size, fifo_size, width, height);
+            wait_net(shared, &client_id, &submit_size, &net_ctx, &peer, server, args, framebuffer_size, fifo_size, width, height);
 
         if (!args.network_over_shared) {
             if (!sgl_valid_client_id(client_id)) {
                 PRINT_LOG("invalid shared-memory client id %d\n", client_id);
-                *(int*)((char*)shared + SGL_OFFSET_REGISTER_SUBMIT) = 0;
                 continue;
             }
 
             client_slot = sgl_client_slot(shared, client_id);
-            if (submit_size > fifo_size) {
-                PRINT_LOG("shared-memory submit too large: size=%zu capacity=%zu client=%d\n",
-                    submit_size, fifo_size, client_id);
-                memset(client_slot, 0, SGL_CLIENT_SLOT_SIZE);
-                *(int*)((char*)shared + SGL_OFFSET_REGISTER_SUBMIT) = 0;
+            submit_seq = *(int*)(client_slot + SGL_OFFSET_REGISTER_RING_SUBMIT_SEQ);
+            submit_offset = (size_t)(unsigned int)*(int*)(client_slot + SGL_OFFSET_REGISTER_RING_SUBMIT_OFFSET);
+            ring_base = (char*)shared + SGL_CLIENT_RING_OFFSET(client_id, fifo_size);
+            cmd_base = ring_base + submit_offset;
+
+            /*
+             * commands are decoded in place, so make sure the submit
+             * stays within the ring and ends with a terminator
+             */
+            if (!sgl_valid_submit(cmd_base, submit_offset, submit_size, fifo_size)) {
+                PRINT_LOG("invalid shared-memory submit: offset=%zu size=%zu capacity=%zu client=%d\n",
+                    submit_offset, submit_size, fifo_size, client_id);
+                memset(client_slot, 0, SGL_OFFSET_SLOT_CONTROL);
+                __sync_synchronize();
+                *(volatile int*)(client_slot + SGL_OFFSET_REGISTER_RING_DONE_SEQ) = submit_seq;
                 continue;
             }
 
             memset(shared_exec, 0, SGL_CLIENT_SLOT_SIZE);
-            memcpy(shared_exec + SGL_OFFSET_COMMAND_START, (char*)shared + SGL_STAGE_OFFSET, submit_size);
-            *(int*)((char*)shared + SGL_OFFSET_REGISTER_SUBMIT) = 0;
             p = shared_exec;
+
+            /*
+             * the submit registers have been read, let the client queue
+             * its next submit; it won't touch this part of the ring
+             * until RING_DONE_SEQ says we're finished with it
+             */
+            __sync_synchronize();
+            *(volatile int*)(client_slot + SGL_OFFSET_REGISTER_SUBMIT) = 0;
+        }
+        else {
+            cmd_base = (char*)p + SGL_OFFSET_COMMAND_START;
         }
 
         /*
          * set the current opengl context to the current client
          */
+        struct sgl_host_context *ctx = net_ctx;
         if (net_ctx == NULL)
-            connection_current(client_id);
+            ctx = connection_current(client_id);
         else
             sgl_set_current(net_ctx);
+
+        /*
+         * uploads are read by commands in the same submit, other
+         * clients' submits run in between; the one exception is a
+         * blob found by the client's last query, kept in its context
+         */
+        void *uploaded = NULL;
+        size_t uploaded_size = 0;
+        intptr_t uploaded_stream = -1;
+        struct sgl_upload_cache_entry *uploaded_entry = NULL;
+        if (ctx != NULL && ctx->blob_found_size != 0) {
+            uploaded = ctx->upload_parts;
+            uploaded_size = ctx->blob_found_size;
+            ctx->blob_found_size = 0;
+        }
         
-        int *pb = (int*)(p + SGL_OFFSET_COMMAND_START);
-        char *cmd_base = p + SGL_OFFSET_COMMAND_START;
+        int *pb = (int*)cmd_base;
+        int *end = (int*)(cmd_base + submit_size) - 1;
         int release_client_slot = 0;
         // int track = 0;
         while (*pb != SGL_CMD_INVALID) {
-            cmd = *pb;
-            // printf("[%-5d] command: %s (%d)\n", track++, sgl_cmd2str(*pb), *pb); fflush(stdout);
-            // if (*pb >= SGL_CMD_MAX)
-            //    exit(1);
-            switch (*pb++) {
+            /*
+             * a command that claims more than is left of the submit
+             * takes the rest of the submit with it, nothing after it
+             * can be trusted to start where it's meant to
+             */
+            int *next = sgl_next_command(pb, end);
+            if (next == NULL) {
+                PRINT_LOG("dropping rest of submit from client %d at bad command header 0x%08x\n", client_id, *pb);
+                break;
+            }
+
+            cmd = SGL_CMD_OPCODE(*pb);
+            pb += SGL_CMD_LENGTH(*pb) == SGL_CMD_LENGTH_LONG ? 2 : 1;
+            // printf("[%-5d] command: %s (%d)\n", track++, sgl_cmd2str(cmd), cmd); fflush(stdout);
+            switch (cmd) {
             /*
              * Internal Implementation
              */
@@ -466,23 +1399,49 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             }
             case SGL_CMD_VP_UPLOAD: {
                 int vp_upload_count = *pb++;
+                if (!OPERANDS_FIT(vp_upload_count, sizeof(int)))
+                    break;
                 uploaded = pb;
+                uploaded_size = (size_t)(unsigned int)vp_upload_count * sizeof(int);
+                uploaded_stream = -1;
+                uploaded_entry = NULL;
                 for (int i = 0; i < vp_upload_count; i++)
                     pb++;
                 break;
             }
+            case SGL_CMD_VP_UPLOAD_PART: {
+                int total = *pb++,
+                    offset = *pb++,
+                    count = *pb++;
+                if (!OPERANDS_FIT(count, sizeof(int)))
+                    break;
+                uploaded = upload_part(ctx, total, offset, count, pb);
+                uploaded_size = uploaded ? (size_t)(unsigned int)total * sizeof(int) : 0;
+                uploaded_stream = -1;
+                uploaded_entry = NULL;
+                pb += count;
+                break;
+            }
             /* unused currently so no free */
             case SGL_CMD_VP_UPLOAD_STAY: {
                 int c = *pb++;
+                if (!OPERANDS_FIT(c, sizeof(int)))
+                    break;
                 void *res = pb;
                 for (int i = 0; i < c; i++)
                     pb++;
                 uploaded = calloc(c, sizeof(int));
                 memcpy(uploaded, res, c * sizeof(int));
+                uploaded_size = (size_t)c * sizeof(int);
+                uploaded_stream = -1;
+                uploaded_entry = NULL;
                 break;
             }
             case SGL_CMD_VP_NULL: {
                 uploaded = NULL;
+                uploaded_size = 0;
+                uploaded_stream = -1;
+                uploaded_entry = NULL;
                 break;
             }
             case SGL_CMD_VP_DOWNLOAD: {
@@ -491,6 +1450,148 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 download_offset += length;
                 break;
             }
+            case SGL_CMD_VP_DOWNLOAD_BULK: {
+                size_t length = (size_t)(unsigned int)*pb++,
+                       offset = (size_t)(unsigned int)*pb++;
+
+                /*
+                 * the client sends nothing to read when what it had
+                 * pending left no room in its ring
+                 */
+                if (length == 0)
+                    break;
+
+                /*
+                 * networking has no ring to write into, so the data
+                 * rides along with this submit's retval packet
+                 */
+                if (net_ctx != NULL) {
+                    if (net_readback_size + length > net_readback_capacity) {
+                        char *grown = realloc(net_readback, net_readback_size + length);
+                        if (grown == NULL) {
+                            PRINT_LOG("failed to allocate %zu bytes for network readback\n", net_readback_size + length);
+                            download_offset += length;
+                            break;
+                        }
+                        net_readback = grown;
+                        net_readback_capacity = net_readback_size + length;
+                    }
+                    memcpy(net_readback + net_readback_size, download_target + download_offset, length);
+                    net_readback_size += length;
+                }
+                else if (sgl_valid_readback(offset, length, submit_offset, submit_size, fifo_size)) {
+                    memcpy(ring_base + offset, download_target + download_offset, length);
+                }
+                else {
+                    PRINT_LOG("invalid bulk readback: offset=%zu length=%zu capacity=%zu client=%d\n",
+                        offset, length, fifo_size, client_id);
+                }
+
+                download_offset += length;
+                break;
+            }
+            case SGL_CMD_VP_CLEAR_ERROR:
+                if (ctx != NULL)
+                    ctx->error = GL_NO_ERROR;
+                break;
+            case SGL_CMD_VP_DRAW_IMMEDIATE: {
+                int mode = *pb++,
+                    count = *pb++,
+                    layout = *pb++;
+                sgl_draw_immediate(ctx, mode, count, layout, uploaded);
+                break;
+            }
+            case SGL_CMD_VP_CACHE_STORE:
+            case SGL_CMD_VP_CACHE_USE: {
+                int slot = *pb++;
+                struct sgl_upload_cache_entry *entry = NULL;
+
+                /*
+                 * a refused store leaves the upload as it was for the
+                 * draw that follows; the system copy is only kept if
+                 * the ring can't copy from the entry's buffer
+                 */
+                if (ctx != NULL && cmd == SGL_CMD_VP_CACHE_STORE) {
+                    bool keep_copy = !sgl_stream_fits(&ctx->stream, uploaded_size);
+                    entry = sgl_upload_cache_store(&ctx->upload_cache, slot, uploaded, uploaded_size, keep_copy);
+                    if (entry == NULL)
+                        break;
+                }
+                else if (ctx != NULL) {
+                    entry = sgl_upload_cache_get(&ctx->upload_cache, slot);
+                }
+
+                /*
+                 * arrays drawn from the slot point into its buffer,
+                 * at an offset from zero like they would the ring
+                 */
+                if (cmd == SGL_CMD_VP_CACHE_USE)
+                    uploaded = entry ? entry->data : NULL;
+                uploaded_size = entry ? entry->size : 0;
+                uploaded_entry = entry;
+                uploaded_stream = entry ? 0 : -1;
+                break;
+            }
+            case SGL_CMD_VP_BLOB_QUERY: {
+                struct sgl_blob_key key;
+                if (!OPERANDS_FIT(1, sizeof(key)))
+                    break;
+                memcpy(&key, pb, sizeof(key));
+                pb += SGL_BLOB_KEY_WORDS;
+
+                /*
+                 * copied out, another client's store could evict the
+                 * blob before this one's next submit uses it
+                 */
+                const void *blob = sgl_blob_find(&key);
+                void *copy = blob && ctx ? upload_buffer(ctx, key.size) : NULL;
+                if (copy != NULL) {
+                    memcpy(copy, blob, key.size);
+                    ctx->blob_found_size = key.size;
+                }
+
+                uploaded = copy;
+                uploaded_size = copy ? key.size : 0;
+                uploaded_stream = -1;
+                uploaded_entry = NULL;
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = copy != NULL;
+                break;
+            }
+            case SGL_CMD_VP_BLOB_STORE: {
+                struct sgl_blob_key key;
+                if (!OPERANDS_FIT(1, sizeof(key)))
+                    break;
+                memcpy(&key, pb, sizeof(key));
+                pb += SGL_BLOB_KEY_WORDS;
+                if (uploaded != NULL && uploaded_size >= key.size)
+                    sgl_blob_insert(&key, uploaded);
+                break;
+            }
+            case SGL_CMD_VP_SHADER_SOURCE_KEY: {
+                int shader = *pb++;
+                struct sgl_blob_key key;
+                if (!OPERANDS_FIT(1, sizeof(key)))
+                    break;
+                memcpy(&key, pb, sizeof(key));
+                pb += SGL_BLOB_KEY_WORDS;
+
+                const char *source = ctx ? sgl_blob_find(&key) : NULL;
+                if (source != NULL)
+                    sgl_set_shader_source(ctx, shader, &key, source);
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = source != NULL;
+                break;
+            }
+            case SGL_CMD_VP_CACHE_DROP: {
+                int count = *pb++;
+                if (!OPERANDS_FIT(count, sizeof(int)))
+                    break;
+                for (int i = 0; i < count; i++) {
+                    int slot = *pb++;
+                    if (ctx != NULL)
+                        sgl_upload_cache_drop(&ctx->upload_cache, slot);
+                }
+                break;
+            }
             
             /*
              * OpenGL Implementation
@@ -498,7 +1599,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             case SGL_CMD_ATTACHSHADER: {
                 int program = *pb++,
                     shader = *pb++;
-                glAttachShader(program, shader);
+                glAttachShader(sgl_shader_name(ctx, program), sgl_shader_name(ctx, shader));
                 break;
             }
             case SGL_CMD_BEGIN:
@@ -515,25 +1616,34 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int target = *pb++,
                     first = *pb++,
                     count = *pb++;
+                sgl_host_names(ctx, SGL_NAMESPACE_BUFFER, uploaded, count);
                 glBindBuffersBase(target, first, count, uploaded);
                 break;
             }
             case SGL_CMD_BINDBUFFER: {
                 int target = *pb++,
                     buffer = *pb++;
-                glBindBuffer(target, buffer);
+                sgl_bind_buffer(ctx, target, sgl_buffer_name(ctx, buffer));
                 break;
             }
             case SGL_CMD_BINDFRAGDATALOCATION: {
+                int *args = pb + 1;
                 int program = *pb++,
                     color = *pb++;
-                glBindFragDataLocation(program, color, (char*)pb);
-                ADVANCE_PAST_STRING();
+                char *name = read_string(&pb, next);
+                if (name == NULL)
+                    break;
+                sgl_note_link_state(ctx, program, args, pb);
+                glBindFragDataLocation(sgl_shader_name(ctx, program), color, name);
                 break;
             }
-            case SGL_CMD_BINDVERTEXARRAY:
-                glBindVertexArray(*pb++);
+            case SGL_CMD_BINDVERTEXARRAY: {
+                int array = *pb++;
+                if (ctx != NULL)
+                    ctx->vertex_array = array;
+                glBindVertexArray(array);
                 break;
+            }
             case SGL_CMD_BITMAP: {
                 int width = *pb++,
                     height = *pb++,
@@ -561,6 +1671,16 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             case SGL_CMD_CALLLIST:
                 glCallList(*pb++);
                 break;
+            case SGL_CMD_CALLLISTS: {
+                int n = *pb++,
+                    type = *pb++,
+                    words = *pb++;
+                if (!OPERANDS_FIT(words, sizeof(int)) || !OPERANDS_FIT(n, sgl_call_lists_type_size(type)))
+                    break;
+                glCallLists(n, type, pb);
+                pb += words;
+                break;
+            }
             case SGL_CMD_CLEAR:
                 glClear(*pb++);
                 break;
@@ -590,42 +1710,64 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_COMPILESHADER:
-                glCompileShader(*pb++);
+                sgl_defer_compile(ctx, *pb++);
                 break;
-            case SGL_CMD_CREATEPROGRAM:
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glCreateProgram();
+            case SGL_CMD_CREATEPROGRAM: {
+                int name = *pb++;
+                sgl_bind_name(ctx, SGL_NAMESPACE_SHADER, name, glCreateProgram());
                 break;
-            case SGL_CMD_CREATESHADER:
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glCreateShader(*pb++);
+            }
+            case SGL_CMD_CREATESHADER: {
+                int type = *pb++,
+                    name = *pb++;
+                sgl_bind_name(ctx, SGL_NAMESPACE_SHADER, name, glCreateShader(type));
                 break;
+            }
             case SGL_CMD_DELETEBUFFERS: {
-                unsigned int buffer = *pb++;
-                glDeleteBuffers(1, &buffer);
+                int n = *pb++;
+                if (!OPERANDS_FIT(n, sizeof(GLuint)))
+                    break;
+                sgl_forget_names(ctx, SGL_NAMESPACE_BUFFER, (GLuint*)pb, n);
+                sgl_unbind_deleted(ctx ? &ctx->array_buffer : NULL, (const GLuint*)pb, n);
+                glDeleteBuffers(n, (const GLuint*)pb);
+                pb += n;
                 break;
             }
             case SGL_CMD_DELETETEXTURES: {
-                unsigned int texture = *pb++;
-                glDeleteTextures(1, &texture);
+                int n = *pb++;
+                if (!OPERANDS_FIT(n, sizeof(GLuint)))
+                    break;
+                sgl_forget_names(ctx, SGL_NAMESPACE_TEXTURE, (GLuint*)pb, n);
+                glDeleteTextures(n, (const GLuint*)pb);
+                pb += n;
                 break;
             }
             case SGL_CMD_DELETEVERTEXARRAYS: {
-                unsigned int arrays = *pb++;
-                glDeleteVertexArrays(1, &arrays);
+                int n = *pb++;
+                if (!OPERANDS_FIT(n, sizeof(GLuint)))
+                    break;
+                sgl_unbind_deleted(ctx ? &ctx->vertex_array : NULL, (const GLuint*)pb, n);
+                glDeleteVertexArrays(n, (const GLuint*)pb);
+                pb += n;
                 break;
             }
             case SGL_CMD_DEPTHFUNC:
                 glDepthFunc(*pb++);
                 break;
+            /*
+             * shader objects keep their mapping once deleted, they live on
+             * while attached or in use and the client never reuses names
+             */
             case SGL_CMD_DELETEPROGRAM:
-                glDeleteProgram(*pb++);
+                glDeleteProgram(sgl_shader_name(ctx, *pb++));
                 break;
             case SGL_CMD_DELETESHADER:
-                glDeleteShader(*pb++);
+                glDeleteShader(sgl_shader_name(ctx, *pb++));
                 break;
             case SGL_CMD_DETACHSHADER: {
                 int program = *pb++,
                     shader = *pb++;
-                glDetachShader(program, shader);
+                glDetachShader(sgl_shader_name(ctx, program), sgl_shader_name(ctx, shader));
                 break;
             }
             case SGL_CMD_DISABLE:
@@ -642,7 +1784,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int mode = *pb++,
                     first = *pb++,
                     count = *pb++;
-                glDrawArrays(mode, first, count);
+                sgl_draw_arrays_run(&next, end, COALESCE_DRAWS, mode, first, count);
                 break;
             }
             case SGL_CMD_DRAWBUFFER:
@@ -654,7 +1796,13 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     type = *pb++;
                 int64_t index_ptr = pb_next_i64(&pb);
                 int use_upload = *pb++;
-                glDrawElements(mode, count, type, use_upload ? uploaded : (void*)(uintptr_t)index_ptr);
+                if (!use_upload) {
+                    sgl_draw_elements_run(&next, end, COALESCE_DRAWS, mode, type, count, (void*)(uintptr_t)index_ptr, 0);
+                    break;
+                }
+                sgl_stats.draws++;
+                glDrawElements(mode, count, type, UPLOAD_POINTER(0, GL_ELEMENT_ARRAY_BUFFER));
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
                 break;
             }
             case SGL_CMD_ENABLE:
@@ -684,36 +1832,41 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_GENBUFFERS: {
-                GLuint res = 0;
-                glGenBuffers(*pb++, &res);
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = res;
+                int n = *pb++;
+                download_offset = 0;
+                download_target = scratch_buffer_get(n * sizeof(GLuint));
+                glGenBuffers(n, download_target);
                 break;
             }
             case SGL_CMD_GENFRAMEBUFFERS: {
-                GLuint res = 0;
-                glGenFramebuffers(*pb++, &res);
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = res;
+                int n = *pb++;
+                download_offset = 0;
+                download_target = scratch_buffer_get(n * sizeof(GLuint));
+                glGenFramebuffers(n, download_target);
                 break;
             }
             case SGL_CMD_GENLISTS:
                 *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGenLists(*pb++);
                 break;
             case SGL_CMD_GENQUERIES: {
-                GLuint res = 0;
-                glGenQueries(*pb++, &res);
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = res;
+                int n = *pb++;
+                download_offset = 0;
+                download_target = scratch_buffer_get(n * sizeof(GLuint));
+                glGenQueries(n, download_target);
                 break;
             }
             case SGL_CMD_GENTEXTURES: {
-                GLuint res = 0;
-                glGenTextures(*pb++, &res);
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = res;
+                int n = *pb++;
+                download_offset = 0;
+                download_target = scratch_buffer_get(n * sizeof(GLuint));
+                glGenTextures(n, download_target);
                 break;
             }
             case SGL_CMD_GENVERTEXARRAYS: {
-                GLuint res = 0;
-                glGenVertexArrays(*pb++, &res);
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = res;
+                int n = *pb++;
+                download_offset = 0;
+                download_target = scratch_buffer_get(n * sizeof(GLuint));
+                glGenVertexArrays(n, download_target);
                 break;
             }
             case SGL_CMD_GETQUERYOBJECTUI64V: {
@@ -727,33 +1880,50 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             case SGL_CMD_GETPROGRAMIV: {
                 int program = *pb++,
                     pname = *pb++;
-                glGetProgramiv(program, pname, (int*)((char*)p + SGL_OFFSET_REGISTER_RETVAL));
+                glGetProgramiv(sgl_shader_name(ctx, program), pname, (int*)((char*)p + SGL_OFFSET_REGISTER_RETVAL));
                 break;
             }
             case SGL_CMD_GETSHADERIV: {
                 int shader = *pb++,
                     pname = *pb++;
-                glGetShaderiv(shader, pname, (int*)((char*)p + SGL_OFFSET_REGISTER_RETVAL));
+                struct sgl_shader_record *record = ctx ? sgl_shader_record_find(&ctx->shaders, shader) : NULL;
+
+                /*
+                 * a source that compiled before will again, which is
+                 * all most callers want to know
+                 */
+                if (pname == GL_COMPILE_STATUS && record != NULL && record->compile_pending &&
+                        sgl_program_cache_compiled(&record->key)) {
+                    *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = GL_TRUE;
+                    break;
+                }
+
+                if (pname == GL_COMPILE_STATUS || pname == GL_INFO_LOG_LENGTH)
+                    sgl_finish_compile(ctx, shader);
+                glGetShaderiv(sgl_shader_name(ctx, shader), pname, (int*)((char*)p + SGL_OFFSET_REGISTER_RETVAL));
                 break;
             }
             case SGL_CMD_GETOBJECTPARAMETERIVARB: {
                 int obj = *pb++,
                     pname = *pb++;
-                glGetObjectParameterivARB(obj, pname, (int*)((char*)p + SGL_OFFSET_REGISTER_RETVAL));
+                sgl_finish_compile(ctx, obj);
+                glGetObjectParameterivARB(sgl_shader_name(ctx, obj), pname, (int*)((char*)p + SGL_OFFSET_REGISTER_RETVAL));
                 break;
             }
             case SGL_CMD_GETUNIFORMLOCATION: {
                 int program = *pb++;
-                char *name = (char*)pb;
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetUniformLocation(program, name);
-                ADVANCE_PAST_STRING();
+                char *name = read_string(&pb, next);
+                if (name == NULL)
+                    break;
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetUniformLocation(sgl_shader_name(ctx, program), name);
                 break;
             }
             case SGL_CMD_GETATTRIBLOCATION: {
                 int program = *pb++;
-                char *name = (char*)pb;
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetAttribLocation(program, name);
-                ADVANCE_PAST_STRING();
+                char *name = read_string(&pb, next);
+                if (name == NULL)
+                    break;
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetAttribLocation(sgl_shader_name(ctx, program), name);
                 break;
             }
             case SGL_CMD_GETFLOATV: {
@@ -764,7 +1934,9 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             }
             case SGL_CMD_GETINTEGERV: {
                 int v[16];
-                glGetIntegerv(*pb++, v);
+                int pname = *pb++;
+                glGetIntegerv(pname, v);
+                sgl_client_binding(ctx, pname, v);
                 memcpy(p + SGL_OFFSET_REGISTER_RETVAL_V, v, sizeof(int) * 16);
                 break;
             }
@@ -813,7 +1985,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_LINKPROGRAM:
-                glLinkProgram(*pb++);
+                sgl_link_program(ctx, *pb++);
                 break;
             case SGL_CMD_LOADIDENTITY:
                 glLoadIdentity();
@@ -865,10 +2037,13 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             case SGL_CMD_SHADERSOURCE: {
                 int shader = *pb++,
                     count = *pb++;
+                if (!OPERANDS_FIT(count, sizeof(int)))
+                    break;
                 const char *strings[count];
                 int lengths[count];
-                read_counted_strings(&pb, count, strings, lengths);
-                glShaderSource(shader, count, strings, lengths);
+                if (!read_counted_strings(&pb, next, count, strings, lengths))
+                    break;
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = sgl_shader_source(ctx, shader, count, strings, lengths);
                 break;
             }
             case SGL_CMD_TEXIMAGE1D: {
@@ -965,7 +2140,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_USEPROGRAM:
-                glUseProgram(*pb++);
+                glUseProgram(sgl_shader_name(ctx, *pb++));
                 break;
             case SGL_CMD_VERTEX3F: {
                 float x = *((float*)pb++),
@@ -982,7 +2157,9 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     stride = *pb++;
                 int64_t ptr = pb_next_i64(&pb);
                 int use_upload = *pb++;
-                glVertexAttribPointer(index, size, type, normalized, stride, use_upload ? uploaded : (void*)(uintptr_t)ptr);
+                glVertexAttribPointer(index, size, type, normalized, stride, use_upload ? UPLOAD_POINTER(ptr, GL_ARRAY_BUFFER) : (void*)(uintptr_t)ptr);
+                if (use_upload)
+                    sgl_bind_buffer(ctx, GL_ARRAY_BUFFER, 0);
                 break;
             }
             case SGL_CMD_VIEWPORT: {
@@ -1018,7 +2195,9 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     stride = *pb++,
                     use_upload = *pb++;
                 int64_t offs = pb_next_i64(&pb);
-                glColorPointer(size, type, stride, use_upload ? uploaded : (const void*)(uintptr_t)offs);
+                glColorPointer(size, type, stride, use_upload ? UPLOAD_POINTER(offs, GL_ARRAY_BUFFER) : (const void*)(uintptr_t)offs);
+                if (use_upload)
+                    sgl_bind_buffer(ctx, GL_ARRAY_BUFFER, 0);
                 //// printf("glColorPointer(0x%x, 0x%x, %d, [%f, %f, %f, %f, %f, %f, ...]);\n", size, type, stride, ((float*)uploaded)[0], ((float*)uploaded)[1], ((float*)uploaded)[2], ((float*)uploaded)[3], ((float*)uploaded)[4], ((float*)uploaded)[5]);
                 break;
             }
@@ -1027,7 +2206,9 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     stride = *pb++,
                     use_upload = *pb++;
                 int64_t offs = pb_next_i64(&pb);
-                glNormalPointer(type, stride, use_upload ? uploaded : (const void*)(uintptr_t)offs);
+                glNormalPointer(type, stride, use_upload ? UPLOAD_POINTER(offs, GL_ARRAY_BUFFER) : (const void*)(uintptr_t)offs);
+                if (use_upload)
+                    sgl_bind_buffer(ctx, GL_ARRAY_BUFFER, 0);
                 //// printf("glNormalPointer(0x%x, %d, [%f, %f, %f, %f, %f, %f, ...]);\n", type, stride, ((float*)uploaded)[0], ((float*)uploaded)[1], ((float*)uploaded)[2], ((float*)uploaded)[3], ((float*)uploaded)[4], ((float*)uploaded)[5]);
                 break;
             }
@@ -1037,7 +2218,9 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     stride = *pb++,
                     use_upload = *pb++;
                 int64_t offs = pb_next_i64(&pb);
-                glTexCoordPointer(size, type, stride, use_upload ? uploaded : (const void*)(uintptr_t)offs);
+                glTexCoordPointer(size, type, stride, use_upload ? UPLOAD_POINTER(offs, GL_ARRAY_BUFFER) : (const void*)(uintptr_t)offs);
+                if (use_upload)
+                    sgl_bind_buffer(ctx, GL_ARRAY_BUFFER, 0);
                 //// printf("glTexCoordPointer(0x%x, 0x%x, %d, [%f, %f, %f, %f, %f, %f, ...]);\n", size, type, stride, ((float*)uploaded)[0], ((float*)uploaded)[1], ((float*)uploaded)[2], ((float*)uploaded)[3], ((float*)uploaded)[4], ((float*)uploaded)[5]);
                 break;
             }
@@ -1047,7 +2230,9 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     stride = *pb++,
                     use_upload = *pb++;
                 int64_t offs = pb_next_i64(&pb);
-                glVertexPointer(size, type, stride, use_upload ? uploaded : (const void*)(uintptr_t)offs);
+                glVertexPointer(size, type, stride, use_upload ? UPLOAD_POINTER(offs, GL_ARRAY_BUFFER) : (const void*)(uintptr_t)offs);
+                if (use_upload)
+                    sgl_bind_buffer(ctx, GL_ARRAY_BUFFER, 0);
                 //// printf("glVertexPointer(0x%x, 0x%x, %d, [%f, %f, %f, %f, %f, %f, ...]);\n", size, type, stride, ((float*)uploaded)[0], ((float*)uploaded)[1], ((float*)uploaded)[2], ((float*)uploaded)[3], ((float*)uploaded)[4], ((float*)uploaded)[5]);
                 break;
             }
@@ -1178,6 +2363,30 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 glReadBuffer(src);
                 break;
             }
+            case SGL_CMD_READPIXELS: {
+                int x = *pb++,
+                    y = *pb++,
+                    width = *pb++,
+                    height = *pb++,
+                    format = *pb++,
+                    type = *pb++,
+                    to_pack_buffer = *pb++,
+                    size = *pb++;
+
+                /*
+                 * a bound pack buffer keeps the copy on the host, and
+                 * `size` is the offset into it
+                 */
+                if (to_pack_buffer) {
+                    glReadPixels(x, y, width, height, format, type, (void*)(uintptr_t)(unsigned int)size);
+                    break;
+                }
+
+                download_offset = 0;
+                download_target = scratch_buffer_get(size);
+                glReadPixels(x, y, width, height, format, type, download_target);
+                break;
+            }
             case SGL_CMD_ISENABLED: {
                 int cap = *pb++;
                 glIsEnabled(cap);
@@ -2062,12 +3271,12 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             case SGL_CMD_BINDTEXTURE: {
                 int target = *pb++;
                 int texture = *pb++;
-                glBindTexture(target, texture);
+                glBindTexture(target, sgl_texture_name(ctx, texture));
                 break;
             }
             case SGL_CMD_ISTEXTURE: {
                 int texture = *pb++;
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glIsTexture(texture);
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glIsTexture(sgl_existing_name(ctx, SGL_NAMESPACE_TEXTURE, texture));
                 break;
             }
             case SGL_CMD_ARRAYELEMENT: {
@@ -2091,6 +3300,8 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_POPCLIENTATTRIB: {
+                if (ctx != NULL)
+                    ctx->bindings_known = false;
                 glPopClientAttrib();
                 break;
             }
@@ -2125,6 +3336,8 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             }
             case SGL_CMD_CLIENTACTIVETEXTURE: {
                 int texture = *pb++;
+                if (ctx != NULL)
+                    ctx->client_active_texture = texture;
                 glClientActiveTexture(texture);
                 break;
             }
@@ -2406,7 +3619,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             }
             case SGL_CMD_ISBUFFER: {
                 int buffer = *pb++;
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glIsBuffer(buffer);
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glIsBuffer(sgl_existing_name(ctx, SGL_NAMESPACE_BUFFER, buffer));
                 break;
             }
             case SGL_CMD_UNMAPBUFFER: {
@@ -2451,12 +3664,12 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             }
             case SGL_CMD_ISPROGRAM: {
                 int program = *pb++;
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glIsProgram(program);
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glIsProgram(sgl_existing_name(ctx, SGL_NAMESPACE_SHADER, program));
                 break;
             }
             case SGL_CMD_ISSHADER: {
                 int shader = *pb++;
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glIsShader(shader);
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glIsShader(sgl_existing_name(ctx, SGL_NAMESPACE_SHADER, shader));
                 break;
             }
             case SGL_CMD_UNIFORM2F: {
@@ -2515,7 +3728,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             }
             case SGL_CMD_VALIDATEPROGRAM: {
                 int program = *pb++;
-                glValidateProgram(program);
+                glValidateProgram(sgl_shader_name(ctx, program));
                 break;
             }
             case SGL_CMD_VERTEXATTRIB1D: {
@@ -2659,14 +3872,14 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int buffer = *pb++;
                 int offset = *pb++;
                 int size = *pb++;
-                glBindBufferRange(target, index, buffer, offset, size);
+                glBindBufferRange(target, index, sgl_buffer_name(ctx, buffer), offset, size);
                 break;
             }
             case SGL_CMD_BINDBUFFERBASE: {
                 int target = *pb++;
                 int index = *pb++;
                 int buffer = *pb++;
-                glBindBufferBase(target, index, buffer);
+                glBindBufferBase(target, index, sgl_buffer_name(ctx, buffer));
                 break;
             }
             case SGL_CMD_CLAMPCOLOR: {
@@ -2824,7 +4037,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int textarget = *pb++;
                 int texture = *pb++;
                 int level = *pb++;
-                glFramebufferTexture1D(target, attachment, textarget, texture, level);
+                glFramebufferTexture1D(target, attachment, textarget, sgl_texture_name(ctx, texture), level);
                 break;
             }
             case SGL_CMD_FRAMEBUFFERTEXTURE2D: {
@@ -2833,7 +4046,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int textarget = *pb++;
                 int texture = *pb++;
                 int level = *pb++;
-                glFramebufferTexture2D(target, attachment, textarget, texture, level);
+                glFramebufferTexture2D(target, attachment, textarget, sgl_texture_name(ctx, texture), level);
                 break;
             }
             case SGL_CMD_FRAMEBUFFERTEXTURE3D: {
@@ -2843,7 +4056,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int texture = *pb++;
                 int level = *pb++;
                 int zoffset = *pb++;
-                glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+                glFramebufferTexture3D(target, attachment, textarget, sgl_texture_name(ctx, texture), level, zoffset);
                 break;
             }
             case SGL_CMD_FRAMEBUFFERRENDERBUFFER: {
@@ -2888,7 +4101,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int texture = *pb++;
                 int level = *pb++;
                 int layer = *pb++;
-                glFramebufferTextureLayer(target, attachment, texture, level, layer);
+                glFramebufferTextureLayer(target, attachment, sgl_texture_name(ctx, texture), level, layer);
                 break;
             }
             case SGL_CMD_FLUSHMAPPEDBUFFERRANGE: {
@@ -2916,7 +4129,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int target = *pb++;
                 int internalformat = *pb++;
                 int buffer = *pb++;
-                glTexBuffer(target, internalformat, buffer);
+                glTexBuffer(target, internalformat, sgl_buffer_name(ctx, buffer));
                 break;
             }
             case SGL_CMD_PRIMITIVERESTARTINDEX: {
@@ -2937,7 +4150,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int program = *pb++;
                 int uniformBlockIndex = *pb++;
                 int uniformBlockBinding = *pb++;
-                glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+                glUniformBlockBinding(sgl_shader_name(ctx, program), uniformBlockIndex, uniformBlockBinding);
                 break;
             }
             case SGL_CMD_PROVOKINGVERTEX: {
@@ -2950,7 +4163,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int attachment = *pb++;
                 int texture = *pb++;
                 int level = *pb++;
-                glFramebufferTexture(target, attachment, texture, level);
+                glFramebufferTexture(target, attachment, sgl_texture_name(ctx, texture), level);
                 break;
             }
             case SGL_CMD_TEXIMAGE2DMULTISAMPLE: {
@@ -3277,20 +4490,21 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int program = *pb++;
                 int pname = *pb++;
                 int value = *pb++;
-                glProgramParameteri(program, pname, value);
+                sgl_note_link_state(ctx, program, pb - 2, pb);
+                glProgramParameteri(sgl_shader_name(ctx, program), pname, value);
                 break;
             }
             case SGL_CMD_USEPROGRAMSTAGES: {
                 int pipeline = *pb++;
                 int stages = *pb++;
                 int program = *pb++;
-                glUseProgramStages(pipeline, stages, program);
+                glUseProgramStages(pipeline, stages, sgl_shader_name(ctx, program));
                 break;
             }
             case SGL_CMD_ACTIVESHADERPROGRAM: {
                 int pipeline = *pb++;
                 int program = *pb++;
-                glActiveShaderProgram(pipeline, program);
+                glActiveShaderProgram(pipeline, sgl_shader_name(ctx, program));
                 break;
             }
             case SGL_CMD_BINDPROGRAMPIPELINE: {
@@ -3307,28 +4521,28 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int program = *pb++;
                 int location = *pb++;
                 int v0 = *pb++;
-                glProgramUniform1i(program, location, v0);
+                glProgramUniform1i(sgl_shader_name(ctx, program), location, v0);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM1F: {
                 int program = *pb++;
                 int location = *pb++;
                 float v0 = *((float*)pb++);
-                glProgramUniform1f(program, location, v0);
+                glProgramUniform1f(sgl_shader_name(ctx, program), location, v0);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM1D: {
                 int program = *pb++;
                 int location = *pb++;
                 float v0 = *((float*)pb++);
-                glProgramUniform1d(program, location, v0);
+                glProgramUniform1d(sgl_shader_name(ctx, program), location, v0);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM1UI: {
                 int program = *pb++;
                 int location = *pb++;
                 int v0 = *pb++;
-                glProgramUniform1ui(program, location, v0);
+                glProgramUniform1ui(sgl_shader_name(ctx, program), location, v0);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM2I: {
@@ -3336,7 +4550,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int location = *pb++;
                 int v0 = *pb++;
                 int v1 = *pb++;
-                glProgramUniform2i(program, location, v0, v1);
+                glProgramUniform2i(sgl_shader_name(ctx, program), location, v0, v1);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM2F: {
@@ -3344,7 +4558,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int location = *pb++;
                 float v0 = *((float*)pb++);
                 float v1 = *((float*)pb++);
-                glProgramUniform2f(program, location, v0, v1);
+                glProgramUniform2f(sgl_shader_name(ctx, program), location, v0, v1);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM2D: {
@@ -3352,7 +4566,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int location = *pb++;
                 float v0 = *((float*)pb++);
                 float v1 = *((float*)pb++);
-                glProgramUniform2d(program, location, v0, v1);
+                glProgramUniform2d(sgl_shader_name(ctx, program), location, v0, v1);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM2UI: {
@@ -3360,7 +4574,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int location = *pb++;
                 int v0 = *pb++;
                 int v1 = *pb++;
-                glProgramUniform2ui(program, location, v0, v1);
+                glProgramUniform2ui(sgl_shader_name(ctx, program), location, v0, v1);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM3I: {
@@ -3369,7 +4583,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int v0 = *pb++;
                 int v1 = *pb++;
                 int v2 = *pb++;
-                glProgramUniform3i(program, location, v0, v1, v2);
+                glProgramUniform3i(sgl_shader_name(ctx, program), location, v0, v1, v2);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM3F: {
@@ -3378,7 +4592,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 float v0 = *((float*)pb++);
                 float v1 = *((float*)pb++);
                 float v2 = *((float*)pb++);
-                glProgramUniform3f(program, location, v0, v1, v2);
+                glProgramUniform3f(sgl_shader_name(ctx, program), location, v0, v1, v2);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM3D: {
@@ -3387,7 +4601,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 float v0 = *((float*)pb++);
                 float v1 = *((float*)pb++);
                 float v2 = *((float*)pb++);
-                glProgramUniform3d(program, location, v0, v1, v2);
+                glProgramUniform3d(sgl_shader_name(ctx, program), location, v0, v1, v2);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM3UI: {
@@ -3396,7 +4610,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int v0 = *pb++;
                 int v1 = *pb++;
                 int v2 = *pb++;
-                glProgramUniform3ui(program, location, v0, v1, v2);
+                glProgramUniform3ui(sgl_shader_name(ctx, program), location, v0, v1, v2);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM4I: {
@@ -3406,7 +4620,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int v1 = *pb++;
                 int v2 = *pb++;
                 int v3 = *pb++;
-                glProgramUniform4i(program, location, v0, v1, v2, v3);
+                glProgramUniform4i(sgl_shader_name(ctx, program), location, v0, v1, v2, v3);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM4F: {
@@ -3416,7 +4630,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 float v1 = *((float*)pb++);
                 float v2 = *((float*)pb++);
                 float v3 = *((float*)pb++);
-                glProgramUniform4f(program, location, v0, v1, v2, v3);
+                glProgramUniform4f(sgl_shader_name(ctx, program), location, v0, v1, v2, v3);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM4D: {
@@ -3426,7 +4640,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 float v1 = *((float*)pb++);
                 float v2 = *((float*)pb++);
                 float v3 = *((float*)pb++);
-                glProgramUniform4d(program, location, v0, v1, v2, v3);
+                glProgramUniform4d(sgl_shader_name(ctx, program), location, v0, v1, v2, v3);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORM4UI: {
@@ -3436,7 +4650,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int v1 = *pb++;
                 int v2 = *pb++;
                 int v3 = *pb++;
-                glProgramUniform4ui(program, location, v0, v1, v2, v3);
+                glProgramUniform4ui(sgl_shader_name(ctx, program), location, v0, v1, v2, v3);
                 break;
             }
             case SGL_CMD_VALIDATEPROGRAMPIPELINE: {
@@ -3514,7 +4728,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int layer = *pb++;
                 int access = *pb++;
                 int format = *pb++;
-                glBindImageTexture(unit, texture, level, layered, layer, access, format);
+                glBindImageTexture(unit, sgl_texture_name(ctx, texture), level, layered, layer, access, format);
                 break;
             }
             case SGL_CMD_MEMORYBARRIER: {
@@ -3585,6 +4799,10 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int srcWidth = *pb++;
                 int srcHeight = *pb++;
                 int srcDepth = *pb++;
+                if (srcTarget != GL_RENDERBUFFER)
+                    srcName = sgl_texture_name(ctx, srcName);
+                if (dstTarget != GL_RENDERBUFFER)
+                    dstName = sgl_texture_name(ctx, dstName);
                 glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
                 break;
             }
@@ -3604,32 +4822,32 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int width = *pb++;
                 int height = *pb++;
                 int depth = *pb++;
-                glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+                glInvalidateTexSubImage(sgl_texture_name(ctx, texture), level, xoffset, yoffset, zoffset, width, height, depth);
                 break;
             }
             case SGL_CMD_INVALIDATETEXIMAGE: {
                 int texture = *pb++;
                 int level = *pb++;
-                glInvalidateTexImage(texture, level);
+                glInvalidateTexImage(sgl_texture_name(ctx, texture), level);
                 break;
             }
             case SGL_CMD_INVALIDATEBUFFERSUBDATA: {
                 int buffer = *pb++;
                 int offset = *pb++;
                 int length = *pb++;
-                glInvalidateBufferSubData(buffer, offset, length);
+                glInvalidateBufferSubData(sgl_buffer_name(ctx, buffer), offset, length);
                 break;
             }
             case SGL_CMD_INVALIDATEBUFFERDATA: {
                 int buffer = *pb++;
-                glInvalidateBufferData(buffer);
+                glInvalidateBufferData(sgl_buffer_name(ctx, buffer));
                 break;
             }
             case SGL_CMD_SHADERSTORAGEBLOCKBINDING: {
                 int program = *pb++;
                 int storageBlockIndex = *pb++;
                 int storageBlockBinding = *pb++;
-                glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+                glShaderStorageBlockBinding(sgl_shader_name(ctx, program), storageBlockIndex, storageBlockBinding);
                 break;
             }
             case SGL_CMD_TEXBUFFERRANGE: {
@@ -3638,7 +4856,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int buffer = *pb++;
                 int offset = *pb++;
                 int size = *pb++;
-                glTexBufferRange(target, internalformat, buffer, offset, size);
+                glTexBufferRange(target, internalformat, sgl_buffer_name(ctx, buffer), offset, size);
                 break;
             }
             case SGL_CMD_TEXSTORAGE2DMULTISAMPLE: {
@@ -3671,7 +4889,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int numlevels = *pb++;
                 int minlayer = *pb++;
                 int numlayers = *pb++;
-                glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+                glTextureView(sgl_texture_name(ctx, texture), target, sgl_texture_name(ctx, origtexture), internalformat, minlevel, numlevels, minlayer, numlayers);
                 break;
             }
             case SGL_CMD_BINDVERTEXBUFFER: {
@@ -3679,7 +4897,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int buffer = *pb++;
                 int64_t offset = pb_next_i64(&pb);
                 int stride = *pb++;
-                glBindVertexBuffer(bindingindex, buffer, offset, stride);
+                glBindVertexBuffer(bindingindex, sgl_buffer_name(ctx, buffer), offset, stride);
                 break;
             }
             case SGL_CMD_VERTEXATTRIBFORMAT: {
@@ -3733,7 +4951,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int xfb = *pb++;
                 int index = *pb++;
                 int buffer = *pb++;
-                glTransformFeedbackBufferBase(xfb, index, buffer);
+                glTransformFeedbackBufferBase(xfb, index, sgl_buffer_name(ctx, buffer));
                 break;
             }
             case SGL_CMD_TRANSFORMFEEDBACKBUFFERRANGE: {
@@ -3742,7 +4960,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int buffer = *pb++;
                 int offset = *pb++;
                 int size = *pb++;
-                glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+                glTransformFeedbackBufferRange(xfb, index, sgl_buffer_name(ctx, buffer), offset, size);
                 break;
             }
             case SGL_CMD_COPYNAMEDBUFFERSUBDATA: {
@@ -3751,14 +4969,14 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int readOffset = *pb++;
                 int writeOffset = *pb++;
                 int size = *pb++;
-                glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+                glCopyNamedBufferSubData(sgl_buffer_name(ctx, readBuffer), sgl_buffer_name(ctx, writeBuffer), readOffset, writeOffset, size);
                 break;
             }
             case SGL_CMD_UNMAPNAMEDBUFFER: {
                 int buffer = *pb++;
                 int length = *pb++;
                 memcpy(map_buffer, uploaded, length);
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glUnmapNamedBuffer(buffer);
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glUnmapNamedBuffer(sgl_buffer_name(ctx, buffer));
                 break;
             }
             case SGL_CMD_FLUSHMAPPEDNAMEDBUFFERRANGE: {
@@ -3766,7 +4984,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int offset = *pb++;
                 int length = *pb++;
                 memcpy(map_buffer + offset, uploaded, length);
-                glFlushMappedNamedBufferRange(buffer, offset, length);
+                glFlushMappedNamedBufferRange(sgl_buffer_name(ctx, buffer), offset, length);
                 break;
             }
             case SGL_CMD_NAMEDFRAMEBUFFERRENDERBUFFER: {
@@ -3789,7 +5007,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int attachment = *pb++;
                 int texture = *pb++;
                 int level = *pb++;
-                glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+                glNamedFramebufferTexture(framebuffer, attachment, sgl_texture_name(ctx, texture), level);
                 break;
             }
             case SGL_CMD_NAMEDFRAMEBUFFERTEXTURELAYER: {
@@ -3798,7 +5016,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int texture = *pb++;
                 int level = *pb++;
                 int layer = *pb++;
-                glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+                glNamedFramebufferTextureLayer(framebuffer, attachment, sgl_texture_name(ctx, texture), level, layer);
                 break;
             }
             case SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFER: {
@@ -3865,7 +5083,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int texture = *pb++;
                 int internalformat = *pb++;
                 int buffer = *pb++;
-                glTextureBuffer(texture, internalformat, buffer);
+                glTextureBuffer(sgl_texture_name(ctx, texture), internalformat, sgl_buffer_name(ctx, buffer));
                 break;
             }
             case SGL_CMD_TEXTUREBUFFERRANGE: {
@@ -3874,7 +5092,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int buffer = *pb++;
                 int offset = *pb++;
                 int size = *pb++;
-                glTextureBufferRange(texture, internalformat, buffer, offset, size);
+                glTextureBufferRange(sgl_texture_name(ctx, texture), internalformat, sgl_buffer_name(ctx, buffer), offset, size);
                 break;
             }
             case SGL_CMD_TEXTURESTORAGE1D: {
@@ -3882,7 +5100,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int levels = *pb++;
                 int internalformat = *pb++;
                 int width = *pb++;
-                glTextureStorage1D(texture, levels, internalformat, width);
+                glTextureStorage1D(sgl_texture_name(ctx, texture), levels, internalformat, width);
                 break;
             }
             case SGL_CMD_TEXTURESTORAGE2D: {
@@ -3891,7 +5109,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int internalformat = *pb++;
                 int width = *pb++;
                 int height = *pb++;
-                glTextureStorage2D(texture, levels, internalformat, width, height);
+                glTextureStorage2D(sgl_texture_name(ctx, texture), levels, internalformat, width, height);
                 break;
             }
             case SGL_CMD_TEXTURESTORAGE3D: {
@@ -3901,7 +5119,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int width = *pb++;
                 int height = *pb++;
                 int depth = *pb++;
-                glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+                glTextureStorage3D(sgl_texture_name(ctx, texture), levels, internalformat, width, height, depth);
                 break;
             }
             case SGL_CMD_TEXTURESTORAGE2DMULTISAMPLE: {
@@ -3911,7 +5129,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int width = *pb++;
                 int height = *pb++;
                 int fixedsamplelocations = *pb++;
-                glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+                glTextureStorage2DMultisample(sgl_texture_name(ctx, texture), samples, internalformat, width, height, fixedsamplelocations);
                 break;
             }
             case SGL_CMD_TEXTURESTORAGE3DMULTISAMPLE: {
@@ -3922,7 +5140,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int height = *pb++;
                 int depth = *pb++;
                 int fixedsamplelocations = *pb++;
-                glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+                glTextureStorage3DMultisample(sgl_texture_name(ctx, texture), samples, internalformat, width, height, depth, fixedsamplelocations);
                 break;
             }
             case SGL_CMD_COPYTEXTURESUBIMAGE1D: {
@@ -3932,7 +5150,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int x = *pb++;
                 int y = *pb++;
                 int width = *pb++;
-                glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+                glCopyTextureSubImage1D(sgl_texture_name(ctx, texture), level, xoffset, x, y, width);
                 break;
             }
             case SGL_CMD_COPYTEXTURESUBIMAGE2D: {
@@ -3944,7 +5162,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int y = *pb++;
                 int width = *pb++;
                 int height = *pb++;
-                glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+                glCopyTextureSubImage2D(sgl_texture_name(ctx, texture), level, xoffset, yoffset, x, y, width, height);
                 break;
             }
             case SGL_CMD_COPYTEXTURESUBIMAGE3D: {
@@ -3957,32 +5175,32 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int y = *pb++;
                 int width = *pb++;
                 int height = *pb++;
-                glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+                glCopyTextureSubImage3D(sgl_texture_name(ctx, texture), level, xoffset, yoffset, zoffset, x, y, width, height);
                 break;
             }
             case SGL_CMD_TEXTUREPARAMETERF: {
                 int texture = *pb++;
                 int pname = *pb++;
                 float param = *((float*)pb++);
-                glTextureParameterf(texture, pname, param);
+                glTextureParameterf(sgl_texture_name(ctx, texture), pname, param);
                 break;
             }
             case SGL_CMD_TEXTUREPARAMETERI: {
                 int texture = *pb++;
                 int pname = *pb++;
                 int param = *pb++;
-                glTextureParameteri(texture, pname, param);
+                glTextureParameteri(sgl_texture_name(ctx, texture), pname, param);
                 break;
             }
             case SGL_CMD_GENERATETEXTUREMIPMAP: {
                 int texture = *pb++;
-                glGenerateTextureMipmap(texture);
+                glGenerateTextureMipmap(sgl_texture_name(ctx, texture));
                 break;
             }
             case SGL_CMD_BINDTEXTUREUNIT: {
                 int unit = *pb++;
                 int texture = *pb++;
-                glBindTextureUnit(unit, texture);
+                glBindTextureUnit(unit, sgl_texture_name(ctx, texture));
                 break;
             }
             case SGL_CMD_DISABLEVERTEXARRAYATTRIB: {
@@ -4000,7 +5218,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             case SGL_CMD_VERTEXARRAYELEMENTBUFFER: {
                 int vaobj = *pb++;
                 int buffer = *pb++;
-                glVertexArrayElementBuffer(vaobj, buffer);
+                glVertexArrayElementBuffer(vaobj, sgl_buffer_name(ctx, buffer));
                 break;
             }
             case SGL_CMD_VERTEXARRAYVERTEXBUFFER: {
@@ -4009,7 +5227,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int buffer = *pb++;
                 int64_t offset = pb_next_i64(&pb);
                 int stride = *pb++;
-                glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+                glVertexArrayVertexBuffer(vaobj, bindingindex, sgl_buffer_name(ctx, buffer), offset, stride);
                 break;
             }
             case SGL_CMD_VERTEXARRAYATTRIBBINDING: {
@@ -4059,7 +5277,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int buffer = *pb++;
                 int pname = *pb++;
                 int offset = *pb++;
-                glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+                glGetQueryBufferObjecti64v(id, sgl_buffer_name(ctx, buffer), pname, offset);
                 break;
             }
             case SGL_CMD_GETQUERYBUFFEROBJECTIV: {
@@ -4067,7 +5285,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int buffer = *pb++;
                 int pname = *pb++;
                 int offset = *pb++;
-                glGetQueryBufferObjectiv(id, buffer, pname, offset);
+                glGetQueryBufferObjectiv(id, sgl_buffer_name(ctx, buffer), pname, offset);
                 break;
             }
             case SGL_CMD_GETQUERYBUFFEROBJECTUI64V: {
@@ -4075,7 +5293,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int buffer = *pb++;
                 int pname = *pb++;
                 int offset = *pb++;
-                glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+                glGetQueryBufferObjectui64v(id, sgl_buffer_name(ctx, buffer), pname, offset);
                 break;
             }
             case SGL_CMD_GETQUERYBUFFEROBJECTUIV: {
@@ -4083,7 +5301,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int buffer = *pb++;
                 int pname = *pb++;
                 int offset = *pb++;
-                glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+                glGetQueryBufferObjectuiv(id, sgl_buffer_name(ctx, buffer), pname, offset);
                 break;
             }
             case SGL_CMD_MEMORYBARRIERBYREGION: {
@@ -4170,14 +5388,14 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_ARETEXTURESRESIDENT: {
-                unsigned int tex = *pb++;
+                unsigned int tex = sgl_texture_name(ctx, *pb++);
                 GLboolean res;
                 glAreTexturesResident(1, &tex, &res);
                 *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = res;
                 break;
             }
             case SGL_CMD_PRIORITIZETEXTURES: {
-                unsigned int tex = *pb++;
+                unsigned int tex = sgl_texture_name(ctx, *pb++);
                 float priority = *((float*)pb++);
                 glPrioritizeTextures(1, &tex, &priority);
                 break;
@@ -4270,8 +5488,11 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_DELETEQUERIES: {
-                unsigned int id = *pb++;
-                glDeleteQueries(1, &id);
+                int n = *pb++;
+                if (!OPERANDS_FIT(n, sizeof(GLuint)))
+                    break;
+                glDeleteQueries(n, (const GLuint*)pb);
+                pb += n;
                 break;
             }
             case SGL_CMD_GETQUERYIV: {
@@ -4305,6 +5526,15 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 glBufferSubData(target, offset, size, uploaded);
                 break;
             }
+            case SGL_CMD_GETBUFFERSUBDATA: {
+                int target = *pb++,
+                    offset = *pb++,
+                    size = *pb++;
+                download_offset = 0;
+                download_target = scratch_buffer_get(size);
+                glGetBufferSubData(target, offset, size, download_target);
+                break;
+            }
             case SGL_CMD_BUFFERSUBDATAARB: {
                 int target = *pb++,
                     offset = *pb++,
@@ -4411,11 +5641,14 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_BINDATTRIBLOCATION: {
+                int *args = pb + 1;
                 int program = *pb++,
                     index = *pb++;
-                char *name = (char*)pb;
-                glBindAttribLocation(program, index, name);
-                ADVANCE_PAST_STRING();
+                char *name = read_string(&pb, next);
+                if (name == NULL)
+                    break;
+                sgl_note_link_state(ctx, program, args, pb);
+                glBindAttribLocation(sgl_shader_name(ctx, program), index, name);
                 break;
             }
             case SGL_CMD_GETACTIVEATTRIB: {
@@ -4423,7 +5656,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     index = *pb++,
                     bufSize = *pb++;
                 glGetActiveAttrib(
-                    program,
+                    sgl_shader_name(ctx, program),
                     index,
                     bufSize,
                     p + SGL_OFFSET_REGISTER_RETVAL_V,
@@ -4438,7 +5671,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     index = *pb++,
                     bufSize = *pb++;
                 glGetActiveUniform(
-                    program,
+                    sgl_shader_name(ctx, program),
                     index,
                     bufSize,
                     p + SGL_OFFSET_REGISTER_RETVAL_V,
@@ -4451,41 +5684,46 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             case SGL_CMD_GETATTACHEDSHADERS: {
                 int program = *pb++,
                     maxCount = *pb++;
-                glGetAttachedShaders(program, maxCount,  p + SGL_OFFSET_REGISTER_RETVAL_V,
+                glGetAttachedShaders(sgl_shader_name(ctx, program), maxCount,  p + SGL_OFFSET_REGISTER_RETVAL_V,
                     p + SGL_OFFSET_REGISTER_RETVAL_V + sizeof(GLsizei));
+                GLsizei count = *(GLsizei*)(p + SGL_OFFSET_REGISTER_RETVAL_V);
+                GLuint *shaders = (GLuint*)(p + SGL_OFFSET_REGISTER_RETVAL_V + sizeof(GLsizei));
+                for (int i = 0; i < count; i++)
+                    shaders[i] = sgl_client_name(ctx, SGL_NAMESPACE_SHADER, shaders[i]);
                 break;
             }
             case SGL_CMD_GETPROGRAMINFOLOG: {
                 int program = *pb++,
                     bufSize = *pb++;
-                glGetProgramInfoLog(program, bufSize,  p + SGL_OFFSET_REGISTER_RETVAL_V,
+                glGetProgramInfoLog(sgl_shader_name(ctx, program), bufSize,  p + SGL_OFFSET_REGISTER_RETVAL_V,
                     p + SGL_OFFSET_REGISTER_RETVAL_V + sizeof(GLsizei));
                 break;
             }
             case SGL_CMD_GETSHADERINFOLOG: {
                 int program = *pb++,
                     bufSize = *pb++;
-                glGetShaderInfoLog(program, bufSize,  p + SGL_OFFSET_REGISTER_RETVAL_V,
+                sgl_finish_compile(ctx, program);
+                glGetShaderInfoLog(sgl_shader_name(ctx, program), bufSize,  p + SGL_OFFSET_REGISTER_RETVAL_V,
                     p + SGL_OFFSET_REGISTER_RETVAL_V + sizeof(GLsizei));
                 break;
             }
             case SGL_CMD_GETSHADERSOURCE: {
                 int shader = *pb++,
                     bufSize = *pb++;
-                glGetShaderSource(shader, bufSize,  p + SGL_OFFSET_REGISTER_RETVAL_V,
+                glGetShaderSource(sgl_shader_name(ctx, shader), bufSize,  p + SGL_OFFSET_REGISTER_RETVAL_V,
                     p + SGL_OFFSET_REGISTER_RETVAL_V + sizeof(GLsizei));
                 break;
             }
             case SGL_CMD_GETUNIFORMFV: {
                 int program = *pb++,
                     location = *pb++;
-                glGetUniformfv(program, location, p + SGL_OFFSET_REGISTER_RETVAL);
+                glGetUniformfv(sgl_shader_name(ctx, program), location, p + SGL_OFFSET_REGISTER_RETVAL);
                 break;
             }
             case SGL_CMD_GETUNIFORMIV: {
                 int program = *pb++,
                     location = *pb++;
-                glGetUniformiv(program, location, p + SGL_OFFSET_REGISTER_RETVAL);
+                glGetUniformiv(sgl_shader_name(ctx, program), location, p + SGL_OFFSET_REGISTER_RETVAL);
                 break;
             }
             case SGL_CMD_GETVERTEXATTRIBDV: {
@@ -4504,6 +5742,8 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int index = *pb++,
                     pname = *pb++;
                 glGetVertexAttribiv(index, pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
+                if (pname == GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING)
+                    *(int*)(p + SGL_OFFSET_REGISTER_RETVAL_V) = sgl_client_name(ctx, SGL_NAMESPACE_BUFFER, *(int*)(p + SGL_OFFSET_REGISTER_RETVAL_V));
                 break;
             }
             case SGL_CMD_UNIFORMMATRIX2FV: {
@@ -4702,23 +5942,32 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int target = *pb++,
                     index = *pb++;
                 glGetIntegeri_v(target, index, v);
+                sgl_client_binding(ctx, target, v);
                 memcpy(p + SGL_OFFSET_REGISTER_RETVAL_V, v, sizeof(int) * 16);
                 break;
             }
             case SGL_CMD_TRANSFORMFEEDBACKVARYINGS: {
+                int *args = pb + 1;
                 int program = *pb++,
                     count = *pb++;
-                char *string = (char*)pb;
-                ADVANCE_PAST_STRING();
+                if (!OPERANDS_FIT(count, sizeof(int)))
+                    break;
+                const char *varyings[count];
+                int i = 0;
+                while (i < count && (varyings[i] = read_string(&pb, next)) != NULL)
+                    i++;
+                if (i < count || !OPERANDS_FIT(1, sizeof(int)))
+                    break;
                 int bufferMode = *pb++;
-                glTransformFeedbackVaryings(program, count, (const char* const*)&string, bufferMode);
+                sgl_note_link_state(ctx, program, args, pb);
+                glTransformFeedbackVaryings(sgl_shader_name(ctx, program), count, varyings, bufferMode);
                 break;
             }
             case SGL_CMD_GETTRANSFORMFEEDBACKVARYING: {
                 int program = *pb++,
                     index = *pb++,
                     bufSize = *pb++;
-                glGetTransformFeedbackVarying(program, index, bufSize, 
+                glGetTransformFeedbackVarying(sgl_shader_name(ctx, program), index, bufSize, 
                     p + SGL_OFFSET_REGISTER_RETVAL_V,
                     p + SGL_OFFSET_REGISTER_RETVAL_V + sizeof(GLsizei),
                     p + SGL_OFFSET_REGISTER_RETVAL_V + sizeof(GLsizei)  + sizeof(GLsizei),
@@ -4728,18 +5977,25 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             }
             case SGL_CMD_GETFRAGDATALOCATION: {
                 int program = *pb++;
-                char *string = (char*)pb;
-                ADVANCE_PAST_STRING();
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetFragDataLocation(program, string);
+                char *string = read_string(&pb, next);
+                if (string == NULL)
+                    break;
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetFragDataLocation(sgl_shader_name(ctx, program), string);
                 break;
             }
             case SGL_CMD_DELETERENDERBUFFERS: {
-                unsigned int renderbuffer = *pb++;
-                glDeleteRenderbuffers(1, &renderbuffer);
+                int n = *pb++;
+                if (!OPERANDS_FIT(n, sizeof(GLuint)))
+                    break;
+                glDeleteRenderbuffers(n, (const GLuint*)pb);
+                pb += n;
                 break;
             }
             case SGL_CMD_GENRENDERBUFFERS: {
-                glGenRenderbuffers(1, (GLuint*)(p + SGL_OFFSET_REGISTER_RETVAL));
+                int n = *pb++;
+                download_offset = 0;
+                download_target = scratch_buffer_get(n * sizeof(GLuint));
+                glGenRenderbuffers(n, download_target);
                 break;
             }
             case SGL_CMD_GETRENDERBUFFERPARAMETERIV: {
@@ -4749,8 +6005,11 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_DELETEFRAMEBUFFERS: {
-                unsigned int framebuffer = *pb++;
-                glDeleteFramebuffers(1, &framebuffer);
+                int n = *pb++;
+                if (!OPERANDS_FIT(n, sizeof(GLuint)))
+                    break;
+                glDeleteFramebuffers(n, (const GLuint*)pb);
+                pb += n;
                 break;
             }
             case SGL_CMD_GETFRAMEBUFFERATTACHMENTPARAMETERIV: {
@@ -4758,27 +6017,34 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     attachment = *pb++,
                     pname = *pb++;
                 glGetFramebufferAttachmentParameteriv(target, attachment, pname, (int*)(p + SGL_OFFSET_REGISTER_RETVAL_V));
+                if (pname == GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME) {
+                    int type = GL_NONE;
+                    glGetFramebufferAttachmentParameteriv(target, attachment, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &type);
+                    if (type == GL_TEXTURE)
+                        *(int*)(p + SGL_OFFSET_REGISTER_RETVAL_V) = sgl_client_name(ctx, SGL_NAMESPACE_TEXTURE, *(int*)(p + SGL_OFFSET_REGISTER_RETVAL_V));
+                }
                 break;
             }
             case SGL_CMD_GETUNIFORMINDICES: {
                 int program = *pb++;
-                char *name = (char*)pb;
-                ADVANCE_PAST_STRING();
-                glGetUniformIndices(program, 1, (const GLchar** const)&name, (unsigned int*)(p + SGL_OFFSET_REGISTER_RETVAL));
+                char *name = read_string(&pb, next);
+                if (name == NULL)
+                    break;
+                glGetUniformIndices(sgl_shader_name(ctx, program), 1, (const GLchar** const)&name, (unsigned int*)(p + SGL_OFFSET_REGISTER_RETVAL));
                 break;
             }
             case SGL_CMD_GETACTIVEUNIFORMSIV: {
                 int program = *pb++,
                     index = *pb++,
                     pname = *pb++;
-                glGetActiveUniformsiv(program, 1, (unsigned int*)&index, pname, (int*)(p + SGL_OFFSET_REGISTER_RETVAL));
+                glGetActiveUniformsiv(sgl_shader_name(ctx, program), 1, (unsigned int*)&index, pname, (int*)(p + SGL_OFFSET_REGISTER_RETVAL));
                 break;
             }
             case SGL_CMD_GETACTIVEUNIFORMNAME: {
                 int program = *pb++,
                     uniformIndex = *pb++,
                     bufSize = *pb++;
-                glGetActiveUniformName(program, uniformIndex, bufSize,
+                glGetActiveUniformName(sgl_shader_name(ctx, program), uniformIndex, bufSize,
                     (int*)(p + SGL_OFFSET_REGISTER_RETVAL_V),
                     (char*)(p + SGL_OFFSET_REGISTER_RETVAL_V + sizeof(GLsizei))
                 );
@@ -4786,23 +6052,24 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             }
             case SGL_CMD_GETUNIFORMBLOCKINDEX: {
                 int program = *pb++;
-                char *name = (char*)pb;
-                ADVANCE_PAST_STRING();
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetUniformBlockIndex(program, name);
+                char *name = read_string(&pb, next);
+                if (name == NULL)
+                    break;
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetUniformBlockIndex(sgl_shader_name(ctx, program), name);
                 break;
             }
             case SGL_CMD_GETACTIVEUNIFORMBLOCKIV: {
                 int program = *pb++,
                     index = *pb++,
                     pname = *pb++;
-                glGetActiveUniformBlockiv(program, index, pname, (int*)(p + SGL_OFFSET_REGISTER_RETVAL));
+                glGetActiveUniformBlockiv(sgl_shader_name(ctx, program), index, pname, (int*)(p + SGL_OFFSET_REGISTER_RETVAL));
                 break;
             }
             case SGL_CMD_GETACTIVEUNIFORMBLOCKNAME: {
                 int program = *pb++,
                     uniformBlockIndex = *pb++,
                     bufSize = *pb++;
-                glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize,
+                glGetActiveUniformBlockName(sgl_shader_name(ctx, program), uniformBlockIndex, bufSize,
                     (int*)(p + SGL_OFFSET_REGISTER_RETVAL_V),
                     (char*)(p + SGL_OFFSET_REGISTER_RETVAL_V + sizeof(GLsizei))
                 );
@@ -4815,7 +6082,57 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int64_t indices = pb_next_i64(&pb);
                 int use_upload = *pb++;
                 int instancecount = *pb++;
-                glDrawElementsInstanced(mode, count, type, use_upload ? uploaded : (void*)(uintptr_t)indices, instancecount);
+                glDrawElementsInstanced(mode, count, type, use_upload ? UPLOAD_POINTER(0, GL_ELEMENT_ARRAY_BUFFER) : (void*)(uintptr_t)indices, instancecount);
+                if (use_upload)
+                    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+                break;
+            }
+            case SGL_CMD_MULTIDRAWARRAYS: {
+                int mode = *pb++,
+                    drawcount = *pb++;
+                if (!OPERANDS_FIT(drawcount, 2 * sizeof(int)))
+                    break;
+                const GLint *first = pb;
+                const GLsizei *count = pb + drawcount;
+                glMultiDrawArrays(mode, first, count, drawcount);
+                pb += 2 * drawcount;
+                break;
+            }
+            case SGL_CMD_MULTIDRAWELEMENTS:
+            case SGL_CMD_MULTIDRAWELEMENTSBASEVERTEX: {
+                int mode = *pb++,
+                    type = *pb++,
+                    drawcount = *pb++,
+                    use_upload = *pb++;
+                if (!OPERANDS_FIT(drawcount, (cmd == SGL_CMD_MULTIDRAWELEMENTSBASEVERTEX ? 4 : 3) * sizeof(int)))
+                    break;
+                const GLsizei *count = pb;
+                pb += drawcount;
+                const GLint *basevertex = NULL;
+                if (cmd == SGL_CMD_MULTIDRAWELEMENTSBASEVERTEX) {
+                    basevertex = pb;
+                    pb += drawcount;
+                }
+
+                /*
+                 * offsets into the upload, or into the bound element
+                 * array buffer without one
+                 */
+                const void *indices[SGL_MULTIDRAW_MAX];
+                for (int i = 0; i < drawcount; i++) {
+                    int64_t offset = pb_next_i64(&pb);
+                    if (i < SGL_MULTIDRAW_MAX)
+                        indices[i] = use_upload ? UPLOAD_POINTER(offset, GL_ELEMENT_ARRAY_BUFFER) : (const void*)(uintptr_t)offset;
+                }
+
+                if (drawcount <= SGL_MULTIDRAW_MAX) {
+                    if (basevertex != NULL)
+                        glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+                    else
+                        glMultiDrawElements(mode, count, type, indices, drawcount);
+                }
+                if (use_upload)
+                    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
                 break;
             }
             case SGL_CMD_DRAWELEMENTSBASEVERTEX: {
@@ -4825,7 +6142,13 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int64_t indices = pb_next_i64(&pb);
                 int use_upload = *pb++;
                 int basevertex = *pb++;
-                glDrawElementsBaseVertex(mode, count, type, use_upload ? uploaded : (void*)(uintptr_t)indices, basevertex);
+                if (!use_upload) {
+                    sgl_draw_elements_run(&next, end, COALESCE_DRAWS, mode, type, count, (void*)(uintptr_t)indices, basevertex);
+                    break;
+                }
+                sgl_stats.draws++;
+                glDrawElementsBaseVertex(mode, count, type, UPLOAD_POINTER(0, GL_ELEMENT_ARRAY_BUFFER), basevertex);
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
                 break;
             }
             case SGL_CMD_DRAWRANGEELEMENTSBASEVERTEX: {
@@ -4837,7 +6160,9 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int64_t indices = pb_next_i64(&pb);
                 int use_upload = *pb++;
                 int basevertex = *pb++;
-                glDrawRangeElementsBaseVertex(mode, start, end, count, type, use_upload ? uploaded : (void*)(uintptr_t)indices, basevertex);
+                glDrawRangeElementsBaseVertex(mode, start, end, count, type, use_upload ? UPLOAD_POINTER(0, GL_ELEMENT_ARRAY_BUFFER) : (void*)(uintptr_t)indices, basevertex);
+                if (use_upload)
+                    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
                 break;
             }
             case SGL_CMD_DRAWELEMENTSINSTANCEDBASEVERTEX: {
@@ -4848,7 +6173,9 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int use_upload = *pb++;
                 int instancecount = *pb++,
                     basevertex = *pb++;
-                glDrawElementsInstancedBaseVertex(mode, count, type, use_upload ? uploaded : (void*)(uintptr_t)indices, instancecount, basevertex);
+                glDrawElementsInstancedBaseVertex(mode, count, type, use_upload ? UPLOAD_POINTER(0, GL_ELEMENT_ARRAY_BUFFER) : (void*)(uintptr_t)indices, instancecount, basevertex);
+                if (use_upload)
+                    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
                 break;
             }
             case SGL_CMD_GETMULTISAMPLEFV: {
@@ -4858,28 +6185,38 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_BINDFRAGDATALOCATIONINDEXED: {
+                int *args = pb + 1;
                 int program = *pb++,
                     colorNumber = *pb++,
                     index = *pb++;
-                char *name = (char*)pb;
-                ADVANCE_PAST_STRING();
-                glBindFragDataLocationIndexed(program, colorNumber, index, name);
+                char *name = read_string(&pb, next);
+                if (name == NULL)
+                    break;
+                sgl_note_link_state(ctx, program, args, pb);
+                glBindFragDataLocationIndexed(sgl_shader_name(ctx, program), colorNumber, index, name);
                 break;
             }
             case SGL_CMD_GETFRAGDATAINDEX: {
                 int program = *pb++;
-                char *name = (char*)pb;
-                ADVANCE_PAST_STRING();
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetFragDataIndex(program, name);
+                char *name = read_string(&pb, next);
+                if (name == NULL)
+                    break;
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetFragDataIndex(sgl_shader_name(ctx, program), name);
                 break;
             }
             case SGL_CMD_GENSAMPLERS: {
-                glGenSamplers(1, (unsigned int*)(p + SGL_OFFSET_REGISTER_RETVAL));
+                int n = *pb++;
+                download_offset = 0;
+                download_target = scratch_buffer_get(n * sizeof(GLuint));
+                glGenSamplers(n, download_target);
                 break;
             }
             case SGL_CMD_DELETESAMPLERS: {
-                unsigned int samplers = *pb++;
-                glDeleteSamplers(1, &samplers);
+                int n = *pb++;
+                if (!OPERANDS_FIT(n, sizeof(GLuint)))
+                    break;
+                glDeleteSamplers(n, (const GLuint*)pb);
+                pb += n;
                 break;
             }
             case SGL_CMD_VERTEXATTRIBIPOINTER: {
@@ -4889,7 +6226,9 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     stride = *pb++;
                 int64_t ptr = pb_next_i64(&pb);
                 int use_upload = *pb++;
-                glVertexAttribIPointer(index, size, type, stride, use_upload ? uploaded : (void*)(uintptr_t)ptr);
+                glVertexAttribIPointer(index, size, type, stride, use_upload ? UPLOAD_POINTER(ptr, GL_ARRAY_BUFFER) : (void*)(uintptr_t)ptr);
+                if (use_upload)
+                    sgl_bind_buffer(ctx, GL_ARRAY_BUFFER, 0);
                 break;
             }
             case SGL_CMD_MAPBUFFER: {
@@ -4933,6 +6272,8 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             }
             case SGL_CMD_DRAWBUFFERS: {
                 int n = *pb++;
+                if (!OPERANDS_FIT(n, sizeof(int)))
+                    break;
                 unsigned int bufs[n];
                 for (int i = 0; i < n; i++)
                     bufs[i] = *pb++;
@@ -4955,25 +6296,27 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             case SGL_CMD_GETUNIFORMDV: {
                 int program = *pb++,
                     location = *pb++;
-                glGetUniformdv(program, location, p + SGL_OFFSET_REGISTER_RETVAL_V);
+                glGetUniformdv(sgl_shader_name(ctx, program), location, p + SGL_OFFSET_REGISTER_RETVAL_V);
                 break;
             }
             case SGL_CMD_GETSUBROUTINEUNIFORMLOCATION: {
                 int program = *pb++;
                 int shadertype = *pb++;
-                char *name = (char*)pb;
-                ADVANCE_PAST_STRING();
+                char *name = read_string(&pb, next);
+                if (name == NULL)
+                    break;
 
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetSubroutineUniformLocation(program, shadertype, name);
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetSubroutineUniformLocation(sgl_shader_name(ctx, program), shadertype, name);
                 break;
             }
             case SGL_CMD_GETSUBROUTINEINDEX: {
                 int program = *pb++;
                 int shadertype = *pb++;
-                char *name = (char*)pb;
-                ADVANCE_PAST_STRING();
+                char *name = read_string(&pb, next);
+                if (name == NULL)
+                    break;
 
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetSubroutineIndex(program, shadertype, name);
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetSubroutineIndex(sgl_shader_name(ctx, program), shadertype, name);
                 break;
             }
             case SGL_CMD_GETACTIVESUBROUTINEUNIFORMIV: {
@@ -4983,10 +6326,10 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int pname = *pb++;
 
                 if (pname == GL_COMPATIBLE_SUBROUTINES) {
-                    glGetActiveSubroutineUniformiv(program, shadertype, index, GL_NUM_COMPATIBLE_SUBROUTINES, (int*)(p + SGL_OFFSET_REGISTER_RETVAL));
-                    glGetActiveSubroutineUniformiv(program, shadertype, index, GL_COMPATIBLE_SUBROUTINES, (int*)(p + SGL_OFFSET_REGISTER_RETVAL_V));
+                    glGetActiveSubroutineUniformiv(sgl_shader_name(ctx, program), shadertype, index, GL_NUM_COMPATIBLE_SUBROUTINES, (int*)(p + SGL_OFFSET_REGISTER_RETVAL));
+                    glGetActiveSubroutineUniformiv(sgl_shader_name(ctx, program), shadertype, index, GL_COMPATIBLE_SUBROUTINES, (int*)(p + SGL_OFFSET_REGISTER_RETVAL_V));
                 } else {
-                    glGetActiveSubroutineUniformiv(program, shadertype, index, pname, (int*)(p + SGL_OFFSET_REGISTER_RETVAL));
+                    glGetActiveSubroutineUniformiv(sgl_shader_name(ctx, program), shadertype, index, pname, (int*)(p + SGL_OFFSET_REGISTER_RETVAL));
                 }
 
                 break;
@@ -4997,7 +6340,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int index = *pb++;
                 int bufsize = *pb++;
 
-                glGetActiveSubroutineUniformName(program, shadertype, index, bufsize, 
+                glGetActiveSubroutineUniformName(sgl_shader_name(ctx, program), shadertype, index, bufsize, 
                     p + SGL_OFFSET_REGISTER_RETVAL_V,
                     p + SGL_OFFSET_REGISTER_RETVAL_V + sizeof(GLsizei)
                 );
@@ -5010,7 +6353,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int index = *pb++;
                 int bufsize = *pb++;
 
-                glGetActiveSubroutineName(program, shadertype, index, bufsize, 
+                glGetActiveSubroutineName(sgl_shader_name(ctx, program), shadertype, index, bufsize, 
                     p + SGL_OFFSET_REGISTER_RETVAL_V,
                     p + SGL_OFFSET_REGISTER_RETVAL_V + sizeof(GLsizei)
                 );
@@ -5020,6 +6363,8 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             case SGL_CMD_UNIFORMSUBROUTINESUIV: {
                 int shadertype = *pb++;
                 int count = *pb++;
+                if (!OPERANDS_FIT(count, sizeof(int)))
+                    break;
                 unsigned int indices[count];
 
                 for (int i = 0; i < count; i++)
@@ -5040,12 +6385,14 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int shadertype = *pb++;
                 int pname = *pb++;
 
-                glGetProgramStageiv(program, shadertype, pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
+                glGetProgramStageiv(sgl_shader_name(ctx, program), shadertype, pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
                 break;
             }
             case SGL_CMD_PATCHPARAMETERFV: {
                 int pname = *pb++;
                 int count = *pb++;
+                if (!OPERANDS_FIT(count, sizeof(float)))
+                    break;
                 float values[count];
                 for (int i = 0; i < count; i++)
                     values[i] = *((float*)pb++);
@@ -5053,12 +6400,18 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_DELETETRANSFORMFEEDBACKS: {
-                unsigned int buffer = *pb++;
-                glDeleteTransformFeedbacks(1, &buffer);
+                int n = *pb++;
+                if (!OPERANDS_FIT(n, sizeof(GLuint)))
+                    break;
+                glDeleteTransformFeedbacks(n, (const GLuint*)pb);
+                pb += n;
                 break;
             }
             case SGL_CMD_GENTRANSFORMFEEDBACKS: {
-                glGenTransformFeedbacks(1, (unsigned int*)(p + SGL_OFFSET_REGISTER_RETVAL));
+                int n = *pb++;
+                download_offset = 0;
+                download_target = scratch_buffer_get(n * sizeof(GLuint));
+                glGenTransformFeedbacks(n, download_target);
                 break;
             }
             case SGL_CMD_GETQUERYINDEXEDIV: {
@@ -5072,10 +6425,16 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int count = *pb++;
                 int binaryformat = *pb++;
                 int length = *pb++;
+                if (!OPERANDS_FIT(count, sizeof(int)))
+                    break;
 
                 unsigned int shaders[count];
-                for (int i = 0; i < count; i++)
-                    shaders[i] = *pb++;
+                for (int i = 0; i < count; i++) {
+                    sgl_forget_shader_source(ctx, *pb);
+                    shaders[i] = sgl_shader_name(ctx, *pb++);
+                }
+                if (!OPERANDS_FIT(length, 1))
+                    break;
 
                 void *binary = pb;
                 pb += CEIL_DIV(length, 4);
@@ -5103,27 +6462,39 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int program = *pb++;
                 int binaryFormat = *pb++;
                 int length = *pb++;
+                if (!OPERANDS_FIT(length, 1))
+                    break;
                 void *binary = pb;
                 pb += CEIL_DIV(length, 4);
 
-                glProgramBinary(program, binaryFormat, binary, length);
+                glProgramBinary(sgl_shader_name(ctx, program), binaryFormat, binary, length);
                 break;
             }
             case SGL_CMD_CREATESHADERPROGRAMV: {
                 int type = *pb++;
+                int name = *pb++;
                 int count = *pb++;
+                if (!OPERANDS_FIT(count, sizeof(int)))
+                    break;
                 const char *strings[count];
-                read_counted_c_strings(&pb, count, strings);
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glCreateShaderProgramv(type, count, strings);
+                if (!read_counted_c_strings(&pb, next, count, strings))
+                    break;
+                sgl_bind_name(ctx, SGL_NAMESPACE_SHADER, name, glCreateShaderProgramv(type, count, strings));
                 break;
             }
             case SGL_CMD_DELETEPROGRAMPIPELINES: {
-                unsigned int buffer = *pb++;
-                glDeleteProgramPipelines(1, &buffer);
+                int n = *pb++;
+                if (!OPERANDS_FIT(n, sizeof(GLuint)))
+                    break;
+                glDeleteProgramPipelines(n, (const GLuint*)pb);
+                pb += n;
                 break;
             }
             case SGL_CMD_GENPROGRAMPIPELINES: {
-                glGenProgramPipelines(1, (unsigned int*)(p + SGL_OFFSET_REGISTER_RETVAL));
+                int n = *pb++;
+                download_offset = 0;
+                download_target = scratch_buffer_get(n * sizeof(GLuint));
+                glGenProgramPipelines(n, download_target);
                 break;
             }
             case SGL_CMD_GETPROGRAMPIPELINEIV: {
@@ -5137,7 +6508,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     location = *pb++,
                     count = *pb++,
                     transpose = *pb++;
-                glProgramUniformMatrix2fv(program, location, count, transpose, uploaded);
+                glProgramUniformMatrix2fv(sgl_shader_name(ctx, program), location, count, transpose, uploaded);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORMMATRIX3FV: {
@@ -5145,7 +6516,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     location = *pb++,
                     count = *pb++,
                     transpose = *pb++;
-                glProgramUniformMatrix3fv(program, location, count, transpose, uploaded);
+                glProgramUniformMatrix3fv(sgl_shader_name(ctx, program), location, count, transpose, uploaded);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORMMATRIX4FV: {
@@ -5153,7 +6524,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     location = *pb++,
                     count = *pb++,
                     transpose = *pb++;
-                glProgramUniformMatrix4fv(program, location, count, transpose, uploaded);
+                glProgramUniformMatrix4fv(sgl_shader_name(ctx, program), location, count, transpose, uploaded);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORMMATRIX2DV: {
@@ -5170,7 +6541,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     location = *pb++,
                     count = *pb++,
                     transpose = *pb++;
-                glProgramUniformMatrix2x3fv(program, location, count, transpose, uploaded);
+                glProgramUniformMatrix2x3fv(sgl_shader_name(ctx, program), location, count, transpose, uploaded);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORMMATRIX3X2FV: {
@@ -5178,7 +6549,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     location = *pb++,
                     count = *pb++,
                     transpose = *pb++;
-                glProgramUniformMatrix3x2fv(program, location, count, transpose, uploaded);
+                glProgramUniformMatrix3x2fv(sgl_shader_name(ctx, program), location, count, transpose, uploaded);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORMMATRIX2X4FV: {
@@ -5186,7 +6557,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     location = *pb++,
                     count = *pb++,
                     transpose = *pb++;
-                glProgramUniformMatrix2x4fv(program, location, count, transpose, uploaded);
+                glProgramUniformMatrix2x4fv(sgl_shader_name(ctx, program), location, count, transpose, uploaded);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORMMATRIX4X2FV: {
@@ -5194,7 +6565,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     location = *pb++,
                     count = *pb++,
                     transpose = *pb++;
-                glProgramUniformMatrix4x2fv(program, location, count, transpose, uploaded);
+                glProgramUniformMatrix4x2fv(sgl_shader_name(ctx, program), location, count, transpose, uploaded);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORMMATRIX3X4FV: {
@@ -5202,7 +6573,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     location = *pb++,
                     count = *pb++,
                     transpose = *pb++;
-                glProgramUniformMatrix3x4fv(program, location, count, transpose, uploaded);
+                glProgramUniformMatrix3x4fv(sgl_shader_name(ctx, program), location, count, transpose, uploaded);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORMMATRIX4X3FV: {
@@ -5210,7 +6581,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     location = *pb++,
                     count = *pb++,
                     transpose = *pb++;
-                glProgramUniformMatrix4x3fv(program, location, count, transpose, uploaded);
+                glProgramUniformMatrix4x3fv(sgl_shader_name(ctx, program), location, count, transpose, uploaded);
                 break;
             }
             case SGL_CMD_PROGRAMUNIFORMMATRIX2X3DV: {
@@ -5247,7 +6618,9 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     stride = *pb++;
                 int64_t ptr = pb_next_i64(&pb);
                 int use_upload = *pb++;
-                glVertexAttribLPointer(index, size, type, stride, use_upload ? uploaded : (void*)(uintptr_t)ptr);
+                glVertexAttribLPointer(index, size, type, stride, use_upload ? UPLOAD_POINTER(ptr, GL_ARRAY_BUFFER) : (void*)(uintptr_t)ptr);
+                if (use_upload)
+                    sgl_bind_buffer(ctx, GL_ARRAY_BUFFER, 0);
                 break;
             }
             case SGL_CMD_VIEWPORTARRAYV: {
@@ -5299,7 +6672,9 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int use_upload = *pb++;
                 int instancecount = *pb++;
                 int baseinstance = *pb++;
-                glDrawElementsInstancedBaseInstance(mode, count, type, use_upload ? uploaded : (void*)(uintptr_t)indices, instancecount, baseinstance);
+                glDrawElementsInstancedBaseInstance(mode, count, type, use_upload ? UPLOAD_POINTER(0, GL_ELEMENT_ARRAY_BUFFER) : (void*)(uintptr_t)indices, instancecount, baseinstance);
+                if (use_upload)
+                    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
                 break;
             }
             case SGL_CMD_DRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCE: {
@@ -5311,7 +6686,9 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int instancecount = *pb++;
                 int basevertex = *pb++;
                 int baseinstance = *pb++;
-                glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, use_upload ? uploaded : (void*)(uintptr_t)indices, instancecount, basevertex, baseinstance);
+                glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, use_upload ? UPLOAD_POINTER(0, GL_ELEMENT_ARRAY_BUFFER) : (void*)(uintptr_t)indices, instancecount, basevertex, baseinstance);
+                if (use_upload)
+                    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
                 break;
             }
             case SGL_CMD_GETINTERNALFORMATIV: {
@@ -5328,10 +6705,10 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int pname = *pb++;
 
                 if (pname == GL_ATOMIC_COUNTER_BUFFER_ACTIVE_ATOMIC_COUNTER_INDICES) {
-                    glGetActiveAtomicCounterBufferiv(program, bufferIndex, GL_ATOMIC_COUNTER_BUFFER_ACTIVE_ATOMIC_COUNTERS, (int*)(p + SGL_OFFSET_REGISTER_RETVAL));
-                    glGetActiveAtomicCounterBufferiv(program, bufferIndex, GL_ATOMIC_COUNTER_BUFFER_ACTIVE_ATOMIC_COUNTER_INDICES, (int*)(p + SGL_OFFSET_REGISTER_RETVAL_V));
+                    glGetActiveAtomicCounterBufferiv(sgl_shader_name(ctx, program), bufferIndex, GL_ATOMIC_COUNTER_BUFFER_ACTIVE_ATOMIC_COUNTERS, (int*)(p + SGL_OFFSET_REGISTER_RETVAL));
+                    glGetActiveAtomicCounterBufferiv(sgl_shader_name(ctx, program), bufferIndex, GL_ATOMIC_COUNTER_BUFFER_ACTIVE_ATOMIC_COUNTER_INDICES, (int*)(p + SGL_OFFSET_REGISTER_RETVAL_V));
                 } else {
-                    glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, (int*)(p + SGL_OFFSET_REGISTER_RETVAL));
+                    glGetActiveAtomicCounterBufferiv(sgl_shader_name(ctx, program), bufferIndex, pname, (int*)(p + SGL_OFFSET_REGISTER_RETVAL));
                 }
 
                 break;
@@ -5396,15 +6773,16 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int program = *pb++;
                 int programInterface = *pb++;
                 int pname = *pb++;
-                glGetProgramInterfaceiv(program, programInterface, pname, p + SGL_OFFSET_REGISTER_RETVAL);
+                glGetProgramInterfaceiv(sgl_shader_name(ctx, program), programInterface, pname, p + SGL_OFFSET_REGISTER_RETVAL);
                 break;
             }
             case SGL_CMD_GETPROGRAMRESOURCEINDEX: {
                 int program = *pb++;
                 int programInterface = *pb++;
-                char *name = (char*)pb;
-                ADVANCE_PAST_STRING();
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetProgramResourceIndex(program, programInterface, name);
+                char *name = read_string(&pb, next);
+                if (name == NULL)
+                    break;
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetProgramResourceIndex(sgl_shader_name(ctx, program), programInterface, name);
                 break;
             }
             case SGL_CMD_GETPROGRAMRESOURCENAME: {
@@ -5412,7 +6790,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int programInterface = *pb++;
                 int index = *pb++;
                 int bufSize = *pb++;
-                glGetProgramResourceName(program, programInterface, index, bufSize, 
+                glGetProgramResourceName(sgl_shader_name(ctx, program), programInterface, index, bufSize, 
                     p + SGL_OFFSET_REGISTER_RETVAL_V,
                     p + SGL_OFFSET_REGISTER_RETVAL_V + sizeof(GLsizei)
                 );
@@ -5424,7 +6802,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int index = *pb++;
                 int propCount = *pb++;
                 int bufSize = *pb++;
-                glGetProgramResourceiv(program, programInterface, index, propCount, uploaded, bufSize,
+                glGetProgramResourceiv(sgl_shader_name(ctx, program), programInterface, index, propCount, uploaded, bufSize,
                     p + SGL_OFFSET_REGISTER_RETVAL_V,
                     p + SGL_OFFSET_REGISTER_RETVAL_V + sizeof(GLsizei)
                 );
@@ -5433,19 +6811,21 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             case SGL_CMD_GETPROGRAMRESOURCELOCATION: {
                 int program = *pb++;
                 int programInterface = *pb++;
-                char *name = (char*)pb;
-                ADVANCE_PAST_STRING();
+                char *name = read_string(&pb, next);
+                if (name == NULL)
+                    break;
 
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetProgramResourceLocation(program, programInterface, name);
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetProgramResourceLocation(sgl_shader_name(ctx, program), programInterface, name);
                 break;
             }
             case SGL_CMD_GETPROGRAMRESOURCELOCATIONINDEX: {
                 int program = *pb++;
                 int programInterface = *pb++;
-                char *name = (char*)pb;
-                ADVANCE_PAST_STRING();
+                char *name = read_string(&pb, next);
+                if (name == NULL)
+                    break;
 
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetProgramResourceLocationIndex(program, programInterface, name);
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetProgramResourceLocationIndex(sgl_shader_name(ctx, program), programInterface, name);
                 break;
             }
             case SGL_CMD_DEBUGMESSAGECONTROL: {
@@ -5489,7 +6869,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int format = *pb++;
                 int type = *pb++;
                 unsigned int data = *pb++;
-                glClearTexImage(texture, level, format, type, &data);
+                glClearTexImage(sgl_texture_name(ctx, texture), level, format, type, &data);
                 break;
             }
             case SGL_CMD_CLEARTEXSUBIMAGE: {
@@ -5504,19 +6884,21 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int format = *pb++;
                 int type = *pb++;
                 unsigned int data = *pb++;
-                glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, &data);
+                glClearTexSubImage(sgl_texture_name(ctx, texture), level, xoffset, yoffset, zoffset, width, height, depth, format, type, &data);
                 break;
             }
             case SGL_CMD_BINDBUFFERSRANGE: {
                 int target = *pb++;
                 int first = *pb++;
                 int count = *pb++;
+                if (!OPERANDS_FIT(count, 3 * sizeof(int)))
+                    break;
                 // to-do: possibly optimize by just setting these to point into pb
                 GLuint buffers[count];
                 GLintptr offsets[count];
                 GLsizeiptr sizes[count];
                 for (int i = 0; i < count; i++) {
-                    buffers[i] = *pb++;
+                    buffers[i] = sgl_buffer_name(ctx, *pb++);
                     offsets[i] = *pb++;
                     sizes[i] = *pb++;
                 }
@@ -5526,6 +6908,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             case SGL_CMD_BINDTEXTURES: {
                 int first = *pb++;
                 int count = *pb++;
+                sgl_host_names(ctx, SGL_NAMESPACE_TEXTURE, uploaded, count);
                 glBindTextures(first, count, uploaded);
                 break;
             }
@@ -5538,18 +6921,21 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             case SGL_CMD_BINDIMAGETEXTURES: {
                 int first = *pb++;
                 int count = *pb++;
+                sgl_host_names(ctx, SGL_NAMESPACE_TEXTURE, uploaded, count);
                 glBindImageTextures(first, count, uploaded);
                 break;
             }
             case SGL_CMD_BINDVERTEXBUFFERS: {
                 int first = *pb++;
                 int count = *pb++;
+                if (!OPERANDS_FIT(count, 4 * sizeof(int)))
+                    break;
                 // to-do: possibly optimize by just setting these to point into pb
                 GLuint buffers[count];
                 GLintptr offsets[count];
                 GLsizei strides[count];
                 for (int i = 0; i < count; i++) {
-                    buffers[i] = *pb++;
+                    buffers[i] = sgl_buffer_name(ctx, *pb++);
                     offsets[i] = pb_next_i64(&pb);
                     strides[i] = *pb++;
                 }
@@ -5581,7 +6967,10 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_CREATEBUFFERS: {
-                glCreateBuffers(1, (unsigned int*)(p + SGL_OFFSET_REGISTER_RETVAL));
+                int name = *pb++;
+                GLuint host = 0;
+                glCreateBuffers(1, &host);
+                sgl_bind_name(ctx, SGL_NAMESPACE_BUFFER, name, host);
                 break;
             }
             case SGL_CMD_NAMEDBUFFERSTORAGE: {
@@ -5589,7 +6978,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     size = *pb++,
                     use_uploaded = *pb++,
                     usage = *pb++;
-                glNamedBufferStorage(target, size, use_uploaded ? uploaded : NULL, usage);
+                glNamedBufferStorage(sgl_buffer_name(ctx, target), size, use_uploaded ? uploaded : NULL, usage);
                 break;
             }
             case SGL_CMD_NAMEDBUFFERDATA: {
@@ -5597,14 +6986,14 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     size = *pb++,
                     use_uploaded = *pb++,
                     usage = *pb++;
-                glNamedBufferData(buffer, size, use_uploaded ? uploaded : NULL, usage);
+                glNamedBufferData(sgl_buffer_name(ctx, buffer), size, use_uploaded ? uploaded : NULL, usage);
                 break;
             }
             case SGL_CMD_NAMEDBUFFERSUBDATA: {
                 int target = *pb++,
                     offset = *pb++,
                     size = *pb++;
-                glNamedBufferSubData(target, offset, size, uploaded);
+                glNamedBufferSubData(sgl_buffer_name(ctx, target), offset, size, uploaded);
                 break;
             }
             case SGL_CMD_CLEARNAMEDBUFFERDATA: {
@@ -5613,7 +7002,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int format = *pb++;
                 int type = *pb++;
                 unsigned int data = *pb++;
-                glClearNamedBufferData(target, internalformat, format, type, &data);
+                glClearNamedBufferData(sgl_buffer_name(ctx, target), internalformat, format, type, &data);
                 break;
             }
             case SGL_CMD_CLEARNAMEDBUFFERSUBDATA: {
@@ -5624,13 +7013,13 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int format = *pb++;
                 int type = *pb++;
                 unsigned int data = *pb++;
-                glClearNamedBufferSubData(target, internalformat, offset, size, format, type, &data);
+                glClearNamedBufferSubData(sgl_buffer_name(ctx, target), internalformat, offset, size, format, type, &data);
                 break;
             }
             case SGL_CMD_MAPNAMEDBUFFER: {
                 int target = *pb++,
                     access = *pb++;
-                map_buffer = glMapNamedBuffer(target, access);
+                map_buffer = glMapNamedBuffer(sgl_buffer_name(ctx, target), access);
                 download_offset = 0;
                 download_target = map_buffer;
                 break;
@@ -5640,7 +7029,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     offset = *pb++,
                     length = *pb++,
                     access = *pb++;
-                map_buffer = glMapNamedBufferRange(target, offset, length, access);
+                map_buffer = glMapNamedBufferRange(sgl_buffer_name(ctx, target), offset, length, access);
                 download_offset = 0;
                 download_target = map_buffer;
                 break;
@@ -5649,7 +7038,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int target = *pb++,
                     pname = *pb++;
                 int params;
-                glGetNamedBufferParameteriv(target, pname, &params);
+                glGetNamedBufferParameteriv(sgl_buffer_name(ctx, target), pname, &params);
                 *(int*)(p + SGL_OFFSET_REGISTER_RETVAL_V) = params;
                 break;
             }
@@ -5660,6 +7049,12 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_GETNAMEDBUFFERSUBDATA: {
+                int buffer = *pb++,
+                    offset = *pb++,
+                    size = *pb++;
+                download_offset = 0;
+                download_target = scratch_buffer_get(size);
+                glGetNamedBufferSubData(sgl_buffer_name(ctx, buffer), offset, size, download_target);
                 break;
             }
             case SGL_CMD_CREATEFRAMEBUFFERS: {
@@ -5669,6 +7064,8 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             case SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFERS: {
                 int framebuffer = *pb++;
                 int n = *pb++;
+                if (!OPERANDS_FIT(n, sizeof(int)))
+                    break;
                 unsigned int bufs[n];
                 for (int i = 0; i < n; i++)
                     bufs[i] = *pb++;
@@ -5732,6 +7129,12 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     attachment = *pb++,
                     pname = *pb++;
                 glGetNamedFramebufferAttachmentParameteriv(target, attachment, pname, (int*)(p + SGL_OFFSET_REGISTER_RETVAL_V));
+                if (pname == GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME) {
+                    int type = GL_NONE;
+                    glGetNamedFramebufferAttachmentParameteriv(target, attachment, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &type);
+                    if (type == GL_TEXTURE)
+                        *(int*)(p + SGL_OFFSET_REGISTER_RETVAL_V) = sgl_client_name(ctx, SGL_NAMESPACE_TEXTURE, *(int*)(p + SGL_OFFSET_REGISTER_RETVAL_V));
+                }
                 break;
             }
             case SGL_CMD_CREATERENDERBUFFERS: {
@@ -5745,7 +7148,11 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_CREATETEXTURES: {
-                glCreateTextures(*pb++, 1, (unsigned int*)(p + SGL_OFFSET_REGISTER_RETVAL));
+                int target = *pb++,
+                    name = *pb++;
+                GLuint host = 0;
+                glCreateTextures(target, 1, &host);
+                sgl_bind_name(ctx, SGL_NAMESPACE_TEXTURE, name, host);
                 break;
             }
             case SGL_CMD_TEXTURESUBIMAGE1D: {
@@ -5755,7 +7162,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     width = *pb++,
                     format = *pb++,
                     type = *pb++;
-                glTextureSubImage1D(target, level, xoffset, width, format, type, uploaded);
+                glTextureSubImage1D(sgl_texture_name(ctx, target), level, xoffset, width, format, type, uploaded);
                 break;
             }
             case SGL_CMD_TEXTURESUBIMAGE2D: {
@@ -5767,7 +7174,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     height = *pb++,
                     format = *pb++,
                     type = *pb++;
-                glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, uploaded);
+                glTextureSubImage2D(sgl_texture_name(ctx, texture), level, xoffset, yoffset, width, height, format, type, uploaded);
                 break;
             }
             case SGL_CMD_TEXTURESUBIMAGE3D: {
@@ -5781,7 +7188,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     depth = *pb++,
                     format = *pb++,
                     type = *pb++;
-                glTextureSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, uploaded);
+                glTextureSubImage3D(sgl_texture_name(ctx, target), level, xoffset, yoffset, zoffset, width, height, depth, format, type, uploaded);
                 break;
             }
             case SGL_CMD_COMPRESSEDTEXTURESUBIMAGE1D: {
@@ -5793,7 +7200,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     width = *pb++,
                     format = *pb++,
                     imageSize = *pb++;
-                glCompressedTextureSubImage1D(target, level, xoffset, width, format, imageSize, uploaded);
+                glCompressedTextureSubImage1D(sgl_texture_name(ctx, target), level, xoffset, width, format, imageSize, uploaded);
                 break;
             }
             case SGL_CMD_COMPRESSEDTEXTURESUBIMAGE2D: {
@@ -5807,7 +7214,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     depth = *pb++,
                     format = *pb++,
                     imageSize = *pb++;
-                glCompressedTextureSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, uploaded);
+                glCompressedTextureSubImage2D(sgl_texture_name(ctx, target), level, xoffset, yoffset, width, height, format, imageSize, uploaded);
                 break;
             }
             case SGL_CMD_COMPRESSEDTEXTURESUBIMAGE3D: {
@@ -5821,7 +7228,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                     depth = *pb++,
                     format = *pb++,
                     imageSize = *pb++;
-                glCompressedTextureSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, uploaded);
+                glCompressedTextureSubImage3D(sgl_texture_name(ctx, target), level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, uploaded);
                 break;
             }
             case SGL_CMD_TEXTUREPARAMETERFV: {
@@ -5832,7 +7239,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 params[1] = *((float*)pb++);
                 params[2] = *((float*)pb++);
                 params[3] = *((float*)pb++);
-                glTextureParameterfv(target, pname, params);
+                glTextureParameterfv(sgl_texture_name(ctx, target), pname, params);
                 break;
             }
             case SGL_CMD_TEXTUREPARAMETERIIV: {
@@ -5843,7 +7250,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 params[1] = *pb++;
                 params[2] = *pb++;
                 params[3] = *pb++;
-                glTextureParameterIiv(target, pname, params);
+                glTextureParameterIiv(sgl_texture_name(ctx, target), pname, params);
                 break;
             }
             case SGL_CMD_TEXTUREPARAMETERIUIV: {
@@ -5854,7 +7261,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 params[1] = *pb++;
                 params[2] = *pb++;
                 params[3] = *pb++;
-                glTextureParameterIuiv(target, pname, params);
+                glTextureParameterIuiv(sgl_texture_name(ctx, target), pname, params);
                 break;
             }
             case SGL_CMD_TEXTUREPARAMETERIV: {
@@ -5865,7 +7272,7 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 params[1] = *pb++;
                 params[2] = *pb++;
                 params[3] = *pb++;
-                glTextureParameteriv(target, pname, params);
+                glTextureParameteriv(sgl_texture_name(ctx, target), pname, params);
                 break;
             }
             case SGL_CMD_GETTEXTUREIMAGE: {
@@ -5878,38 +7285,38 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int target = *pb++,
                     level = *pb++,
                     pname = *pb++;
-                glGetTextureLevelParameterfv(target, level, pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
+                glGetTextureLevelParameterfv(sgl_texture_name(ctx, target), level, pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
                 break;
             }
             case SGL_CMD_GETTEXTURELEVELPARAMETERIV: {
                 int target = *pb++,
                     level = *pb++,
                     pname = *pb++;
-                glGetTextureLevelParameteriv(target, level, pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
+                glGetTextureLevelParameteriv(sgl_texture_name(ctx, target), level, pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
                 break;
             }
             case SGL_CMD_GETTEXTUREPARAMETERFV: {
                 int target = *pb++,
                     pname = *pb++;
-                glGetTextureParameterfv(target, pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
+                glGetTextureParameterfv(sgl_texture_name(ctx, target), pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
                 break;
             }
             case SGL_CMD_GETTEXTUREPARAMETERIIV: {
                 int target = *pb++,
                     pname = *pb++;
-                glGetTextureParameterIiv(target, pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
+                glGetTextureParameterIiv(sgl_texture_name(ctx, target), pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
                 break;
             }
             case SGL_CMD_GETTEXTUREPARAMETERIUIV: {
                 int target = *pb++,
                     pname = *pb++;
-                glGetTextureParameterIuiv(target, pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
+                glGetTextureParameterIuiv(sgl_texture_name(ctx, target), pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
                 break;
             }
             case SGL_CMD_GETTEXTUREPARAMETERIV: {
                 int target = *pb++,
                     pname = *pb++;
-                glGetTextureParameteriv(target, pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
+                glGetTextureParameteriv(sgl_texture_name(ctx, target), pname, p + SGL_OFFSET_REGISTER_RETVAL_V);
                 break;
             }
             case SGL_CMD_CREATEVERTEXARRAYS: {
@@ -5920,12 +7327,14 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int vaobj = *pb++;
                 int first = *pb++;
                 int count = *pb++;
+                if (!OPERANDS_FIT(count, 4 * sizeof(int)))
+                    break;
                 // to-do: possibly optimize by just setting these to point into pb
                 GLuint buffers[count];
                 GLintptr offsets[count];
                 GLsizei strides[count];
                 for (int i = 0; i < count; i++) {
-                    buffers[i] = *pb++;
+                    buffers[i] = sgl_buffer_name(ctx, *pb++);
                     offsets[i] = pb_next_i64(&pb);
                     strides[i] = *pb++;
                 }
@@ -6037,21 +7446,27 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             case SGL_CMD_ATTACHOBJECTARB: {
                 int v0 = *pb++;
                 int v1 = *pb++;
-                glAttachObjectARB(v0, v1);
+                glAttachObjectARB(sgl_shader_name(ctx, v0), sgl_shader_name(ctx, v1));
                 break;
             }
             case SGL_CMD_BINDATTRIBLOCATIONARB: {
+                int *args = pb + 1;
                 int program = *pb++,
                     index = *pb++;
-                char *name = (char*)pb;
-                glBindAttribLocationARB(program, index, name);
-                ADVANCE_PAST_STRING();
+                char *name = read_string(&pb, next);
+                if (name == NULL)
+                    break;
+                sgl_note_link_state(ctx, program, args, pb);
+                glBindAttribLocationARB(sgl_shader_name(ctx, program), index, name);
                 break;
             }
             case SGL_CMD_BINDBUFFERARB: {
                 int target = *pb++,
                     buffer = *pb++;
-                glBindBufferARB(target, buffer);
+                GLuint host = sgl_buffer_name(ctx, buffer);
+                if (ctx != NULL && target == GL_ARRAY_BUFFER)
+                    ctx->array_buffer = host;
+                glBindBufferARB(target, host);
                 break;
             }
             case SGL_CMD_BINDPROGRAMARB: {
@@ -6069,58 +7484,82 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             case SGL_CMD_COMPILESHADERARB: {
-                glCompileShaderARB(*pb++);
+                glCompileShaderARB(sgl_shader_name(ctx, *pb++));
                 break;
             }
             case SGL_CMD_CREATEPROGRAMOBJECTARB: {
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glCreateProgramObjectARB();
+                int name = *pb++;
+                sgl_bind_name(ctx, SGL_NAMESPACE_SHADER, name, glCreateProgramObjectARB());
                 break;
             }
             case SGL_CMD_CREATESHADEROBJECTARB: {
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glCreateShaderObjectARB(*pb++);
+                int type = *pb++,
+                    name = *pb++;
+                sgl_bind_name(ctx, SGL_NAMESPACE_SHADER, name, glCreateShaderObjectARB(type));
                 break;
             }
             case SGL_CMD_DELETEBUFFERSARB: {
-                const unsigned int *x = (unsigned*)pb++;
-                glDeleteBuffersARB(1, x);
+                int n = *pb++;
+                if (!OPERANDS_FIT(n, sizeof(GLuint)))
+                    break;
+                sgl_forget_names(ctx, SGL_NAMESPACE_BUFFER, (GLuint*)pb, n);
+                sgl_unbind_deleted(ctx ? &ctx->array_buffer : NULL, (const GLuint*)pb, n);
+                glDeleteBuffersARB(n, (const GLuint*)pb);
+                pb += n;
                 break;
             }
             case SGL_CMD_DELETEOBJECTARB: {
-                glDeleteObjectARB(*pb++);
+                glDeleteObjectARB(sgl_shader_name(ctx, *pb++));
                 break;
             }
             case SGL_CMD_DELETEPROGRAMSARB: {
-                const unsigned int *x = (unsigned*)pb++;
-                glDeleteProgramsARB(1, x);
+                int n = *pb++;
+                if (!OPERANDS_FIT(n, sizeof(GLuint)))
+                    break;
+                glDeleteProgramsARB(n, (const GLuint*)pb);
+                pb += n;
                 break;
             }
             case SGL_CMD_DELETEQUERIESARB: {
-                const unsigned int *x = (unsigned*)pb++;
-                glDeleteQueriesARB(1, x);
+                int n = *pb++;
+                if (!OPERANDS_FIT(n, sizeof(GLuint)))
+                    break;
+                glDeleteQueriesARB(n, (const GLuint*)pb);
+                pb += n;
                 break;
             }
             case SGL_CMD_DETACHOBJECTARB: {
                 int containerObj = *pb++,
                     attachedObj = *pb++;
-                glDetachObjectARB(containerObj, attachedObj);
+                glDetachObjectARB(sgl_shader_name(ctx, containerObj), sgl_shader_name(ctx, attachedObj));
                 break;
             }
             case SGL_CMD_GENBUFFERSARB: {
-                glGenBuffersARB(1, p + SGL_OFFSET_REGISTER_RETVAL);
+                int n = *pb++;
+                download_offset = 0;
+                download_target = scratch_buffer_get(n * sizeof(GLuint));
+                glGenBuffersARB(n, download_target);
                 break;
             }
             case SGL_CMD_GENPROGRAMSARB: {
-                glGenProgramsARB(1, p + SGL_OFFSET_REGISTER_RETVAL);
+                int n = *pb++;
+                download_offset = 0;
+                download_target = scratch_buffer_get(n * sizeof(GLuint));
+                glGenProgramsARB(n, download_target);
                 break;
             }
             case SGL_CMD_GENQUERIESARB: {
-                glGenQueriesARB(1, p + SGL_OFFSET_REGISTER_RETVAL);
+                int n = *pb++;
+                download_offset = 0;
+                download_target = scratch_buffer_get(n * sizeof(GLuint));
+                glGenQueriesARB(n, download_target);
                 break;
             }
             case SGL_CMD_GETINFOLOGARB: {
                 int obj = *pb++;
                 int maxLength = *pb++;
-                glGetInfoLogARB(obj, maxLength, 
+                sgl_finish_compile(ctx, obj);
+                glGetInfoLogARB(sgl_shader_name(ctx, obj), maxLength, 
                     p + SGL_OFFSET_REGISTER_RETVAL_V,
                     p + SGL_OFFSET_REGISTER_RETVAL_V + sizeof(GLsizei)
                 );
@@ -6134,13 +7573,16 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             }
             case SGL_CMD_GETUNIFORMLOCATIONARB: {
                 int programObj = *pb++;
-                char *string = (char*)pb;
-                ADVANCE_PAST_STRING();
-                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetUniformLocationARB(programObj, string);
+                char *string = read_string(&pb, next);
+                if (string == NULL)
+                    break;
+                *(int*)(p + SGL_OFFSET_REGISTER_RETVAL) = glGetUniformLocationARB(sgl_shader_name(ctx, programObj), string);
                 break;
             }
             case SGL_CMD_LINKPROGRAMARB: {
-                glLinkProgramARB(*pb++);
+                GLuint program = sgl_shader_name(ctx, *pb++);
+                sgl_finish_attached_compiles(ctx, program);
+                glLinkProgramARB(program);
                 break;
             }
             case SGL_CMD_MAPBUFFERARB: {
@@ -6153,20 +7595,26 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
             }
             case SGL_CMD_PROGRAMSTRINGARB: {
                 int target = *pb++,
-                    format = *pb++,
-                    len = *pb++;
-                char *string = (char*)pb;
-                ADVANCE_PAST_STRING();
+                    format = *pb++;
+                const char *string;
+                int len;
+                if (!read_counted_strings(&pb, next, 1, &string, &len))
+                    break;
                 glProgramStringARB(target, format, len, string);
                 break;
             }
             case SGL_CMD_SHADERSOURCEARB: {
                 int shader = *pb++,
                     count = *pb++;
+                if (!OPERANDS_FIT(count, sizeof(int)))
+                    break;
                 const char *strings[count];
                 int lengths[count];
-                read_counted_strings(&pb, count, strings, lengths);
-                glShaderSourceARB(shader, count, strings, lengths);
+                if (!read_counted_strings(&pb, next, count, strings, lengths))
+                    break;
+                sgl_forget_shader_source(ctx, shader);
+                sgl_note_draw_id(ctx, strings, lengths, count);
+                glShaderSourceARB(sgl_shader_name(ctx, shader), count, strings, lengths);
                 break;
             }
             case SGL_CMD_UNIFORM1IARB: {
@@ -6179,6 +7627,8 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 int target = *pb++,
                     index = *pb++,
                     count = *pb++;
+                if (!OPERANDS_FIT(count, 4 * sizeof(float)))
+                    break;
                 float *params = (float*)pb;
                 pb += count * 4;
                 glProgramEnvParameters4fvEXT(target, index, count, params);
@@ -6223,13 +7673,27 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
                 break;
             }
             }
-            if (!begun) {
+            pb = next;
+            if (validate && !begun) {
                 int error;
-                while ((error = glGetError()) != GL_NO_ERROR)
+                while ((error = glGetError()) != GL_NO_ERROR) {
                     PRINT_LOG("gl error (%d / 0x%04x) on client %d from %s (%d)\n", error, error, client_id, sgl_cmd2str(cmd), cmd);
+                    if (ctx != NULL && ctx->error == GL_NO_ERROR)
+                        ctx->error = error;
+                }
             }
         }
 
+        /*
+         * without validation, errors are only collected once per submit;
+         * anything after the first stays queued in the driver until the
+         * client has cleared the one it was told about
+         */
+        if (!validate && !begun && ctx != NULL && ctx->error == GL_NO_ERROR)
+            ctx->error = glGetError();
+
+        sgl_stats_submit_done();
+
         /* 
          * submit done 
          */
@@ -6239,8 +7703,10 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
         if (net_ctx == NULL) {
             memcpy(client_slot + SGL_OFFSET_REGISTER_RETVAL,
                 (char*)p + SGL_OFFSET_REGISTER_RETVAL,
-                SGL_CLIENT_SLOT_SIZE - SGL_OFFSET_REGISTER_RETVAL);
-            *(int*)(client_slot + SGL_OFFSET_REGISTER_SUBMIT) = 0;
+                SGL_OFFSET_SLOT_CONTROL - SGL_OFFSET_REGISTER_RETVAL);
+            *(int*)(client_slot + SGL_OFFSET_REGISTER_ERROR) = ctx != NULL ? ctx->error : GL_NO_ERROR;
+            __sync_synchronize();
+            *(volatile int*)(client_slot + SGL_OFFSET_REGISTER_RING_DONE_SEQ) = submit_seq;
 
             if (release_client_slot != 0) {
                 sgl_release_client_slot(shared, release_client_slot);
@@ -6257,13 +7723,23 @@ void sgl_cmd_processor_start(struct sgl_cmd_processor_args args)
 
                 memcpy(&packet.retval, (uint64_t*)(p + SGL_OFFSET_REGISTER_RETVAL), 8);
                 memcpy(&packet.retval_v, (uint64_t*)(p + SGL_OFFSET_REGISTER_RETVAL_V), 256);
+                packet.error = ctx != NULL ? ctx->error : GL_NO_ERROR;
 
-                ENetPacket *epacket = __enet_packet_create(&packet, sizeof(packet), ENET_PACKET_FLAG_RELIABLE);
-                __enet_peer_send(peer, 0, epacket);
+                /*
+                 * bulk readbacks follow the retval in the same packet
+                 */
+                ENetPacket *epacket = __enet_packet_create(NULL, sizeof(packet) + net_readback_size, ENET_PACKET_FLAG_RELIABLE);
+                if (epacket != NULL) {
+                    memcpy(epacket->data, &packet, sizeof(packet));
+                    if (net_readback_size != 0)
+                        memcpy(epacket->data + sizeof(packet), net_readback, net_readback_size);
+                    __enet_peer_send(peer, 0, epacket);
+                }
             }
             else {
                 network_expecting_retval = true;
             }
+            net_readback_size = 0;
 
             if (network_did_swap_buffers) {
                 sgl_net_send_framebuffer(p, server, peer, framebuffer_size);
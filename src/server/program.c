@@ -0,0 +1,238 @@
+#include <sharedgl.h>
+#include <server/program.h>
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <inttypes.h>
+
+#define SGL_PROGRAM_MAGIC 0x50474C53 /* "SGLP" */
+
+struct sgl_program_header {
+    uint32_t magic;
+    uint32_t format;
+    uint32_t length;
+};
+
+static struct {
+    const char *root;
+    char directory[4096];
+    bool probed, ready;
+} cache;
+
+struct sgl_shader_record *sgl_shader_record(struct sgl_shader_records *records, unsigned int name)
+{
+    if (name == 0 || name >= SGL_MAX_OBJECT_NAME)
+        return NULL;
+
+    if (name >= records->count) {
+        size_t count_new = records->count ? records->count : 256;
+        while (count_new <= name)
+            count_new *= 2;
+
+        struct sgl_shader_record *grown = realloc(records->records, count_new * sizeof(*grown));
+        if (grown == NULL)
+            return NULL;
+
+        memset(grown + records->count, 0, (count_new - records->count) * sizeof(*grown));
+        records->records = grown;
+        records->count = count_new;
+    }
+
+    return &records->records[name];
+}
+
+struct sgl_shader_record *sgl_shader_record_find(struct sgl_shader_records *records, unsigned int name)
+{
+    return name < records->count ? &records->records[name] : NULL;
+}
+
+void sgl_shader_record_mix(struct sgl_shader_record *record, const void *data, size_t size)
+{
+    struct sgl_sha256 sha;
+    sgl_sha256_init(&sha);
+    sgl_sha256_update(&sha, record->key.hash, sizeof(record->key.hash));
+    sgl_sha256_update(&sha, data, size);
+    sgl_sha256_final(&sha, record->key.hash);
+}
+
+void sgl_shader_records_free(struct sgl_shader_records *records)
+{
+    free(records->records);
+    records->records = NULL;
+    records->count = 0;
+}
+
+void sgl_program_cache_init(const char *directory)
+{
+    if (directory == NULL)
+        return;
+
+    if (mkdir(directory, 0755) != 0 && errno != EEXIST) {
+        PRINT_LOG("failed to create program directory '%s', programs are linked from source\n", directory);
+        return;
+    }
+
+    cache.root = directory;
+}
+
+/*
+ * a driver update can change what binaries it accepts, and what a
+ * source compiles to, so each driver gets a directory of its own
+ */
+bool sgl_program_cache_ready(void)
+{
+    if (cache.probed)
+        return cache.ready;
+    if (cache.root == NULL)
+        return false;
+
+    cache.probed = true;
+
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    if (formats <= 0) {
+        PRINT_LOG("driver has no program binary formats, programs are linked from source\n");
+        return false;
+    }
+
+    static const GLenum strings[] = { GL_VENDOR, GL_RENDERER, GL_VERSION, GL_SHADING_LANGUAGE_VERSION };
+    unsigned char driver[SGL_SHA256_SIZE];
+    char digest[2 * SGL_SHA256_SIZE + 1];
+    struct sgl_sha256 sha;
+
+    sgl_sha256_init(&sha);
+    for (size_t i = 0; i < sizeof(strings) / sizeof(*strings); i++) {
+        const char *string = (const char*)glGetString(strings[i]);
+        sgl_sha256_update(&sha, string ? string : "", string ? strlen(string) + 1 : 1);
+    }
+    sgl_sha256_final(&sha, driver);
+    sgl_digest_string(digest, driver);
+
+    snprintf(cache.directory, sizeof(cache.directory), "%s/%s", cache.root, digest);
+    if (mkdir(cache.directory, 0755) != 0 && errno != EEXIST) {
+        PRINT_LOG("failed to create program directory '%s', programs are linked from source\n", cache.directory);
+        return false;
+    }
+
+    PRINT_LOG("keeping program binaries in '%s'\n", cache.directory);
+    cache.ready = true;
+    return true;
+}
+
+static void sgl_shader_path(char *path, size_t length, const struct sgl_blob_key *source)
+{
+    char digest[2 * SGL_SHA256_SIZE + 1];
+    sgl_digest_string(digest, source->hash);
+    snprintf(path, length, "%s/%s-%" PRIu64 ".shader", cache.directory, digest, source->size);
+}
+
+static void sgl_program_path(char *path, size_t length, const uint64_t key[4])
+{
+    char digest[2 * SGL_SHA256_SIZE + 1];
+    sgl_digest_string(digest, key);
+    snprintf(path, length, "%s/%s.program", cache.directory, digest);
+}
+
+bool sgl_program_cache_compiled(const struct sgl_blob_key *source)
+{
+    char path[4096 + 64];
+    sgl_shader_path(path, sizeof(path), source);
+    return access(path, F_OK) == 0;
+}
+
+/*
+ * an empty file is all it takes to remember a source compiles
+ */
+void sgl_program_cache_note_compiled(const struct sgl_blob_key *source)
+{
+    char path[4096 + 64];
+    sgl_shader_path(path, sizeof(path), source);
+
+    if (access(path, F_OK) == 0)
+        return;
+
+    FILE *file = fopen(path, "wb");
+    if (file != NULL)
+        fclose(file);
+}
+
+bool sgl_program_cache_load(GLuint program, const uint64_t key[4])
+{
+    char path[4096 + 64];
+    sgl_program_path(path, sizeof(path), key);
+
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+        return false;
+
+    struct sgl_program_header header;
+    void *binary = NULL;
+
+    if (fread(&header, sizeof(header), 1, file) == 1 && header.magic == SGL_PROGRAM_MAGIC && header.length != 0) {
+        binary = malloc(header.length);
+        if (binary != NULL && (fread(binary, 1, header.length, file) != header.length || fgetc(file) != EOF)) {
+            free(binary);
+            binary = NULL;
+        }
+    }
+
+    fclose(file);
+
+    if (binary == NULL) {
+        PRINT_LOG("ignoring damaged program '%s'\n", path);
+        return false;
+    }
+
+    GLint status = GL_FALSE;
+    glProgramBinary(program, header.format, binary, header.length);
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    free(binary);
+
+    /*
+     * drivers may turn down their own binaries, the caller relinks
+     * and the file is replaced with one that works
+     */
+    return status == GL_TRUE;
+}
+
+/*
+ * written under a temporary name and renamed into place, so other
+ * servers sharing the directory never see half a program
+ */
+void sgl_program_cache_save(GLuint program, const uint64_t key[4])
+{
+    GLint status = GL_FALSE, length = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (status != GL_TRUE || length <= 0)
+        return;
+
+    struct sgl_program_header header = { SGL_PROGRAM_MAGIC, 0, 0 };
+    void *binary = malloc(length);
+    if (binary == NULL)
+        return;
+
+    GLsizei written_length = 0;
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &written_length, &format, binary);
+    header.format = format;
+    header.length = written_length;
+
+    char path[4096 + 64], temp[4096 + 96];
+    sgl_program_path(path, sizeof(path), key);
+    snprintf(temp, sizeof(temp), "%s.%d", path, (int)getpid());
+
+    FILE *file = written_length > 0 ? fopen(temp, "wb") : NULL;
+    if (file != NULL) {
+        bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+            fwrite(binary, 1, written_length, file) == (size_t)written_length;
+        if (fclose(file) != 0 || !written || rename(temp, path) != 0) {
+            PRINT_LOG("failed to write program '%s'\n", path);
+            remove(temp);
+        }
+    }
+
+    free(binary);
+}
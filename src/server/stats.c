@@ -0,0 +1,41 @@
+#include <sharedgl.h>
+#include <server/stats.h>
+
+#include <inttypes.h>
+
+struct sgl_stats sgl_stats;
+
+static int interval;
+static time_t last_report;
+
+void sgl_stats_set_interval(int seconds)
+{
+    interval = seconds;
+}
+
+static inline double sgl_stats_percent(uint64_t part, uint64_t whole)
+{
+    return whole != 0 ? 100.0 * part / whole : 0.0;
+}
+
+void sgl_stats_submit_done(void)
+{
+    sgl_stats.submits++;
+
+    if (interval <= 0)
+        return;
+
+    time_t now = time(NULL);
+    if (last_report == 0)
+        last_report = now;
+    if (now - last_report < interval)
+        return;
+
+    PRINT_LOG("stats: %" PRIu64 " submits, %" PRIu64 " draws, %" PRIu64 " (%.1f%%) coalesced into %" PRIu64 " multi-draws\n",
+        sgl_stats.submits, sgl_stats.draws,
+        sgl_stats.coalesced_draws, sgl_stats_percent(sgl_stats.coalesced_draws, sgl_stats.draws),
+        sgl_stats.coalesced_calls);
+
+    sgl_stats = (struct sgl_stats){ 0 };
+    last_report = now;
+}
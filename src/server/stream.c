@@ -0,0 +1,128 @@
+#include <sharedgl.h>
+#include <server/stream.h>
+
+#include <string.h>
+
+#define SGL_STREAM_SEGMENT_SIZE (SGL_STREAM_SIZE / SGL_STREAM_SEGMENTS)
+
+static bool sgl_stream_init(struct sgl_stream *stream)
+{
+    GLint copy_write_buffer;
+
+    if (epoxy_gl_version() < 44 && !epoxy_has_gl_extension("GL_ARB_buffer_storage")) {
+        PRINT_LOG("host lacks buffer storage, client arrays are drawn from client memory\n");
+        return false;
+    }
+
+    /*
+     * borrow a binding the application is unlikely to be relying on,
+     * and put back whatever it had there
+     */
+    glGetIntegerv(GL_COPY_WRITE_BUFFER_BINDING, &copy_write_buffer);
+
+    glGenBuffers(1, &stream->buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, stream->buffer);
+    glBufferStorage(GL_COPY_WRITE_BUFFER, SGL_STREAM_SIZE, NULL,
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+    stream->map = glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, SGL_STREAM_SIZE,
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, copy_write_buffer);
+
+    if (stream->map == NULL) {
+        PRINT_LOG("failed to map stream buffer, client arrays are drawn from client memory\n");
+        glDeleteBuffers(1, &stream->buffer);
+        stream->buffer = 0;
+        return false;
+    }
+
+    stream->head = 0;
+    stream->segment = 0;
+    return true;
+}
+
+/*
+ * fence the segment being left and wait for the gpu to be done with
+ * the one being entered, which it last read a whole ring ago
+ */
+static void sgl_stream_advance(struct sgl_stream *stream)
+{
+    int next = (stream->segment + 1) % SGL_STREAM_SEGMENTS;
+
+    stream->fences[stream->segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    if (stream->fences[next] != NULL) {
+        while (glClientWaitSync(stream->fences[next], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED);
+        glDeleteSync(stream->fences[next]);
+        stream->fences[next] = NULL;
+    }
+
+    stream->segment = next;
+}
+
+bool sgl_stream_fits(struct sgl_stream *stream, size_t length)
+{
+    if (stream->unavailable || length == 0 || length > SGL_STREAM_SEGMENT_SIZE)
+        return false;
+
+    if (stream->buffer == 0 && !sgl_stream_init(stream)) {
+        stream->unavailable = true;
+        return false;
+    }
+
+    return true;
+}
+
+static intptr_t sgl_stream_reserve(struct sgl_stream *stream, size_t length)
+{
+    if (!sgl_stream_fits(stream, length))
+        return -1;
+
+    size_t offset = (stream->head + SGL_STREAM_ALIGNMENT - 1) & ~(size_t)(SGL_STREAM_ALIGNMENT - 1);
+    if (offset + length > SGL_STREAM_SIZE)
+        offset = 0;
+
+    /*
+     * walk forward through every segment up to the one the write ends
+     * in, wrapping around if it starts back at the beginning
+     */
+    int last = (int)((offset + length - 1) / SGL_STREAM_SEGMENT_SIZE);
+    if (offset == 0 && stream->head != 0)
+        sgl_stream_advance(stream);
+    while (stream->segment != last)
+        sgl_stream_advance(stream);
+
+    stream->head = offset + length;
+    return (intptr_t)offset;
+}
+
+intptr_t sgl_stream_write(struct sgl_stream *stream, const void *data, size_t length)
+{
+    intptr_t offset = sgl_stream_reserve(stream, length);
+    if (offset >= 0)
+        memcpy((char*)stream->map + offset, data, length);
+    return offset;
+}
+
+intptr_t sgl_stream_copy(struct sgl_stream *stream, GLuint buffer, size_t lead, size_t length)
+{
+    GLint copy_read_buffer, copy_write_buffer;
+
+    if (lead > SGL_STREAM_SEGMENT_SIZE)
+        return -1;
+
+    intptr_t offset = sgl_stream_reserve(stream, lead + length);
+    if (offset < 0)
+        return -1;
+
+    glGetIntegerv(GL_COPY_READ_BUFFER_BINDING, &copy_read_buffer);
+    glGetIntegerv(GL_COPY_WRITE_BUFFER_BINDING, &copy_write_buffer);
+
+    glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, stream->buffer);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, offset + lead, length);
+
+    glBindBuffer(GL_COPY_READ_BUFFER, copy_read_buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, copy_write_buffer);
+    return offset + (intptr_t)lead;
+}